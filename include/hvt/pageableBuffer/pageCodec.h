@@ -0,0 +1,60 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace HVT_NS
+{
+
+/// Codec of an encoded page, stored in the first byte of the page.
+enum class HdPageCodec : uint8_t
+{
+    Raw       = 0, ///< Stored as is
+    ShuffleLZ = 1, ///< Bytes regrouped by element stride, then LZ compressed
+};
+
+/// Page encoding between the serializers and the page files.
+///
+/// Encoded page layout:
+///   Raw:       [uint8 codec] [bytes]
+///   ShuffleLZ: [uint8 codec] [uint8 stride] [uint64 raw size] [compressed bytes]
+///
+/// The shuffle stores the first byte of all elements, then the second byte of all elements, and
+/// so on. Exponents and high order bytes of float and integer arrays then form long repetitive
+/// runs that the LZ stage (an LZ4-like block format) compresses well.
+namespace HdPageCodecs
+{
+
+/// Encodes size bytes with the given codec. stride is the size of the scalars of the data (e.g.
+/// 4 for float and GfVec3f arrays), 1 disables the shuffle. Data which does not get smaller is
+/// stored raw.
+HVT_API std::vector<uint8_t> Encode(
+    HdPageCodec codec, const uint8_t* data, size_t size, size_t stride);
+
+/// Decodes a page. Raw pages are returned in place, the others are decoded into scratch.
+/// Returns false if the page is truncated or corrupted.
+HVT_API bool Decode(const uint8_t* page, size_t pageSize, std::vector<uint8_t>& scratch,
+    const uint8_t*& data, size_t& size);
+
+/// Returns the codec of an encoded page (Raw for an empty page).
+HVT_API HdPageCodec GetCodec(const uint8_t* page, size_t pageSize);
+
+} // namespace HdPageCodecs
+
+} // namespace HVT_NS
@@ -14,22 +14,45 @@
 #pragma once
 
 #include <hvt/api.h>
+#include <hvt/pageableBuffer/pageIOEngine.h>
 #include <hvt/pageableBuffer/pageableMemoryMonitor.h> // Constants
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/span.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
-#include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace HVT_NS
 {
 
 class HdBufferPageEntry;
+class HdPageFileEntry;
+class HdPageFileManager;
+
+/// I/O backend used by the page files.
+enum class HdPageFileIOMode
+{
+    Positional,  ///< pread/pwrite-style positional I/O, no shared file pointer (default)
+    MemoryMapped ///< Page files are mapped into the address space; page-ins are memcpy or zero-copy
+};
 
 struct HVT_API HdFreeListEntry
 {
@@ -40,37 +63,268 @@ struct HVT_API HdFreeListEntry
     HdFreeListEntry(std::ptrdiff_t offset, size_t size) : offset(offset), size(size) {}
 };
 
+/// One directory of the page storage. Tiers are ordered fastest first (see HdPageFileManager).
+struct HVT_API HdPageStorageTier
+{
+    std::filesystem::path directory;
+    size_t capacity = 0; ///< Bytes the tier's page files may take, 0 = unlimited
+};
+
+/// Location of a page inside the page files.
+struct HVT_API HdPageLocation
+{
+    size_t pageId         = 0;
+    std::ptrdiff_t offset = -1;
+};
+
+/// Outcome of one HdPageFileManager::Compact or MigrateColdPages call.
+struct HVT_API HdPageFileCompactionResult
+{
+    size_t bytesMoved    = 0;     ///< Live page bytes relocated
+    size_t pagesMoved    = 0;     ///< Live pages relocated
+    size_t bytesReleased = 0;     ///< Disk space given back by truncated or removed page files
+    bool pending         = false; ///< Sparse page files are left for later calls
+};
+
+/// Free space statistics of the page files.
+struct HVT_API HdPageFileFragmentation
+{
+    size_t fileBytes   = 0; ///< Bytes allocated in the page files, holes included
+    size_t freeBytes   = 0; ///< Bytes in holes, reusable without growing the files
+    size_t largestHole = 0; ///< Largest allocation that can be served without growing the files
+    size_t holeCount   = 0;
+};
+
+/// Statistics of the content-addressed page sharing (see HdPageFileManager).
+struct HVT_API HdPageDedupStats
+{
+    size_t sharedPages     = 0; ///< Distinct page contents stored on disk
+    size_t handles         = 0; ///< Page handles referencing them
+    size_t logicalBytes    = 0; ///< Bytes the handles would take without sharing
+    size_t physicalBytes   = 0; ///< Bytes actually stored for them
+    size_t duplicateWrites = 0; ///< Page writes served by an existing page
+    size_t bytesNotWritten = 0; ///< Bytes those writes did not have to write
+
+    /// Logical over physical bytes, 1 when nothing is shared.
+    double Ratio() const
+    {
+        return physicalBytes == 0 ? 1.0
+                                  : static_cast<double>(logicalBytes) /
+                static_cast<double>(physicalBytes);
+    }
+};
+
+/// Identity of a page in the persistent page cache.
+struct HVT_API HdPersistentPageKey
+{
+    std::string stage; ///< Stage identity, e.g. the root layer identifier
+    std::string primPath;
+    std::string attribute;
+    std::uint64_t contentHash = 0; ///< Hash of the page content
+};
+
+/// Free space allocator of a page file.
+/// Holes are kept in an offset-ordered tree and merged with their neighbours when released.
+/// They are also indexed by power-of-two size classes, so best fit allocation is O(log n).
+class HVT_API HdPageFileFreeSpace
+{
+public:
+    /// Takes the smallest hole that fits, splitting it if needed. Returns -1 if none fits.
+    std::ptrdiff_t Allocate(size_t size);
+    /// Returns the range to the free space and returns the hole it ended up in.
+    HdFreeListEntry Release(std::ptrdiff_t offset, size_t size);
+    /// Removes the hole starting at offset, if any.
+    void Erase(std::ptrdiff_t offset);
+    void Clear();
+
+    size_t FreeBytes() const { return mFreeBytes; }
+    size_t HoleCount() const { return mHoles.size(); }
+    size_t LargestHole() const;
+
+private:
+    static constexpr size_t NUM_SIZE_CLASSES = 64;
+    using SizeClassBin = std::set<std::pair<size_t, std::ptrdiff_t>>; ///< (size, offset)
+
+    void Insert(std::ptrdiff_t offset, size_t size);
+    void Remove(std::map<std::ptrdiff_t, size_t>::iterator hole);
+
+    std::map<std::ptrdiff_t, size_t> mHoles; ///< offset -> size
+    std::array<SizeClassBin, NUM_SIZE_CLASSES> mBins;
+    std::uint64_t mNonEmptyBins = 0; ///< Bit i is set when mBins[i] is not empty
+    size_t mFreeBytes           = 0;
+};
+
+/// Zero-copy view of a page inside a memory-mapped page file.
+/// While the view exists, compaction keeps the page file (and its mapping) alive. The content
+/// is only valid until the page is updated or released.
+class HVT_API HdPageView
+{
+public:
+    HdPageView() = default;
+    ~HdPageView();
+    HdPageView(HdPageView&& other) noexcept;
+    HdPageView& operator=(HdPageView&& other) noexcept;
+    HdPageView(const HdPageView&)            = delete;
+    HdPageView& operator=(const HdPageView&) = delete;
+
+    const std::byte* data() const noexcept { return mData.data(); }
+    size_t size() const noexcept { return mData.size(); }
+    bool empty() const noexcept { return mData.empty(); }
+    const std::byte* begin() const noexcept { return mData.data(); }
+    const std::byte* end() const noexcept { return mData.data() + mData.size(); }
+    const std::byte& operator[](size_t index) const noexcept { return mData.data()[index]; }
+    PXR_NS::TfSpan<const std::byte> Span() const noexcept { return mData; }
+
+private:
+    HdPageView(const HdPageFileEntry* pageFile, PXR_NS::TfSpan<const std::byte> data) noexcept :
+        mPageFile(pageFile), mData(data)
+    {
+    }
+    void Reset() noexcept;
+
+    const HdPageFileEntry* mPageFile = nullptr; ///< Pinned page file, nullptr for empty views
+    PXR_NS::TfSpan<const std::byte> mData;
+
+    friend class HdPageFileManager;
+};
+
 class HVT_API HdPageFileEntry
 {
 public:
-    HdPageFileEntry(const std::string& filename, size_t pageId);
+    HdPageFileEntry(const std::string& filename, size_t pageId,
+        HdPageFileIOMode ioMode = HdPageFileIOMode::Positional, size_t tier = 0);
     ~HdPageFileEntry();
 
     std::ptrdiff_t FindPageFileGap(size_t size);
     size_t NextOffset() const { return mNextOffset; }
     bool SetNextOffset(std::ptrdiff_t offset);
     void AddFreeListEntry(std::ptrdiff_t offset, size_t size);
-    void ConsolidateFreeList();
+    const HdPageFileFreeSpace& FreeSpace() const { return mFreeSpace; }
 
     size_t PageFileId() const { return mPageId; }
+    size_t Tier() const { return mTier; }
     size_t SizeLimit() const { return mSizeLimit; }
     const std::string& FileName() const { return mFileName; }
+    HdPageFileIOMode IOMode() const { return mIOMode; }
 
     bool WriteData(std::ptrdiff_t offset, const void* data, size_t size);
     bool ReadData(std::ptrdiff_t offset, void* data, size_t size);
+    /// Writes the buffers back to back starting at offset, with as few gathered writes as
+    /// possible. Buffers with null data only reserve their range.
+    bool WriteDataGather(
+        std::ptrdiff_t offset, PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>> buffers);
+    /// Reads the buffers back to back starting at offset, with as few scattered reads as
+    /// possible.
+    bool ReadDataScatter(
+        std::ptrdiff_t offset, PXR_NS::TfSpan<const PXR_NS::TfSpan<std::byte>> buffers);
+
+    /// Returns a view into the mapping (MemoryMapped mode only, empty otherwise).
+    /// The view stays valid until the page file is closed by compaction.
+    PXR_NS::TfSpan<const std::byte> MappedData(std::ptrdiff_t offset, size_t size) const;
+
+    /// Bytes of the live pages stored in this file.
+    size_t LiveBytes() const { return mLiveBytes; }
+    /// True once compaction moved all pages out and removed the file.
+    bool IsClosed() const { return mClosed; }
 
 private:
+    // Page registry and compaction support, driven by HdPageFileManager under its lock.
+    void AddPage(std::ptrdiff_t offset, size_t size);
+    bool RemovePage(std::ptrdiff_t offset, size_t size);
+    const HdPageLocation* FindForward(std::ptrdiff_t offset) const;
+    void TouchPage(std::ptrdiff_t offset);
+    std::int64_t LastAccess(std::ptrdiff_t offset) const;
+    size_t Truncate();
+    size_t Close();
+    size_t PhysicalSize() const;
+
+    bool OpenFile();
+    void CloseFile();
+    bool OpenMapping();
+    void CloseMapping();
+    bool EnsureMappedCapacity(size_t requiredSize);
+    bool PositionalWrite(std::ptrdiff_t offset, const void* data, size_t size);
+    bool PositionalRead(std::ptrdiff_t offset, void* data, size_t size) const;
+
     const std::string mFileName;
     const size_t mPageId;
+    const size_t mTier;
     const size_t mSizeLimit;
+    HdPageFileIOMode mIOMode = HdPageFileIOMode::Positional;
     std::ptrdiff_t mNextOffset = 0;
-    std::vector<HdFreeListEntry> mFreeList;
-    bool mFreeListConsolidated = true;
-    mutable std::mutex mFileMutex;
-    std::fstream mFile; ///< Kept open for the lifetime of this entry for performance
+    HdPageFileFreeSpace mFreeSpace;
+    mutable std::mutex mFileMutex; ///< Only guards the file growth, reads and writes are lock-free
+
+    // Kept open for the lifetime of this entry. All I/O is positional so concurrent reads and
+    // writes of different pages never share a file pointer.
+#if defined(_WIN32)
+    void* mFileHandle = nullptr;
+#else
+    int mFileDescriptor = -1;
+#endif
+
+    // MemoryMapped mode: the whole size limit is reserved up front so the mapping address never
+    // changes; the file itself is grown on demand.
+    std::byte* mMapping = nullptr;
+    std::atomic<size_t> mFileSize { 0 };
+
+    // Live pages at their offset in this file, and the new location of the pages compaction moved
+    // out of it. Both are only accessed under the HdPageFileManager lock.
+    std::map<std::ptrdiff_t, size_t> mPages;
+    std::unordered_map<std::ptrdiff_t, HdPageLocation> mForwards;
+    std::unordered_set<std::ptrdiff_t> mHeldRanges; ///< Forwarded ranges freed with their forward
+    size_t mLiveBytes = 0;
+    bool mClosed      = false;
+    bool mKeepFile    = false; ///< Holds persistent pages, the file outlives the entry
+
+    // In-flight I/O resolved to this file. Readers keep the file open; writers (and the write
+    // generation) keep compaction from moving pages which are being written.
+    mutable std::atomic<size_t> mActiveReaders { 0 };
+    std::atomic<size_t> mActiveWriters { 0 };
+    std::atomic<std::uint64_t> mWriteGeneration { 0 };
+
+    // Last access of the live pages (steady clock milliseconds), only tracked in the tiers which
+    // migrate their cold pages. Pages are added and removed under the manager's exclusive lock,
+    // the stamps are updated under its shared lock.
+    bool mTrackAccess = false;
+    std::unordered_map<std::ptrdiff_t, std::atomic<std::int64_t>> mPageAccess;
+
+    friend class HdPageFileManager;
+    friend class HdPageIOEngine;
+    friend class HdPageView;
 };
 
+/// Receives the entries of HdPageFileManager::CreatePageEntriesAsync, one per page.
+using HdPageEntriesCallback =
+    std::function<void(std::vector<std::unique_ptr<HdBufferPageEntry>> pageEntries)>;
+
+/// Streaming page writes. The writer hands the page to the sink in order, in chunks, e.g.
+/// straight from the storage of a value. The sink returns false on I/O errors or once the chunks
+/// exceed the page; the writer then stops and returns false.
+using HdPageSink   = std::function<bool(PXR_NS::TfSpan<const std::byte> chunk)>;
+using HdPageWriter = std::function<bool(const HdPageSink& sink)>;
+
 /// Manager for the page files on disk.
+///
+/// With page deduplication enabled, the content of each new page is hashed and pages with the
+/// same content share one region on disk. The handles of such pages are aliases (SHARED_PAGE_ID)
+/// resolved by the manager, so holders use them like any other handle. Shared regions are
+/// reference counted: an update copies the page out first (copy on write) and the region is
+/// released with its last handle.
+///
+/// In persistent mode the page files and an index of the persistent pages outlive the manager.
+/// The next manager on the same directory reattaches them, so a later session finds the pages
+/// of an earlier one (FindPersistentPage) instead of writing them again. The directory must not
+/// be shared by two managers at the same time.
+///
+/// The asynchronous page I/O runs on an HdPageIOEngine owned by the manager and created on first
+/// use, so the callers' threads only resolve and reserve the pages.
+///
+/// The page files can be spread over storage tiers, e.g. a small fast scratch volume and a large
+/// slow disk. New pages go to the fastest tier with room left and spill to the next one once its
+/// capacity is reached. MigrateColdPages moves the pages which were not accessed for a while to
+/// the next slower tier, and a page rewritten in a slower tier moves back up when a faster tier
+/// has room. Reads follow the pages to whichever tier holds them.
 class HVT_API HdPageFileManager
 {
 public:
@@ -78,33 +332,229 @@ public:
 
     std::unique_ptr<HdBufferPageEntry> CreatePageEntry(const void* data, size_t size);
     std::unique_ptr<HdBufferPageEntry> CreatePageEntry(PXR_NS::TfSpan<const std::byte> data);
+    /// Creates one page per input span. The pages are reserved contiguously in one pass and
+    /// written with a single gathered write. Returns one entry per input, nullptr on failure.
+    std::vector<std::unique_ptr<HdBufferPageEntry>> CreatePageEntries(
+        PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>> pages);
     bool LoadPage(const HdBufferPageEntry& handle, void* data);
     bool LoadPage(const HdBufferPageEntry& handle, PXR_NS::TfSpan<std::byte> dest);
+    /// Reads dest.size() bytes of the page from offset on, e.g. a payload behind its header
+    /// straight into its final storage. Fails if the range exceeds the page.
+    bool LoadPageRange(
+        const HdBufferPageEntry& handle, size_t offset, PXR_NS::TfSpan<std::byte> dest);
+    /// Returns a view of the page directly inside the page file mapping, without copying.
+    /// Only available in HdPageFileIOMode::MemoryMapped, returns an empty view otherwise.
+    /// The view is invalidated when the page is updated or released.
+    [[nodiscard]] HdPageView LoadPage(const HdBufferPageEntry& handle) const;
     bool UpdatePage(const HdBufferPageEntry& handle, const void* data);
     bool UpdatePage(const HdBufferPageEntry& handle, PXR_NS::TfSpan<const std::byte> data);
+    /// Streaming forms of CreatePageEntry and UpdatePage, for a page of size bytes written by
+    /// the writer, so the page is never assembled in memory. Chunks smaller than
+    /// STREAM_CHUNK_SIZE are gathered before they are written. With page deduplication, a new
+    /// page is gathered in full first since its content decides whether it is written.
+    std::unique_ptr<HdBufferPageEntry> CreatePageEntry(size_t size, const HdPageWriter& writer);
+    bool UpdatePage(const HdBufferPageEntry& handle, const HdPageWriter& writer);
     void ReleasePage(const HdBufferPageEntry& handle);
 
+    /// Asynchronous page I/O. The page is resolved (or reserved) right away and the data is read
+    /// or written by the I/O engine; submitting blocks while the engine's queue is full. The
+    /// buffers must stay valid until the callback ran. Callbacks run on an I/O thread, or on the
+    /// calling thread when there is nothing to read or write, and must not submit page I/O.
+    void LoadPageAsync(const HdBufferPageEntry& handle, PXR_NS::TfSpan<std::byte> dest,
+        HdPageIOCallback callback);
+    [[nodiscard]] std::future<bool> LoadPageAsync(
+        const HdBufferPageEntry& handle, PXR_NS::TfSpan<std::byte> dest);
+    void UpdatePageAsync(const HdBufferPageEntry& handle, PXR_NS::TfSpan<const std::byte> data,
+        HdPageIOCallback callback);
+    [[nodiscard]] std::future<bool> UpdatePageAsync(
+        const HdBufferPageEntry& handle, PXR_NS::TfSpan<const std::byte> data);
+    /// Like CreatePageEntries, but each page is submitted as its own request; the engine merges
+    /// the adjacent ones into gathered writes again.
+    void CreatePageEntriesAsync(PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>> pages,
+        HdPageEntriesCallback callback);
+    /// Waits until the page I/O submitted so far completed.
+    void WaitForPendingIO();
+    HdPageIOEngine& GetIOEngine();
+
+    /// Incremental compaction: moves up to ioBudget bytes of live pages out of the page files
+    /// whose live ratio is at most maxLiveRatio, then removes the emptied files and truncates
+    /// free file tails. Pages keep their handles, reads are forwarded to the new location.
+    /// Only one call runs at a time, concurrent calls return immediately.
+    HdPageFileCompactionResult Compact(
+        size_t ioBudget = DEFAULT_COMPACTION_BUDGET, float maxLiveRatio = 0.5f);
+    /// Tiered storage: moves up to ioBudget bytes of pages not accessed for minAge from a tier to
+    /// the next slower one, spilling further down if it is full. Handles are kept like in Compact.
+    /// Only one call runs at a time, concurrent calls return immediately.
+    HdPageFileCompactionResult MigrateColdPages(size_t ioBudget = DEFAULT_COMPACTION_BUDGET,
+        std::chrono::milliseconds minAge = DEFAULT_COLD_PAGE_AGE);
+
     size_t GetTotalDiskUsage() const;
+    /// Free space statistics over all page files.
+    HdPageFileFragmentation GetFragmentationStats() const;
+    /// Persistent page cache (persistent mode only). FindPersistentPage returns a new handle on
+    /// the page stored under the key by this or an earlier session, nullptr if there is none or
+    /// its content hash differs. StorePersistentPage records a page under the key, replacing the
+    /// page stored for the same stage, prim path and attribute; a plain handle is replaced by an
+    /// alias of the same page. The cache keeps its pages until they are replaced or unused for
+    /// PERSISTENT_PAGE_MAX_SESSIONS sessions.
+    std::unique_ptr<HdBufferPageEntry> FindPersistentPage(const HdPersistentPageKey& key);
+    bool StorePersistentPage(
+        const HdPersistentPageKey& key, std::unique_ptr<HdBufferPageEntry>& pageEntry);
+    void ClearPersistentPages();
+    size_t GetPersistentPageCount() const;
+
+    /// Page sharing statistics, all zero unless page deduplication is enabled.
+    HdPageDedupStats GetDeduplicationStats() const;
+    /// Statistics of the storage tiers, fastest first.
+    std::vector<HdPageTierStats> GetStorageTierStats() const;
     void PrintPagerStats() const;
 
-    static constexpr size_t MAX_PAGE_FILE_SIZE = static_cast<size_t>(2) * ONE_GiB;
+    HdPageFileIOMode GetIOMode() const { return mIOMode; }
+    bool IsDeduplicationEnabled() const { return mDeduplication; }
+    bool IsPersistent() const { return mPersistent; }
+    size_t GetStorageTierCount() const { return mStorageTiers.size(); }
+
+    static constexpr size_t MAX_PAGE_FILE_SIZE        = static_cast<size_t>(2) * ONE_GiB;
+    static constexpr size_t DEFAULT_COMPACTION_BUDGET = static_cast<size_t>(64) * ONE_MiB;
+    static constexpr size_t STREAM_CHUNK_SIZE         = static_cast<size_t>(64) * ONE_KiB;
+    static constexpr std::chrono::milliseconds DEFAULT_COLD_PAGE_AGE { 30000 };
+    /// Page id of the handles of shared pages, their offset is an alias id.
+    static constexpr size_t SHARED_PAGE_ID = std::numeric_limits<size_t>::max();
+    /// Sessions a persistent page survives without being found or stored.
+    static constexpr std::uint64_t PERSISTENT_PAGE_MAX_SESSIONS = 8;
 
 private:
-    // By design, only HdPageableBufferManager can create and hold it.
-    HdPageFileManager(std::filesystem::path pageFileDirectory);
+    // By design, only HdPageableBufferManager can create and hold it. The storage tiers replace
+    // the page file directory when given; the persistent page index lives in the first one.
+    HdPageFileManager(std::filesystem::path pageFileDirectory,
+        HdPageFileIOMode ioMode = HdPageFileIOMode::Positional, bool deduplicatePages = false,
+        bool persistent = false, const HdPageIOConfig& ioConfig = {},
+        std::vector<HdPageStorageTier> storageTiers = {});
 
     // Disable copy and move
     HdPageFileManager(const HdPageFileManager&) = delete;
     HdPageFileManager(HdPageFileManager&&)      = delete;
 
-    HdPageFileEntry* GetCurrentPageFileEntry() const;
-    bool CreatePageFile();
+    HdPageFileEntry* GetCurrentPageFileEntry(size_t tier) const;
+    bool IsCurrentPageFile(const HdPageFileEntry& entry) const;
+    HdPageFileEntry* ResolvePage(const HdBufferPageEntry& handle, std::ptrdiff_t& offset) const;
+    HdPageFileEntry* ResolveLocation(size_t pageId, std::ptrdiff_t& offset) const;
+    /// Resolves the page for an update and registers the writer. Takes the lock itself.
+    HdPageFileEntry* ResolvePageForUpdate(const HdBufferPageEntry& handle, std::ptrdiff_t& offset);
+    /// Moves a page about to be rewritten to a faster tier with room left, if there is one.
+    HdPageFileEntry* PromotePage(HdPageFileEntry* entry, std::ptrdiff_t& offset, size_t size);
+    void ReleaseLocation(size_t pageId, std::ptrdiff_t offset, size_t size);
+    HdPageFileEntry* SelectCompactionSource(float maxLiveRatio) const;
+    HdPageFileEntry* SelectMigrationSource(std::int64_t coldStamp) const;
+    size_t ReleaseEmptyPageFiles();
+    /// Allocates from the current page file of the fastest tier in [firstTier, endTier) with
+    /// room left.
+    HdPageFileEntry* AllocatePageRange(size_t size, std::ptrdiff_t& offset, size_t firstTier = 0,
+        size_t endTier = std::numeric_limits<size_t>::max());
+    size_t TierUsedBytes(size_t tier) const;
+    std::vector<std::unique_ptr<HdBufferPageEntry>> WritePageEntries(
+        PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>> pages);
+    bool CreatePageFile(size_t tier = 0);
+    HdPageFileFragmentation CollectFragmentationStats() const; ///< Caller holds mSyncMutex
+    HdPageDedupStats CollectDeduplicationStats() const;        ///< Caller holds mSyncMutex
+    std::vector<HdPageTierStats> CollectTierStats() const;     ///< Caller holds mSyncMutex
 
+    // Relocation of live pages, shared by compaction and migration. The pages are reserved under
+    // the exclusive lock, then copied without it; the new locations are published unless the
+    // source was written meanwhile.
+    struct PageMove
+    {
+        std::ptrdiff_t from = -1;
+        std::ptrdiff_t to   = -1;
+        size_t size         = 0;
+    };
+    HdPageFileEntry* ReservePageMoves(HdPageFileEntry& source, std::vector<PageMove>& moves,
+        size_t firstTier, std::ptrdiff_t& targetOffset);
+    void RelocatePages(HdPageFileEntry& source, HdPageFileEntry& target,
+        std::ptrdiff_t targetOffset, const std::vector<PageMove>& moves,
+        std::uint64_t writeGeneration, HdPageFileCompactionResult& result);
+
+    // Page deduplication. Unless noted, the caller holds mSyncMutex exclusively.
+    struct SharedPage
+    {
+        HdPageLocation location;
+        size_t size        = 0;
+        std::uint64_t hash = 0;
+        size_t refCount    = 0;     ///< Aliases referencing the page
+        bool indexed       = false; ///< Found by content, cleared once written in place
+    };
+    /// Returns an alias of an existing page with the same content, nullptr if there is none.
+    /// Takes the lock itself.
+    std::unique_ptr<HdBufferPageEntry> FindSharedPage(
+        std::uint64_t hash, const void* data, size_t size);
+    /// Compares a stored page with data. Takes the lock itself.
+    bool ComparePage(const HdPageLocation& location, const void* data, size_t size) const;
+    std::unique_ptr<HdBufferPageEntry> SharePage(
+        const HdPageLocation& location, size_t size, std::uint64_t hash);
+    std::unique_ptr<HdBufferPageEntry> AddPageAlias(size_t sharedPageId, size_t size);
+    void ReleaseSharedPage(size_t sharedPageId);
+    void UnindexSharedPage(size_t sharedPageId, SharedPage& page);
+    HdPageFileEntry* DetachSharedPage(const HdBufferPageEntry& handle, std::ptrdiff_t& offset);
+
+    // Persistent page cache. The index is read (and removed) when the manager is created and
+    // written back when it is destroyed, so a crashed session leaves no stale index behind.
+    struct PersistentPage
+    {
+        std::uint64_t contentHash = 0;
+        size_t sharedPageId       = 0;
+        std::uint64_t lastSession = 0;
+    };
+    bool LoadPersistentIndex();
+    bool SavePersistentIndex();
+    void RemovePageFiles();
+    static std::string PersistentPageName(const HdPersistentPageKey& key);
+
+    // Asynchronous page creation: the writes of a CreatePageEntriesAsync call share a batch, the
+    // last one to complete turns the reserved ranges into entries.
+    struct PageWriteBatch;
+    void CompletePageWrites(PageWriteBatch& batch);
+
+    // Entries are only appended and live as long as the manager, so a looked-up entry can be used
+    // after the lock is dropped. Exclusive lock for allocation, shared lock for lookups. Only the
+    // current entry of each tier is allocated from, the older ones are candidates for compaction.
     std::vector<std::unique_ptr<HdPageFileEntry>> mPageFileEntries;
-    mutable std::mutex mSyncMutex;
+    mutable std::shared_mutex mSyncMutex;
 
     std::filesystem::path mPageFileDirectory =
         std::filesystem::temp_directory_path() / "hvt_temp_pages";
+    HdPageFileIOMode mIOMode = HdPageFileIOMode::Positional;
+    std::atomic<bool> mCompacting { false };
+    std::atomic<bool> mMigrating { false };
+
+    // Storage tiers, fastest first. Counters are updated under mSyncMutex.
+    static constexpr size_t NO_PAGE_FILE = std::numeric_limits<size_t>::max();
+    struct StorageTier
+    {
+        HdPageStorageTier config;
+        size_t currentPageId = NO_PAGE_FILE; ///< Page file allocated from
+        size_t spilledBytes  = 0;
+        size_t migratedBytes = 0;
+        size_t promotedBytes = 0;
+    };
+    std::vector<StorageTier> mStorageTiers;
+
+    bool mDeduplication = false;
+    std::unordered_map<size_t, SharedPage> mSharedPages;
+    std::unordered_multimap<std::uint64_t, size_t> mSharedPageIndex; ///< Content hash -> page
+    std::unordered_map<std::ptrdiff_t, size_t> mPageAliases;          ///< Alias id -> page
+    size_t mNextSharedPageId    = 0;
+    std::ptrdiff_t mNextAliasId = 0;
+    size_t mDuplicateWrites     = 0;
+    size_t mBytesNotWritten     = 0;
+
+    bool mPersistent = false;
+    std::unordered_map<std::string, PersistentPage> mPersistentPages; ///< Stage, prim, attribute
+    std::uint64_t mSession = 0;
+
+    HdPageIOConfig mIOConfig;
+    std::unique_ptr<HdPageIOEngine> mIOEngine;
+    std::once_flag mIOEngineOnce;
+    std::atomic<bool> mIOEngineCreated { false };
 
     template <typename, typename, typename, typename>
     friend class HdPageableBufferManager;
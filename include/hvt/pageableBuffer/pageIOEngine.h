@@ -0,0 +1,163 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+#include <hvt/pageableBuffer/pageableMemoryMonitor.h> // Constants
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace HVT_NS
+{
+
+class HdPageFileEntry;
+
+/// Backend of the page I/O engine.
+enum class HdPageIOBackend
+{
+    Auto,       ///< Native asynchronous I/O when available, the thread pool otherwise (default)
+    ThreadPool, ///< Worker threads doing positional I/O
+    IOUring,    ///< Linux io_uring, falls back to the thread pool when not available
+};
+
+/// Configuration of the page I/O engine.
+struct HVT_API HdPageIOConfig
+{
+    HdPageIOBackend backend    = HdPageIOBackend::Auto;
+    size_t queueDepth          = 16;  ///< I/O operations in flight at the same time
+    size_t submissionQueueSize = 256; ///< Queued requests before Submit blocks
+    size_t maxMergeBytes       = static_cast<size_t>(4) * ONE_MiB; ///< Largest merged op
+};
+
+/// Called once per request with its outcome, on an I/O thread. It must be short, and must not
+/// submit requests itself or wait for other requests.
+using HdPageIOCallback = std::function<void(bool success)>;
+
+/// One read or write of a byte range of a page file.
+struct HVT_API HdPageIORequest
+{
+    enum class Op
+    {
+        Read,
+        Write
+    };
+
+    Op op                 = Op::Read;
+    HdPageFileEntry* file = nullptr; ///< Must stay open until the callback ran
+    std::ptrdiff_t offset = 0;
+    std::byte* data       = nullptr; ///< Destination of a read, source of a write (not modified)
+    size_t size           = 0;
+    HdPageIOCallback callback;
+};
+
+/// Counters of the page I/O engine.
+struct HVT_API HdPageIOStats
+{
+    size_t submitted      = 0;
+    size_t completed      = 0;
+    size_t failed         = 0;
+    size_t operations     = 0; ///< Reads and writes issued, after merging
+    size_t merged         = 0; ///< Requests merged into the operation of an adjacent request
+    size_t maxInFlight    = 0; ///< Most operations in flight at the same time
+    size_t queueFullWaits = 0; ///< Submissions which waited for space in the queue
+};
+
+/// Asynchronous I/O engine of the page files.
+///
+/// Requests go into a bounded submission queue; Submit blocks while it is full. Up to
+/// queueDepth operations run at the same time. Queued requests on adjacent ranges of the same
+/// page file are merged into one vectored read or write (preadv / pwritev).
+///
+/// On Linux the requests run on io_uring when the kernel allows it, with a single thread
+/// submitting and reaping. Otherwise (or with HdPageIOBackend::ThreadPool) a pool of worker
+/// threads runs them with positional I/O. If io_uring fails later on, the operations in flight
+/// are redone with positional I/O and the engine continues as a thread pool. Requests on
+/// memory-mapped page files are plain copies and always run on an engine thread.
+///
+/// Requests run in any order, a caller needing an order waits for the completion first. The
+/// engine completes all queued requests before it is destroyed.
+class HVT_API HdPageIOEngine
+{
+public:
+    explicit HdPageIOEngine(const HdPageIOConfig& config);
+    ~HdPageIOEngine();
+
+    /// Queues a request, blocking while the submission queue is full. If the engine is shutting
+    /// down, the callback is called right away with false.
+    void Submit(HdPageIORequest request);
+    [[nodiscard]] std::future<bool> Read(
+        HdPageFileEntry& file, std::ptrdiff_t offset, void* data, size_t size);
+    [[nodiscard]] std::future<bool> Write(
+        HdPageFileEntry& file, std::ptrdiff_t offset, const void* data, size_t size);
+
+    /// Waits until all submitted requests completed and their callbacks returned.
+    void WaitForIdle();
+    /// Requests submitted and not completed yet.
+    size_t GetPendingRequests() const;
+
+    /// The backend in use, never Auto. IOUring may change to ThreadPool if io_uring fails.
+    HdPageIOBackend GetBackend() const { return mBackend; }
+    const HdPageIOConfig& GetConfig() const { return mConfig; }
+    HdPageIOStats GetStats() const;
+
+    /// True if the native asynchronous backend can be used on this system.
+    static bool IsNativeBackendAvailable();
+
+    /// Largest number of requests merged into one operation.
+    static constexpr size_t MAX_MERGED_REQUESTS = 64;
+    /// Largest number of thread pool workers; deeper queues only apply to the native backend.
+    static constexpr size_t MAX_WORKER_THREADS = 16;
+
+private:
+    struct IOBatch;    ///< Requests merged into one operation
+    class NativeQueue; ///< io_uring submission and completion rings
+
+    // Disable copy and move
+    HdPageIOEngine(const HdPageIOEngine&) = delete;
+    HdPageIOEngine(HdPageIOEngine&&)      = delete;
+
+    void PopBatch(IOBatch& batch); ///< Caller holds mMutex, the queue is not empty
+    static bool Execute(const IOBatch& batch);
+    void Complete(IOBatch& batch, bool success);
+    void WorkerLoop();
+    void NativeLoop();
+    void FallBackToThreadPool(); ///< Called by the native thread when io_uring stops working
+
+    HdPageIOConfig mConfig;
+    std::atomic<HdPageIOBackend> mBackend { HdPageIOBackend::ThreadPool };
+    std::unique_ptr<NativeQueue> mNativeQueue;
+
+    mutable std::mutex mMutex;
+    std::condition_variable mRequestAvailable;
+    std::condition_variable mSpaceAvailable;
+    std::condition_variable mIdle;
+    std::deque<HdPageIORequest> mQueue;
+    size_t mPending  = 0; ///< Submitted and not completed
+    size_t mInFlight = 0; ///< Operations taken from the queue and not completed
+    bool mStopping   = false;
+    HdPageIOStats mStats;
+
+    std::vector<std::thread> mThreads;
+};
+
+} // namespace HVT_NS
@@ -0,0 +1,73 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace HVT_NS
+{
+
+/// Lossy encoding of a quantized page, by the role of the attribute, stored in the first byte
+/// of the page.
+enum class HdQuantizedRole : uint8_t
+{
+    None     = 0, ///< Serialized exactly
+    Position = 1, ///< 16-bit offsets in the bounding box of the array
+    Normal   = 2, ///< Octahedral 2 x 16-bit
+    TexCoord = 3, ///< Half floats
+};
+
+/// Quantization kernels of the lossy page format. The encoded data has no alignment
+/// requirement, and the decoders are branchless loops over contiguous elements, which the
+/// compilers vectorize.
+///
+/// Error bounds of a decoded value:
+///   Position: half a step of the 16-bit grid of the bounding box per axis, (max - min) / 131070,
+///             plus the float rounding of the decoded coordinate
+///   Normal:   OCTAHEDRAL_MAX_ERROR between the unit vectors, decoded unit length
+///   TexCoord: 2^-11 relative (2^-25 absolute below 2^-14), the rounding of a half float
+namespace HdPageQuantization
+{
+
+/// Largest distance between a unit vector and its decoded octahedral encoding.
+constexpr float OCTAHEDRAL_MAX_ERROR = 1e-4f;
+
+/// Largest finite half float.
+constexpr float HALF_MAX = 65504.0f;
+
+/// Encodes count positions (x, y, z floats) as 16-bit offsets from origin, in steps of step per
+/// axis, 6 bytes per position. origin and step are the bounding box of the positions divided in
+/// 65535 steps. Returns false if a coordinate, or the extent of the bounding box along an axis,
+/// is not finite.
+HVT_API bool EncodePositions(
+    const float* xyz, size_t count, float origin[3], float step[3], uint8_t* out);
+HVT_API void DecodePositions(const uint8_t* in, size_t count, const float origin[3],
+    const float step[3], float* xyz);
+
+/// Encodes count directions (x, y, z floats) as octahedral 2 x 16-bit snorm, 4 bytes per
+/// direction. Zero vectors decode as +Z. Returns false if a coordinate is not finite.
+HVT_API bool EncodeOctahedral(const float* xyz, size_t count, uint8_t* out);
+HVT_API void DecodeOctahedral(const uint8_t* in, size_t count, float* xyz);
+
+/// Encodes count floats as IEEE half floats rounded to nearest even, 2 bytes per float.
+/// Returns false if a value is not finite or beyond HALF_MAX.
+HVT_API bool EncodeHalfs(const float* values, size_t count, uint8_t* out);
+HVT_API void DecodeHalfs(const uint8_t* in, size_t count, float* values);
+
+} // namespace HdPageQuantization
+
+} // namespace HVT_NS
@@ -0,0 +1,81 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace HVT_NS
+{
+
+class HdPageableBufferCore;
+
+/// Buffers of a buffer manager ordered by frame stamp, oldest first.
+///
+/// The buffers are linked into one intrusive list per frame stamp (generation), in the order
+/// they were first stamped. HdPageableBufferCore::UpdateFrameStamp moves a buffer to the tail of
+/// its new generation, so selecting the k least recently used buffers visits k buffers and the
+/// generations holding them instead of sorting all buffers. Repeat stamps within a frame leave
+/// the buffer in place and do not lock the index.
+///
+/// The index holds no reference on the buffers: a buffer unlinks itself when it is destroyed,
+/// and the buffers still linked when the index is destroyed are detached from it.
+class HVT_API HdBufferAccessIndex
+{
+public:
+    HdBufferAccessIndex() = default;
+    ~HdBufferAccessIndex();
+
+    /// Links the buffer at its current frame stamp. Does nothing if it is already linked.
+    void Insert(const std::shared_ptr<HdPageableBufferCore>& buffer);
+    /// Unlinks the buffer. Does nothing if it is not linked to this index.
+    void Remove(HdPageableBufferCore& buffer) noexcept;
+    /// Sets the frame stamp of the buffer and moves it to the tail of that generation. Does
+    /// nothing if the buffer already has that frame stamp.
+    void Touch(HdPageableBufferCore& buffer, unsigned int frame) noexcept;
+
+    /// Up to count buffers, least recently stamped first. Buffers being destroyed are skipped.
+    [[nodiscard]] std::vector<std::shared_ptr<HdPageableBufferCore>> SelectOldest(
+        size_t count) const;
+
+    [[nodiscard]] size_t Size() const;
+    /// Distinct frame stamps of the linked buffers.
+    [[nodiscard]] size_t GetGenerationCount() const;
+
+private:
+    struct Generation
+    {
+        HdPageableBufferCore* head = nullptr;
+        HdPageableBufferCore* tail = nullptr;
+    };
+
+    // Disable copy and move
+    HdBufferAccessIndex(const HdBufferAccessIndex&) = delete;
+    HdBufferAccessIndex(HdBufferAccessIndex&&)      = delete;
+
+    // Caller holds mMutex.
+    void Link(HdPageableBufferCore& buffer);
+    void Unlink(HdPageableBufferCore& buffer) noexcept;
+
+    mutable std::mutex mMutex;
+    std::map<unsigned int, Generation> mGenerations;
+    size_t mSize = 0;
+};
+
+} // namespace HVT_NS
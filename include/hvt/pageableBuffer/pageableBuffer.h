@@ -20,7 +20,9 @@
 #include <pxr/base/tf/span.h>
 #include <pxr/usd/sdf/path.h>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -32,6 +34,10 @@ namespace HVT_NS
 // Forward declarations
 class HdPageFileManager;
 class HdMemoryMonitor;
+class HdMemoryPool;
+class HdBufferAccessIndex;
+class HdPagingTraceRecorder;
+enum class HdPagingTraceEvent : uint8_t;
 
 template <
 #if defined(ENABLE_PAGING_CONCEPTS)
@@ -137,6 +143,26 @@ public:
             static_cast<int>(HdBufferState::DiskBuffer)));
     // clang-format on
 
+    // Batched page-out, used by the manager to write many pages with one gathered write.
+    // Prepare: Return the bytes to page out from the source buffer, or an empty span when the
+    // buffer has to go through SwapSceneToDisk / SwapRendererToDisk instead.
+    [[nodiscard]] virtual PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState source);
+    // Complete: Take over the written page and release the buffers like a swap does.
+    virtual bool CompletePageOut(std::unique_ptr<HdBufferPageEntry> pageEntry,
+        HdBufferState releaseBuffer = static_cast<HdBufferState>(
+            static_cast<int>(HdBufferState::SceneBuffer) |
+            static_cast<int>(HdBufferState::RendererBuffer)));
+
+    // Asynchronous page-in, used by the manager to read the page on the page I/O engine.
+    // Prepare: Return the page to read into scene memory, or nullptr when the buffer has to go
+    // through PageToSceneMemory / SwapToSceneMemory instead.
+    [[nodiscard]] virtual const HdBufferPageEntry* PreparePageIn();
+    // Complete: Create the scene buffer from the page read and release the buffers like a swap.
+    virtual bool CompletePageIn(PXR_NS::TfSpan<const std::byte> page,
+        HdBufferState releaseBuffer = static_cast<HdBufferState>(
+            static_cast<int>(HdBufferState::RendererBuffer) |
+            static_cast<int>(HdBufferState::DiskBuffer)));
+
     // Core operation sets: Release. //////////////////////////////////////////
     // Release: Release the source buffer and update the state.
     virtual void ReleaseSceneBuffer() noexcept;
@@ -155,13 +181,39 @@ public:
     [[nodiscard]] constexpr HdBufferUsage Usage() const noexcept { return mUsage; }
     [[nodiscard]] constexpr HdBufferState GetBufferState() const noexcept { return mBufferState; }
 
-    [[nodiscard]] constexpr unsigned int FrameStamp() const noexcept { return mFrameStamp; }
-    void UpdateFrameStamp(unsigned int frame) noexcept { mFrameStamp = frame; }
+    [[nodiscard]] unsigned int FrameStamp() const noexcept
+    {
+        return mFrameStamp.load(std::memory_order_relaxed);
+    }
+    // Also moves the buffer in the access index of its buffer manager, if any, counts the
+    // access and records it in the paging trace.
+    void UpdateFrameStamp(unsigned int frame) noexcept;
+    // Number of UpdateFrameStamp calls (wraps around), the access frequency seen by the
+    // scan-resistant selection strategies.
+    [[nodiscard]] unsigned int AccessCount() const noexcept
+    {
+        return mAccessCount.load(std::memory_order_relaxed);
+    }
+
+    // Set while a page-in issued ahead of the accesses waits for the first access, which takes
+    // it (see HdPrefetchHistory).
+    void SetPrefetched(bool prefetched) noexcept
+    {
+        mPrefetched.store(prefetched, std::memory_order_relaxed);
+    }
+    [[nodiscard]] bool TakePrefetched() noexcept
+    {
+        return mPrefetched.load(std::memory_order_relaxed) && mPrefetched.exchange(false);
+    }
+
+    // Memory pool the buffer is accounted in, if any (see HdPageableBufferManager).
+    [[nodiscard]] HdMemoryPool* GetMemoryPool() const noexcept { return mMemoryPool.load(); }
 
     // Status
-    [[nodiscard]] constexpr bool IsOverAge(unsigned int currentFrame, unsigned int ageLimit) const noexcept
+    [[nodiscard]] bool IsOverAge(unsigned int currentFrame, unsigned int ageLimit) const noexcept
     {
-        return (currentFrame > mFrameStamp) && ((currentFrame - mFrameStamp) > ageLimit);
+        const unsigned int frameStamp = FrameStamp();
+        return (currentFrame > frameStamp) && ((currentFrame - frameStamp) > ageLimit);
     }
     [[nodiscard]] bool HasValidDiskBuffer() const noexcept
     {
@@ -192,6 +244,13 @@ protected:
     virtual void CreateSceneBuffer();
     virtual void CreateRendererBuffer();
 
+    // Records a page-in or page-out of the buffer size in the paging trace, if any.
+    void TracePaging(HdPagingTraceEvent event) const noexcept;
+
+    // Moves the buffer and its resident memory to another pool, nullptr for none. Not
+    // synchronized with the paging of the buffer.
+    void SetMemoryPool(HdMemoryPool* pool) noexcept;
+
     // Helper to create aligned memory span
     template <typename T = std::byte>
     [[nodiscard]] constexpr PXR_NS::TfSpan<T> MakeSpan(
@@ -208,12 +267,28 @@ protected:
     template <typename, typename, typename, typename>
 #endif
     friend class HdPageableBufferManager;
+    friend class HdBufferAccessIndex;
 
     const HdBufferUsage mUsage;
 
     size_t mSize               = 0;
     HdBufferState mBufferState = HdBufferState::Unknown;
-    unsigned int mFrameStamp   = 0; // Frame stamp for age tracking
+    // Frame stamp for age tracking, changed under the access index lock while linked to one
+    std::atomic<unsigned int> mFrameStamp { 0 };
+    std::atomic<unsigned int> mAccessCount { 0 };
+    std::atomic<bool> mPrefetched { false };
+
+    // Links of the access index ordering the buffers by frame stamp, guarded by the index
+    std::atomic<HdBufferAccessIndex*> mAccessIndex { nullptr };
+    HdPageableBufferCore* mAccessPrev = nullptr;
+    HdPageableBufferCore* mAccessNext = nullptr;
+    std::weak_ptr<HdPageableBufferCore> mAccessHandle;
+
+    // Paging trace of the buffer manager, set when the buffer is added to it
+    std::atomic<HdPagingTraceRecorder*> mTraceRecorder { nullptr };
+
+    // Memory pool of the buffer manager, owned by its memory monitor
+    std::atomic<HdMemoryPool*> mMemoryPool { nullptr };
 
     // Page handle for disk storage
     std::unique_ptr<HdBufferPageEntry> mPageEntry;
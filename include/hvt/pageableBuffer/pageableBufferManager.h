@@ -15,10 +15,13 @@
 
 #include <hvt/api.h>
 #include <hvt/pageableBuffer/pageFileManager.h>
+#include <hvt/pageableBuffer/pageableAccessIndex.h>
 #include <hvt/pageableBuffer/pageableBuffer.h>
 #include <hvt/pageableBuffer/pageableConcepts.h>
 #include <hvt/pageableBuffer/pageableMemoryMonitor.h>
 #include <hvt/pageableBuffer/pageableStrategies.h>
+#include <hvt/pageableBuffer/pageableTaskQueue.h>
+#include <hvt/pageableBuffer/pageableTrace.h>
 
 #include <pxr/pxr.h>
 #include <pxr/base/tf/callContext.h>
@@ -26,13 +29,20 @@
 #include <pxr/usd/sdf/path.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <queue>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 #if defined(__GNUC__)
@@ -58,6 +68,30 @@ namespace HVT_NS
 
 class HdPageableBufferCore;
 
+/// Prefix matching of the keys of the memory pools: an SdfPath has the prefixes of its subtree,
+/// a string the ones it starts with, and other keys only match themselves.
+template <typename KeyType>
+struct HdKeyPrefix
+{
+    static bool HasPrefix(const KeyType& key, const KeyType& prefix) { return key == prefix; }
+};
+template <>
+struct HdKeyPrefix<PXR_NS::SdfPath>
+{
+    static bool HasPrefix(const PXR_NS::SdfPath& key, const PXR_NS::SdfPath& prefix)
+    {
+        return key.HasPrefix(prefix);
+    }
+};
+template <>
+struct HdKeyPrefix<std::string>
+{
+    static bool HasPrefix(const std::string& key, const std::string& prefix)
+    {
+        return key.compare(0, prefix.size(), prefix) == 0;
+    }
+};
+
 template <
 #if defined(ENABLE_PAGING_CONCEPTS)
     HdPagingConcepts::PagingStrategyLike PagingStrategyType,
@@ -90,24 +124,52 @@ public:
     {
         std::filesystem::path pageFileDirectory =
             std::filesystem::temp_directory_path() / "hvt_temp_pages";
-        int ageLimit               = 20; ///< frame count
-        size_t sceneMemoryLimit    = static_cast<size_t>(2) * ONE_GiB;
-        size_t rendererMemoryLimit = static_cast<size_t>(1) * ONE_GiB;
-        unsigned int numThreads    = 0; ///< 0 means disable async operations
+        int ageLimit                    = 20; ///< frame count
+        size_t sceneMemoryLimit         = static_cast<size_t>(2) * ONE_GiB;
+        size_t rendererMemoryLimit      = static_cast<size_t>(1) * ONE_GiB;
+        unsigned int numThreads         = 0; ///< 0 means disable async operations
+        HdPageFileIOMode pageFileIOMode = HdPageFileIOMode::Positional;
+        bool pageDeduplication          = false; ///< Share the disk space of identical pages
+        bool persistentPageCache        = false; ///< Keep the page files for later sessions
+        HdPageIOConfig pageIO;                   ///< Page I/O engine of the async operations
+        std::vector<HdPageStorageTier> storageTiers; ///< Fastest first, replaces pageFileDirectory
+        std::filesystem::path tracePath; ///< Records a paging trace from the start when set
+        /// Derives the scene memory limit from the system memory, nullptr = sceneMemoryLimit.
+        std::shared_ptr<IHdSystemMemoryProbe> systemMemoryProbe;
+        HdSystemMemoryBudget systemMemoryBudget;
+        /// Paging I/O per frame of the crawls and implicit page-ins, unlimited by default.
+        HdFrameIOBudgetConfig frameIOBudget;
     };
     // Constructor and destructor are now public for direct instantiation
     HdPageableBufferManager(InitializeDesc desc) :
         mAgeLimit(desc.ageLimit),
-        mPageFileManager(
-            std::unique_ptr<HdPageFileManager>(new HdPageFileManager(desc.pageFileDirectory))),
+        mPageFileManager(std::unique_ptr<HdPageFileManager>(
+            new HdPageFileManager(desc.pageFileDirectory, desc.pageFileIOMode,
+                desc.pageDeduplication, desc.persistentPageCache, desc.pageIO,
+                std::move(desc.storageTiers)))),
         mMemoryMonitor(std::unique_ptr<HdMemoryMonitor>(
             new HdMemoryMonitor(desc.sceneMemoryLimit, desc.rendererMemoryLimit)))
     {
+        mMemoryMonitor->SetStorageTierStatsSource(
+            [pageFileManager = mPageFileManager.get()]()
+            { return pageFileManager->GetStorageTierStats(); });
+        if (desc.systemMemoryProbe)
+        {
+            mMemoryMonitor->SetSystemMemoryProbe(
+                std::move(desc.systemMemoryProbe), desc.systemMemoryBudget);
+        }
+        mMemoryMonitor->GetFrameIOBudget().SetConfig(desc.frameIOBudget);
+
         if (desc.numThreads > 0)
         {
             mTaskArena = std::make_unique<tbb::task_arena>(desc.numThreads);
             mTaskArena->execute([this]() { mTaskGroup = std::make_unique<tbb::task_group>(); });
         }
+
+        if (!desc.tracePath.empty())
+        {
+            StartTrace(desc.tracePath);
+        }
     }
 
     ~HdPageableBufferManager()
@@ -124,14 +186,25 @@ public:
             });
         }
         mTaskArena.reset();
-        mBuffers.clear();
+
+        // The destruction callbacks of the released buffers call RemoveBuffer, which must not
+        // erase from the map being cleared.
+        decltype(mBuffers) buffers;
+        buffers.swap(mBuffers);
+        buffers.clear();
     }
 
-    // Frame stamp management
-    void AdvanceFrame(unsigned int advanceCount = 1) noexcept { mCurrentFrame += advanceCount; }
+    // Frame stamp management. A new frame also renews the paging I/O budget.
+    void AdvanceFrame(unsigned int advanceCount = 1) noexcept
+    {
+        mTraceRecorder.RecordFrame(mCurrentFrame += advanceCount);
+        mMemoryMonitor->GetFrameIOBudget().BeginFrame();
+    }
     [[nodiscard]] constexpr unsigned int GetCurrentFrame() const noexcept { return mCurrentFrame; }
 
-    // Strategy access (no runtime changing allowed)
+    // Strategy access. The strategies are fixed, except the strategy held by
+    // RuntimePagingStrategy and RuntimeSelectionStrategy: the returned copy shares it, and Set on
+    // it takes effect on the next crawl.
     [[nodiscard]] constexpr PagingStrategyType GetPagingStrategy() const noexcept
     {
         return mPagingStrategy;
@@ -148,6 +221,22 @@ public:
         return mPageFileManager;
     }
     [[nodiscard]] std::unique_ptr<HdMemoryMonitor>& GetMemoryMonitor() { return mMemoryMonitor; }
+    [[nodiscard]] const HdBufferAccessIndex& GetAccessIndex() const { return mAccessIndex; }
+
+    // Paging trace: records the buffer accesses, page-ins, page-outs, frames and crawls into a
+    // compact binary trace for offline replay (see HdPagingTraceRecorder). Replaces the trace
+    // being recorded, if any.
+    bool StartTrace(const std::filesystem::path& path)
+    {
+        HdPagingTraceHeader header;
+        header.sceneMemoryLimit    = mMemoryMonitor->GetSceneMemoryLimit();
+        header.rendererMemoryLimit = mMemoryMonitor->GetRendererMemoryLimit();
+        header.ageLimit            = static_cast<int>(mAgeLimit);
+        header.startFrame          = mCurrentFrame;
+        return mTraceRecorder.Start(path, header);
+    }
+    void StopTrace() { mTraceRecorder.Stop(); }
+    [[nodiscard]] HdPagingTraceRecorder& GetTraceRecorder() { return mTraceRecorder; }
 
     // Buffer operations //////////////////////////////////////////////////////
 
@@ -157,47 +246,124 @@ public:
     bool AddBuffer(const KeyType& key, std::shared_ptr<HdPageableBufferCore> buffer);
     void RemoveBuffer(const KeyType& key);
     [[nodiscard]] std::shared_ptr<HdPageableBufferCore> FindBuffer(const KeyType& key);
+    // The buffers whose key matches the predicate, e.g. the ones under a prefix. Visits all
+    // the buffers.
+    template <typename Predicate>
+    [[nodiscard]] std::vector<std::pair<KeyType, std::shared_ptr<HdPageableBufferCore>>>
+    FindBuffers(Predicate&& predicate) const;
 
     // Paging trigger
+    // Selection strategies which accept the access index (LRU, OldestFirst) only visit the
+    // buffers they select; the others are given all buffers.
     static constexpr size_t kMinimalCheckCount = 10;
+    static constexpr bool kIndexedSelection =
+        std::is_invocable_r_v<std::vector<std::shared_ptr<HdPageableBufferCore>>,
+            const BufferSelectionStrategyType&, const HdBufferAccessIndex&,
+            const HdSelectionContext&>;
+    // Paging strategies which can also decide for all the buffers of a crawl at once
+    // (RuntimePagingStrategy) are called once per crawl.
+    static constexpr bool kBatchDecisions =
+        std::is_invocable_r_v<std::vector<HdPagingDecision>, const PagingStrategyType&,
+            const std::vector<std::shared_ptr<HdPageableBufferCore>>&, unsigned int,
+            const HdPagingContext&>;
     void FreeCrawl(float percentage = 10.0f);
+    // Pages scene memory out, in the order of the buffer selection strategy, until about bytes
+    // are freed, whatever the pressure (see HdPressureController). Dynamic buffers and buffers
+    // under the age limit are kept. With a pool, only the buffers of the pool are paged out and
+    // the age limit does not apply: the budget of a pool is a cap. Returns the memory freed.
+    size_t FreeSceneMemory(size_t bytes, const HdMemoryPool* pool = nullptr);
+
+    // Memory pools (see HdMemoryPool). The buffers whose key has the prefix, added before or
+    // after, are accounted in the pool, the most specific prefix winning; nullptr removes the
+    // prefix. The crawls first page out the pools over their scene budget, deepest first,
+    // whatever the global pressure.
+    HdMemoryPool* CreateMemoryPool(
+        const std::string& name, size_t sceneBudget = 0, HdMemoryPool* parent = nullptr)
+    {
+        return mMemoryMonitor->CreatePool(name, sceneBudget, parent);
+    }
+    void AssignMemoryPool(const KeyType& prefix, HdMemoryPool* pool);
+    [[nodiscard]] HdMemoryPool* FindMemoryPool(const KeyType& key) const;
+    [[nodiscard]] std::vector<HdMemoryPoolStats> GetMemoryPoolStats() const
+    {
+        return mMemoryMonitor->GetPoolStats();
+    }
 
     // Async buffer operations
-    [[nodiscard]] std::future<bool> PageToSceneMemoryAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false);
-    [[nodiscard]] std::future<bool> PageToRendererMemoryAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false);
-    [[nodiscard]] std::future<bool> PageToDiskAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false);
-
-    [[nodiscard]] std::future<bool> SwapSceneToDiskAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false);
-    [[nodiscard]] std::future<bool> SwapRendererToDiskAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false);
-    [[nodiscard]] std::future<bool> SwapToSceneMemoryAsync(
+    // Page-ins to scene memory and scene / renderer page-outs read and write their pages on the
+    // page I/O engine; the task arena only runs the serialization and the buffer updates.
+    // Operations start in priority order (HdPagingTaskOptions::priority): the page-ins are
+    // OnDemand and the page-outs and releases Eviction by default. A cancelled operation does
+    // nothing and reports HdPagingResult::Status::Cancelled; a scene or renderer page-out is
+    // also cancelled when its buffer is accessed (UpdateFrameStamp) before it starts.
+    [[nodiscard]] HdPagingFuture PageToSceneMemoryAsync(
+        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false,
+        const HdPagingTaskOptions& options = {});
+    [[nodiscard]] HdPagingFuture PageToRendererMemoryAsync(
+        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false,
+        const HdPagingTaskOptions& options = {});
+    [[nodiscard]] HdPagingFuture PageToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer,
+        bool force = false, const HdPagingTaskOptions& options = {});
+
+    [[nodiscard]] HdPagingFuture SwapSceneToDiskAsync(
+        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false,
+        const HdPagingTaskOptions& options = {});
+    [[nodiscard]] HdPagingFuture SwapRendererToDiskAsync(
+        std::shared_ptr<HdPageableBufferCore> buffer, bool force = false,
+        const HdPagingTaskOptions& options = {});
+    [[nodiscard]] HdPagingFuture SwapToSceneMemoryAsync(
         std::shared_ptr<HdPageableBufferCore> buffer, bool force = false,
         HdBufferState releaseBuffer = static_cast<HdBufferState>(
             static_cast<int>(HdBufferState::RendererBuffer) |
-            static_cast<int>(HdBufferState::DiskBuffer)));
-    [[nodiscard]] std::future<bool> SwapToRendererMemoryAsync(
+            static_cast<int>(HdBufferState::DiskBuffer)),
+        const HdPagingTaskOptions& options = {});
+    [[nodiscard]] HdPagingFuture SwapToRendererMemoryAsync(
         std::shared_ptr<HdPageableBufferCore> buffer, bool force = false,
         HdBufferState releaseBuffer = static_cast<HdBufferState>(
             static_cast<int>(HdBufferState::SceneBuffer) |
-            static_cast<int>(HdBufferState::DiskBuffer)));
+            static_cast<int>(HdBufferState::DiskBuffer)),
+        const HdPagingTaskOptions& options = {});
 
     [[nodiscard]] std::future<void> ReleaseSceneBufferAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer) noexcept;
+        std::shared_ptr<HdPageableBufferCore> buffer,
+        const HdPagingTaskOptions& options = {}) noexcept;
     [[nodiscard]] std::future<void> ReleaseRendererBufferAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer) noexcept;
+        std::shared_ptr<HdPageableBufferCore> buffer,
+        const HdPagingTaskOptions& options = {}) noexcept;
     [[nodiscard]] std::future<void> ReleaseDiskPageAsync(
-        std::shared_ptr<HdPageableBufferCore> buffer) noexcept;
-
-    // Async paging trigger.
-    std::vector<std::future<bool>> FreeCrawlAsync(float percentage = 10.0f);
-
-    // Async operation status
+        std::shared_ptr<HdPageableBufferCore> buffer,
+        const HdPagingTaskOptions& options = {}) noexcept;
+
+    // Async paging trigger. The page-outs have the Eviction priority, the page-ins decided by
+    // the paging strategy Prefetch.
+    std::vector<HdPagingFuture> FreeCrawlAsync(float percentage = 10.0f);
+
+    // Page file compaction: relocates up to ioBudget bytes of live pages out of sparse page
+    // files, then deletes emptied files and truncates free tails. Call repeatedly while the
+    // result is pending. The async version runs on the task arena like the paging operations,
+    // with the Background priority.
+    HdPageFileCompactionResult CompactPageFiles(
+        size_t ioBudget = HdPageFileManager::DEFAULT_COMPACTION_BUDGET);
+    [[nodiscard]] std::future<HdPageFileCompactionResult> CompactPageFilesAsync(
+        size_t ioBudget = HdPageFileManager::DEFAULT_COMPACTION_BUDGET);
+
+    // Tiered page storage: moves up to ioBudget bytes of pages not accessed for minAge to the
+    // next slower tier. Call repeatedly while the result is pending.
+    HdPageFileCompactionResult MigrateColdPages(
+        size_t ioBudget = HdPageFileManager::DEFAULT_COMPACTION_BUDGET,
+        std::chrono::milliseconds minAge = HdPageFileManager::DEFAULT_COLD_PAGE_AGE);
+    [[nodiscard]] std::future<HdPageFileCompactionResult> MigrateColdPagesAsync(
+        size_t ioBudget = HdPageFileManager::DEFAULT_COMPACTION_BUDGET,
+        std::chrono::milliseconds minAge = HdPageFileManager::DEFAULT_COLD_PAGE_AGE);
+
+    // Async operation status. The operations submitted and not completed, in total or of a
+    // priority.
     size_t GetPendingOperations() const;
+    size_t GetPendingOperations(HdPagingPriority priority) const;
     void WaitForAllOperations();
+    // False without async threads (InitializeDesc::numThreads): the async operations then
+    // return invalid futures.
+    [[nodiscard]] bool IsAsyncEnabled() const noexcept { return mTaskArena && mTaskGroup; }
 
     // Statistics
     // NOTE: These APIs may severely slow down the system and should be used for development only.
@@ -214,37 +380,111 @@ private:
     // HdPageableBufferCore destruction callback
     void OnBufferDestroyed(const KeyType& key);
 
+    // Buffers to check in a crawl, chosen by the buffer selection strategy.
+    std::vector<std::shared_ptr<HdPageableBufferCore>> SelectBuffers(float percentage);
+    std::vector<std::shared_ptr<HdPageableBufferCore>> SelectBufferCount(size_t count);
+
+    // Appends the scene page-outs of FreeSceneMemory to the lists, skipping the buffers already
+    // in them. Returns the bytes planned.
+    size_t PlanSceneEvictions(size_t bytes, const HdMemoryPool* pool,
+        std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        std::vector<HdPagingDecision>& decisions);
+    // Plans the page-outs bringing the pools back under their budgets.
+    void PlanPoolEvictions(std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        std::vector<HdPagingDecision>& decisions);
+    // Caller holds mPoolPrefixMutex.
+    HdMemoryPool* FindMemoryPoolLocked(const KeyType& key) const;
+
     // Helper method: dispose old buffer using configurable strategy
     bool DisposeOldBuffer(HdPageableBufferCore& buffer, unsigned int currentFrame, unsigned int ageLimit,
         float scenePressure, float rendererPressure);
+    HdPagingDecision MakePagingDecision(HdPageableBufferCore& buffer, unsigned int currentFrame,
+        unsigned int ageLimit, float scenePressure, float rendererPressure);
+    std::vector<HdPagingDecision> MakePagingDecisions(
+        const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers, float scenePressure,
+        float rendererPressure);
+
+    // Page-outs selected by a crawl are written with one batched write (sequential I/O).
+    // Buffers which cannot be batched are paged out individually. The page-outs beyond the
+    // frame I/O budget are left to a later crawl. Returns one result per buffer.
+    static constexpr bool IsPageOutDecision(const HdPagingDecision& decision) noexcept
+    {
+        return decision.shouldPage &&
+            (decision.action == HdPagingDecision::Action::SwapSceneToDisk ||
+                decision.action == HdPagingDecision::Action::SwapRendererToDisk);
+    }
+    std::vector<bool> ExecutePageOutBatch(
+        const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        const std::vector<HdPagingDecision>& decisions);
+    std::vector<bool> WritePageOutBatch(
+        const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        const std::vector<HdPagingDecision>& decisions);
+    // Returns the pages to write, `batched` holds their buffer indices. The other buffers are
+    // paged out right away and their `results` set.
+    std::vector<PXR_NS::TfSpan<const std::byte>> PreparePageOutBatch(
+        const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        const std::vector<HdPagingDecision>& decisions, std::vector<bool>& results,
+        std::vector<size_t>& batched);
+
+    // Asynchronous page-outs and page-ins: prepared on the task arena, read or written on the
+    // page I/O engine, completed on the task arena. Buffers which cannot use the engine take
+    // the synchronous path in their task.
+    std::vector<HdPagingFuture> PageOutAsync(
+        std::vector<std::shared_ptr<HdPageableBufferCore>> buffers,
+        std::vector<HdPagingDecision> decisions, const HdPagingTaskOptions& options);
+    HdPagingFuture PageInAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
+        bool swap, HdBufferState releaseBuffer, const HdPagingTaskOptions& options);
 
     // Execute paging decision on buffer (synchronous)
     bool ExecutePagingDecision(HdPageableBufferCore& buffer, const HdPagingDecision& decision);
 
     // Execute paging decision on buffer (asynchronous)
-    std::future<bool> ExecutePagingDecisionAsync(
+    HdPagingFuture ExecutePagingDecisionAsync(
         std::shared_ptr<HdPageableBufferCore> buffer, const HdPagingDecision& decision);
 
-    // Helper method for creating tasks with trackable future
+    // Helper method for creating tasks with trackable future. A cancelled task returns
+    // HdPagingResult::Cancelled() or a default result.
     template <typename Callable>
-    std::future<std::invoke_result_t<Callable>> SubmitTask(Callable&& task);
-
+    std::future<std::invoke_result_t<Callable>> SubmitTask(
+        HdPagingPriority priority, const HdPagingTaskOptions& options, Callable&& task);
+
+    // Queues the first step of an operation and a task running the most urgent queued step.
+    // BeginOperation and EndOperation count the operation from its submission to its end.
+    void Schedule(HdPagingPriority priority, HdPagingTaskQueue::Step step);
+    void BeginOperation(HdPagingPriority priority) noexcept;
+    void EndOperation(HdPagingPriority priority) noexcept;
+
+    // Declared first: they outlive the buffers released with mBuffers.
+    HdPagingTraceRecorder mTraceRecorder;
+    HdBufferAccessIndex mAccessIndex;
     tbb::concurrent_unordered_map<KeyType, std::shared_ptr<HdPageableBufferCore>, KeyHash> mBuffers;
 
     std::atomic<unsigned int> mCurrentFrame { 0 };
     unsigned int mAgeLimit { 20 };
 
-    // Compile-time strategy instances (no runtime changing)
+    // Strategy instances, copied out by GetPagingStrategy and GetBufferSelectionStrategy. With
+    // the runtime holders (RuntimePagingStrategy, RuntimeSelectionStrategy) the copies share the
+    // held strategy: a Set on one swaps it for the manager, from the next crawl on.
     PagingStrategyType mPagingStrategy {};
     BufferSelectionStrategyType mBufferSelectionStrategy {};
 
     std::unique_ptr<HdPageFileManager> mPageFileManager;
     std::unique_ptr<HdMemoryMonitor> mMemoryMonitor;
 
+    // Key prefixes of the memory pools, owned by the memory monitor
+    mutable std::shared_mutex mPoolPrefixMutex;
+    std::vector<std::pair<KeyType, HdMemoryPool*>> mPoolPrefixes;
+    std::atomic<bool> mHasPoolPrefixes { false };
+
     // Members for async buffer operations
+    HdPagingTaskQueue mTaskQueue;
     std::unique_ptr<tbb::task_arena> mTaskArena;
     std::unique_ptr<tbb::task_group> mTaskGroup;
     std::atomic<size_t> mPendingTaskCount { 0 };
+    std::array<std::atomic<size_t>, HD_PAGING_PRIORITY_COUNT> mPendingPriorityCounts {};
+    // Notified when a step is scheduled or the last pending operation ends
+    std::mutex mOperationsMutex;
+    std::condition_variable mOperationsChanged;
 };
 
 // Template Methods Implementations ///////////////////////////////////////////
@@ -271,7 +511,15 @@ std::shared_ptr<HdPageableBufferBase<KeyType>> HdPageableBufferManager<PagingStr
     auto buffer =
         std::shared_ptr<HdPageableBufferBase<KeyType>>(new HdPageableBufferBase<KeyType>(key, size,
             usage, this->mPageFileManager, this->mMemoryMonitor, std::move(destructionCallback)));
-    mBuffers.emplace(key, buffer);
+    buffer->mTraceRecorder = &mTraceRecorder;
+    if (mBuffers.emplace(key, buffer).second)
+    {
+        mAccessIndex.Insert(buffer);
+        if (mHasPoolPrefixes)
+        {
+            buffer->SetMemoryPool(FindMemoryPool(key));
+        }
+    }
     return buffer;
 }
 
@@ -280,7 +528,17 @@ template <typename PagingStrategyType, typename BufferSelectionStrategyType, typ
 bool HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
     KeyHash>::AddBuffer(const KeyType& key, std::shared_ptr<HdPageableBufferCore> buffer)
 {
-    return mBuffers.emplace(key, std::move(buffer)).second;
+    if (!buffer || !mBuffers.emplace(key, buffer).second)
+    {
+        return false;
+    }
+    mAccessIndex.Insert(buffer);
+    buffer->mTraceRecorder = &mTraceRecorder;
+    if (mHasPoolPrefixes)
+    {
+        buffer->SetMemoryPool(FindMemoryPool(key));
+    }
+    return true;
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
@@ -298,10 +556,78 @@ void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, Ke
 {
     if (auto it = mBuffers.find(key); it != mBuffers.end())
     {
+        if (it->second)
+        {
+            mAccessIndex.Remove(*it->second);
+            mTraceRecorder.RecordRemove(*it->second);
+            it->second->mTraceRecorder = nullptr;
+            it->second->SetMemoryPool(nullptr);
+        }
         mBuffers.unsafe_erase(it);
     }
 }
 
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::AssignMemoryPool(const KeyType& prefix, HdMemoryPool* pool)
+{
+    std::unique_lock<std::shared_mutex> lock(mPoolPrefixMutex);
+    const auto it = std::find_if(mPoolPrefixes.begin(), mPoolPrefixes.end(),
+        [&prefix](const auto& entry) { return entry.first == prefix; });
+    if (it != mPoolPrefixes.end())
+    {
+        if (pool)
+        {
+            it->second = pool;
+        }
+        else
+        {
+            mPoolPrefixes.erase(it);
+        }
+    }
+    else if (pool)
+    {
+        mPoolPrefixes.emplace_back(prefix, pool);
+    }
+    mHasPoolPrefixes = !mPoolPrefixes.empty();
+
+    // The buffers under the prefix move to their most specific pool.
+    for (const auto& [key, buffer] : mBuffers)
+    {
+        if (buffer && HdKeyPrefix<KeyType>::HasPrefix(key, prefix))
+        {
+            buffer->SetMemoryPool(FindMemoryPoolLocked(key));
+        }
+    }
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdMemoryPool* HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::FindMemoryPool(const KeyType& key) const
+{
+    std::shared_lock<std::shared_mutex> lock(mPoolPrefixMutex);
+    return FindMemoryPoolLocked(key);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdMemoryPool* HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::FindMemoryPoolLocked(const KeyType& key) const
+{
+    const std::pair<KeyType, HdMemoryPool*>* best = nullptr;
+    for (const auto& entry : mPoolPrefixes)
+    {
+        if (HdKeyPrefix<KeyType>::HasPrefix(key, entry.first) &&
+            (!best || HdKeyPrefix<KeyType>::HasPrefix(entry.first, best->first)))
+        {
+            best = &entry;
+        }
+    }
+    return best ? best->second : nullptr;
+}
+
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 std::shared_ptr<HdPageableBufferCore> HdPageableBufferManager<PagingStrategyType,
@@ -314,11 +640,40 @@ std::shared_ptr<HdPageableBufferCore> HdPageableBufferManager<PagingStrategyType
     return nullptr;
 }
 
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+template <typename Predicate>
+std::vector<std::pair<KeyType, std::shared_ptr<HdPageableBufferCore>>> HdPageableBufferManager<
+    PagingStrategyType, BufferSelectionStrategyType, KeyType, KeyHash>::FindBuffers(
+    Predicate&& predicate) const
+{
+    std::vector<std::pair<KeyType, std::shared_ptr<HdPageableBufferCore>>> buffers;
+    for (const auto& [key, buffer] : mBuffers)
+    {
+        if (buffer && predicate(key))
+        {
+            buffers.emplace_back(key, buffer);
+        }
+    }
+    return buffers;
+}
+
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 bool HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
     KeyHash>::DisposeOldBuffer(HdPageableBufferCore& buffer, unsigned int currentFrame, unsigned int ageLimit,
     float scenePressure, float rendererPressure)
+{
+    HdPagingDecision decision =
+        MakePagingDecision(buffer, currentFrame, ageLimit, scenePressure, rendererPressure);
+    return ExecutePagingDecision(buffer, decision);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdPagingDecision HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::MakePagingDecision(HdPageableBufferCore& buffer, unsigned int currentFrame,
+    unsigned int ageLimit, float scenePressure, float rendererPressure)
 {
     // Create paging context
     HdPagingContext context;
@@ -328,8 +683,30 @@ bool HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, Ke
     context.rendererPressure = rendererPressure;
 
     // Use configured strategy
-    HdPagingDecision decision = mPagingStrategy(buffer, context);
-    return ExecutePagingDecision(buffer, decision);
+    return mPagingStrategy(buffer, context);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<HdPagingDecision> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::MakePagingDecisions(
+    const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers, float scenePressure,
+    float rendererPressure)
+{
+    HdPagingContext context;
+    context.ageLimit         = mAgeLimit;
+    context.scenePressure    = scenePressure;
+    context.rendererPressure = rendererPressure;
+
+    if constexpr (kBatchDecisions)
+    {
+        return mPagingStrategy(buffers, mCurrentFrame, context);
+    }
+    else
+    {
+        return HdPagingStrategies::MakePagingDecisions(
+            mPagingStrategy, buffers, mCurrentFrame, context);
+    }
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
@@ -373,7 +750,289 @@ bool HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, Ke
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+std::vector<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::ExecutePageOutBatch(const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+    const std::vector<HdPagingDecision>& decisions)
+{
+    HdFrameIOBudget& budget = mMemoryMonitor->GetFrameIOBudget();
+    size_t allowed          = buffers.size();
+    if (budget.IsEnabled())
+    {
+        // The buffers are in the order of the selection strategy: the ones beyond the budget
+        // are the least urgent, and the next crawls select them again.
+        allowed = 0;
+        while (allowed < buffers.size() && budget.TryAcquire(buffers[allowed]->Size()))
+        {
+            ++allowed;
+        }
+        for (size_t i = allowed; i < buffers.size(); ++i)
+        {
+            budget.RecordDeferredPageOut(buffers[i]->Size());
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<bool> results;
+    if (allowed == buffers.size())
+    {
+        results = WritePageOutBatch(buffers, decisions);
+    }
+    else
+    {
+        results = WritePageOutBatch(
+            std::vector<std::shared_ptr<HdPageableBufferCore>>(
+                buffers.begin(), buffers.begin() + allowed),
+            std::vector<HdPagingDecision>(decisions.begin(), decisions.begin() + allowed));
+        results.resize(buffers.size(), false);
+    }
+    budget.Charge(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start));
+    return results;
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::WritePageOutBatch(const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+    const std::vector<HdPagingDecision>& decisions)
+{
+    std::vector<bool> results(buffers.size(), false);
+    std::vector<size_t> batched;
+    const auto pages = PreparePageOutBatch(buffers, decisions, results, batched);
+
+    if (!pages.empty())
+    {
+        auto pageEntries = mPageFileManager->CreatePageEntries(
+            PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>>(pages.data(), pages.size()));
+        for (size_t i = 0; i < batched.size(); ++i)
+        {
+            results[batched[i]] = buffers[batched[i]]->CompletePageOut(std::move(pageEntries[i]));
+        }
+    }
+
+    return results;
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<PXR_NS::TfSpan<const std::byte>> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::PreparePageOutBatch(
+    const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+    const std::vector<HdPagingDecision>& decisions, std::vector<bool>& results,
+    std::vector<size_t>& batched)
+{
+    std::vector<PXR_NS::TfSpan<const std::byte>> pages;
+    batched.reserve(buffers.size());
+    pages.reserve(buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        if (!decisions[i].shouldPage)
+        {
+            continue;
+        }
+        const HdBufferState source =
+            (decisions[i].action == HdPagingDecision::Action::SwapRendererToDisk)
+            ? HdBufferState::RendererBuffer
+            : HdBufferState::SceneBuffer;
+        const auto page = buffers[i]->PreparePageOut(source);
+        if (page.empty())
+        {
+            results[i] = ExecutePagingDecision(*buffers[i], decisions[i]);
+        }
+        else
+        {
+            batched.push_back(i);
+            pages.push_back(page);
+        }
+    }
+    return pages;
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<HdPagingFuture> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::PageOutAsync(
+    std::vector<std::shared_ptr<HdPageableBufferCore>> buffers,
+    std::vector<HdPagingDecision> decisions, const HdPagingTaskOptions& options)
+{
+    std::vector<HdPagingFuture> futures(buffers.size());
+    if (!mTaskArena || !mTaskGroup)
+    {
+        // Return invalid futures
+        return futures;
+    }
+
+    // State shared by the steps of the operation. The task count covers the whole operation and
+    // is decremented last, `this` is not used after that. The buffers are released before, as
+    // their destruction calls back into the manager.
+    // The access counts taken at submission tell which buffers were accessed since.
+    struct PageOutState
+    {
+        std::vector<std::shared_ptr<HdPageableBufferCore>> buffers;
+        std::vector<HdPagingDecision> decisions;
+        std::vector<unsigned int> accessCounts;
+        std::vector<std::promise<HdPagingResult>> promises;
+        std::vector<bool> results;
+        std::vector<bool> cancelled;
+        std::vector<size_t> batched;
+        std::vector<std::unique_ptr<HdBufferPageEntry>> pageEntries;
+        HdPagingTaskOptions options;
+        HdPagingPriority priority = HdPagingPriority::Eviction;
+    };
+    auto state       = std::make_shared<PageOutState>();
+    state->buffers   = std::move(buffers);
+    state->decisions = std::move(decisions);
+    state->options   = options;
+    state->priority  = options.GetPriority(HdPagingPriority::Eviction);
+    state->promises.resize(state->buffers.size());
+    state->results.resize(state->buffers.size(), false);
+    state->cancelled.resize(state->buffers.size(), false);
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        futures[i] = state->promises[i].get_future();
+        state->accessCounts.push_back(state->buffers[i] ? state->buffers[i]->AccessCount() : 0);
+    }
+
+    auto finish = [this, state]()
+    {
+        state->buffers.clear();
+        EndOperation(state->priority);
+        for (size_t i = 0; i < state->results.size(); ++i)
+        {
+            state->promises[i].set_value(state->cancelled[i]
+                    ? HdPagingResult::Cancelled()
+                    : HdPagingResult(state->results[i]));
+        }
+    };
+    auto complete = [state, finish]()
+    {
+        for (size_t i = 0; i < state->batched.size(); ++i)
+        {
+            const size_t index    = state->batched[i];
+            state->results[index] =
+                state->buffers[index]->CompletePageOut(std::move(state->pageEntries[i]));
+        }
+        finish();
+    };
+    auto prepare = [this, state, finish, complete]()
+    {
+        // The page-outs cancelled, or of buffers accessed since their submission, are skipped.
+        const bool cancelled = state->options.IsCancelled();
+        for (size_t i = 0; i < state->buffers.size(); ++i)
+        {
+            if (cancelled || state->buffers[i]->AccessCount() != state->accessCounts[i])
+            {
+                state->cancelled[i]           = true;
+                state->decisions[i].shouldPage = false;
+            }
+        }
+
+        const auto pages =
+            PreparePageOutBatch(state->buffers, state->decisions, state->results, state->batched);
+        if (pages.empty())
+        {
+            finish();
+            return;
+        }
+
+        // The pages stay valid until CompletePageOut, the buffers own them. The buffer updates
+        // go back to the task arena, the I/O thread never blocks on it.
+        mPageFileManager->CreatePageEntriesAsync(
+            PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>>(pages.data(), pages.size()),
+            [this, state, complete](std::vector<std::unique_ptr<HdBufferPageEntry>> pageEntries)
+            {
+                state->pageEntries = std::move(pageEntries);
+                Schedule(state->priority, complete);
+            });
+    };
+
+    BeginOperation(state->priority);
+    Schedule(state->priority, std::move(prepare));
+
+    return futures;
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::PageInAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force, bool swap,
+    HdBufferState releaseBuffer, const HdPagingTaskOptions& options)
+{
+    if (!mTaskArena || !mTaskGroup)
+    {
+        // Return an invalid future
+        return {};
+    }
+
+    // Same task count and buffer lifetime rules as PageOutAsync.
+    struct PageInState
+    {
+        std::shared_ptr<HdPageableBufferCore> buffer;
+        std::promise<HdPagingResult> promise;
+        std::vector<std::byte> page;
+        bool read = false;
+        HdPagingTaskOptions options;
+        HdPagingPriority priority = HdPagingPriority::OnDemand;
+    };
+    auto state      = std::make_shared<PageInState>();
+    state->buffer   = std::move(buffer);
+    state->options  = options;
+    state->priority = options.GetPriority(HdPagingPriority::OnDemand);
+    auto future     = state->promise.get_future();
+
+    auto end = [this, state](HdPagingResult result)
+    {
+        state->buffer.reset();
+        state->page = {};
+        EndOperation(state->priority);
+        state->promise.set_value(result);
+    };
+    auto finish = [state, end, force, swap, releaseBuffer](bool result)
+    {
+        if (!result)
+        {
+            // Not read asynchronously, or the read failed.
+            result = swap ? state->buffer->SwapToSceneMemory(force, releaseBuffer)
+                          : state->buffer->PageToSceneMemory(force);
+        }
+        end(result);
+    };
+    auto complete = [state, finish, releaseBuffer]()
+    { finish(state->read && state->buffer->CompletePageIn(state->page, releaseBuffer)); };
+    auto prepare = [this, state, end, finish, complete]()
+    {
+        if (state->options.IsCancelled())
+        {
+            end(HdPagingResult::Cancelled());
+            return;
+        }
+
+        const HdBufferPageEntry* pageEntry = state->buffer->PreparePageIn();
+        if (!pageEntry)
+        {
+            finish(false);
+            return;
+        }
+
+        // The buffer update goes back to the task arena, the I/O thread never blocks on it.
+        state->page.resize(pageEntry->Size());
+        mPageFileManager->LoadPageAsync(*pageEntry, state->page,
+            [this, state, complete](bool success)
+            {
+                state->read = success;
+                Schedule(state->priority, complete);
+            });
+    };
+
+    BeginOperation(state->priority);
+    Schedule(state->priority, std::move(prepare));
+
+    return future;
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
     KeyHash>::ExecutePagingDecisionAsync(std::shared_ptr<HdPageableBufferCore> buffer,
     const HdPagingDecision& decision)
 {
@@ -385,11 +1044,15 @@ std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStr
     if (!decision.shouldPage)
     {
         // Return a future that immediately resolves to false
-        std::promise<bool> promise;
+        std::promise<HdPagingResult> promise;
         promise.set_value(false);
         return promise.get_future();
     }
 
+    // The page-ins decided by the paging strategy anticipate the accesses.
+    HdPagingTaskOptions prefetch;
+    prefetch.priority = HdPagingPriority::Prefetch;
+
     switch (decision.action)
     {
     case HdPagingDecision::Action::SwapSceneToDisk:
@@ -399,11 +1062,14 @@ std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStr
         return SwapRendererToDiskAsync(buffer, decision.forceOperation);
 
     case HdPagingDecision::Action::SwapToSceneMemory:
-        return SwapToSceneMemoryAsync(buffer, decision.forceOperation);
+        return PageInAsync(std::move(buffer), decision.forceOperation, true,
+            static_cast<HdBufferState>(static_cast<int>(HdBufferState::RendererBuffer) |
+                static_cast<int>(HdBufferState::DiskBuffer)),
+            prefetch);
 
     case HdPagingDecision::Action::ReleaseRendererBuffer:
-        return SubmitTask(
-            [buffer]() -> bool
+        return SubmitTask(HdPagingPriority::Eviction, {},
+            [buffer]() -> HdPagingResult
             {
                 buffer->ReleaseRendererBuffer();
                 return true;
@@ -412,17 +1078,63 @@ std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStr
     case HdPagingDecision::Action::None:
     default:
         // Return a future that immediately resolves to false
-        std::promise<bool> promise;
+        std::promise<HdPagingResult> promise;
         promise.set_value(false);
         return promise.get_future();
     }
 }
 
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<std::shared_ptr<HdPageableBufferCore>> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::SelectBuffers(float percentage)
+{
+    // Calculate number of buffers to check
+    const size_t bufferCount = mBuffers.size();
+    auto numToCheck          = static_cast<size_t>(bufferCount * (percentage / 100.0f));
+    numToCheck               = std::max(numToCheck, kMinimalCheckCount);
+    return SelectBufferCount(numToCheck);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<std::shared_ptr<HdPageableBufferCore>> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::SelectBufferCount(size_t count)
+{
+    // Create selection context
+    HdSelectionContext selectionContext;
+    selectionContext.currentFrame   = mCurrentFrame;
+    selectionContext.requestedCount = std::min(count, mBuffers.size());
+
+    // Use configurable buffer selection strategy. AddBuffer rejects null buffers, the map has
+    // none to skip.
+    if constexpr (kIndexedSelection)
+    {
+        return mBufferSelectionStrategy(mAccessIndex, selectionContext);
+    }
+    else
+    {
+        return mBufferSelectionStrategy(mBuffers.begin(), mBuffers.end(), selectionContext);
+    }
+}
+
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
     KeyHash>::FreeCrawl(float percentage)
 {
+    mTraceRecorder.RecordCrawl(percentage);
+    mMemoryMonitor->RefreshSystemMemory();
+
+    // The pools over their budget are paged out first.
+    std::vector<std::shared_ptr<HdPageableBufferCore>> poolBuffers;
+    std::vector<HdPagingDecision> poolDecisions;
+    PlanPoolEvictions(poolBuffers, poolDecisions);
+    if (!poolBuffers.empty())
+    {
+        ExecutePageOutBatch(poolBuffers, poolDecisions);
+    }
+
     float scenePressure    = mMemoryMonitor->GetSceneMemoryPressure();
     float rendererPressure = mMemoryMonitor->GetRendererMemoryPressure();
 
@@ -433,117 +1145,221 @@ void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, Ke
         return;
     }
 
-    // Calculate number of non-null buffers to check
-    auto numToCheck = static_cast<size_t>(mBuffers.size() * (percentage / 100.0f));
-    numToCheck      = std::max(numToCheck, kMinimalCheckCount);
-    numToCheck      = std::min(numToCheck, mBuffers.size());
+    std::vector<std::shared_ptr<HdPageableBufferCore>> selectedBuffers = SelectBuffers(percentage);
+    selectedBuffers.erase(
+        std::remove(selectedBuffers.begin(), selectedBuffers.end(), nullptr), selectedBuffers.end());
+    const std::vector<HdPagingDecision> decisions =
+        MakePagingDecisions(selectedBuffers, scenePressure, rendererPressure);
 
-    for (auto it = mBuffers.begin(); it != mBuffers.end();)
+    // Page-outs are collected and written together, everything else is executed right away.
+    std::vector<std::shared_ptr<HdPageableBufferCore>> pageOutBuffers;
+    std::vector<HdPagingDecision> pageOutDecisions;
+    for (size_t i = 0; i < selectedBuffers.size(); ++i)
     {
-        if (!it->second)
+        if (IsPageOutDecision(decisions[i]))
         {
-            it = mBuffers.unsafe_erase(it);
+            pageOutBuffers.push_back(selectedBuffers[i]);
+            pageOutDecisions.push_back(decisions[i]);
         }
         else
         {
-            ++it;
+            ExecutePagingDecision(*selectedBuffers[i], decisions[i]);
         }
     }
 
-    // Create selection context
-    HdSelectionContext selectionContext;
-    selectionContext.currentFrame   = mCurrentFrame;
-    selectionContext.requestedCount = numToCheck;
+    if (!pageOutBuffers.empty())
+    {
+        ExecutePageOutBatch(pageOutBuffers, pageOutDecisions);
+    }
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+size_t HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::FreeSceneMemory(size_t bytes, const HdMemoryPool* pool)
+{
+    std::vector<std::shared_ptr<HdPageableBufferCore>> pageOutBuffers;
+    std::vector<HdPagingDecision> pageOutDecisions;
+    if (PlanSceneEvictions(bytes, pool, pageOutBuffers, pageOutDecisions) == 0)
+    {
+        return 0;
+    }
+
+    const size_t usedBefore =
+        pool ? pool->GetUsedSceneMemory() : mMemoryMonitor->GetUsedSceneMemory();
+    ExecutePageOutBatch(pageOutBuffers, pageOutDecisions);
+    const size_t usedAfter =
+        pool ? pool->GetUsedSceneMemory() : mMemoryMonitor->GetUsedSceneMemory();
+    return usedBefore > usedAfter ? usedBefore - usedAfter : 0;
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+size_t HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::PlanSceneEvictions(size_t bytes, const HdMemoryPool* pool,
+    std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+    std::vector<HdPagingDecision>& decisions)
+{
+    const size_t bufferCount = mBuffers.size();
+    const size_t used = pool ? pool->GetUsedSceneMemory() : mMemoryMonitor->GetUsedSceneMemory();
+    if (bytes == 0 || bufferCount == 0 || used == 0)
+    {
+        return 0;
+    }
 
-    // Use configurable buffer selection strategy
-    std::vector<std::shared_ptr<HdPageableBufferCore>> selectedBuffers =
-        mBufferSelectionStrategy(mBuffers.begin(), mBuffers.end(), selectionContext);
+    // Twice the buffers of the average size needed, as some of them hold no scene memory. The
+    // buffers of a pool are found among all of them.
+    const size_t averageSize = std::max<size_t>(used / bufferCount, 1);
+    const size_t count       = pool ? bufferCount
+                                    : std::max(2 * (bytes / averageSize + 1), kMinimalCheckCount);
+
+    const std::unordered_set<const HdPageableBufferCore*> planned = [&buffers]()
+    {
+        std::unordered_set<const HdPageableBufferCore*> set;
+        for (const auto& buffer : buffers)
+        {
+            set.insert(buffer.get());
+        }
+        return set;
+    }();
 
-    for (auto& buffer : selectedBuffers)
+    size_t plannedBytes             = 0;
+    const unsigned int currentFrame = mCurrentFrame;
+    for (auto& buffer : SelectBufferCount(count))
     {
-        if (buffer)
+        if (!buffer || !buffer->HasSceneBuffer() || buffer->Usage() == HdBufferUsage::Dynamic ||
+            planned.count(buffer.get()) > 0)
+        {
+            continue;
+        }
+        if (pool)
+        {
+            const HdMemoryPool* bufferPool = buffer->GetMemoryPool();
+            if (!bufferPool || !bufferPool->IsWithin(*pool))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            const unsigned int frameStamp = buffer->FrameStamp();
+            if ((currentFrame > frameStamp ? currentFrame - frameStamp : 0) < mAgeLimit)
+            {
+                continue;
+            }
+        }
+
+        HdPagingDecision decision;
+        decision.shouldPage = true;
+        decision.action     = HdPagingDecision::Action::SwapSceneToDisk;
+        plannedBytes += buffer->Size();
+        buffers.push_back(std::move(buffer));
+        decisions.push_back(decision);
+        if (plannedBytes >= bytes)
         {
-            DisposeOldBuffer(*buffer, mCurrentFrame, mAgeLimit, scenePressure, rendererPressure);
+            break;
         }
     }
+    return plannedBytes;
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::vector<std::future<bool>> HdPageableBufferManager<PagingStrategyType,
+void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::PlanPoolEvictions(std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+    std::vector<HdPagingDecision>& decisions)
+{
+    for (HdMemoryPool* pool : mMemoryMonitor->GetOverBudgetPools())
+    {
+        // The page-outs planned for the descendant pools also relieve this one.
+        size_t planned = 0;
+        for (const auto& buffer : buffers)
+        {
+            const HdMemoryPool* bufferPool = buffer->GetMemoryPool();
+            planned += bufferPool && bufferPool->IsWithin(*pool) ? buffer->Size() : 0;
+        }
+        const size_t used   = pool->GetUsedSceneMemory();
+        const size_t budget = pool->GetSceneBudget();
+        if (used > budget + planned)
+        {
+            PlanSceneEvictions(used - budget - planned, pool, buffers, decisions);
+        }
+    }
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::vector<HdPagingFuture> HdPageableBufferManager<PagingStrategyType,
     BufferSelectionStrategyType, KeyType, KeyHash>::FreeCrawlAsync(float percentage)
 {
+    mTraceRecorder.RecordCrawl(percentage);
+    mMemoryMonitor->RefreshSystemMemory();
+
     if (!mTaskArena || !mTaskGroup)
     {
         return {};
     }
 
-    std::vector<std::future<bool>> futures;
+    std::vector<HdPagingFuture> futures;
+
+    // The pools over their budget are paged out first, in the batch of the crawl.
+    std::vector<std::shared_ptr<HdPageableBufferCore>> pageOutBuffers;
+    std::vector<HdPagingDecision> pageOutDecisions;
+    PlanPoolEvictions(pageOutBuffers, pageOutDecisions);
 
     float scenePressure    = mMemoryMonitor->GetSceneMemoryPressure();
     float rendererPressure = mMemoryMonitor->GetRendererMemoryPressure();
 
     // Only crawl if we're under memory pressure
-    if (scenePressure < HdMemoryMonitor::LOW_MEMORY_THRESHOLD &&
-        rendererPressure < HdMemoryMonitor::LOW_MEMORY_THRESHOLD)
+    std::vector<std::shared_ptr<HdPageableBufferCore>> selectedBuffers;
+    if (scenePressure >= HdMemoryMonitor::LOW_MEMORY_THRESHOLD ||
+        rendererPressure >= HdMemoryMonitor::LOW_MEMORY_THRESHOLD)
     {
-        return futures;
+        selectedBuffers = SelectBuffers(percentage);
     }
-    // Calculate number of buffers to check
-    auto numToCheck = static_cast<size_t>(mBuffers.size() * (percentage / 100.0f));
-    numToCheck      = std::max(numToCheck, kMinimalCheckCount);
-    numToCheck      = std::min(numToCheck, mBuffers.size());
 
-    // Remove null buffers first
-    for (auto it = mBuffers.begin(); it != mBuffers.end();)
+    // Only the buffers over age, and not paged out for their pool, are paged.
+    const unsigned int currentFrame = mCurrentFrame;
+    const size_t poolPageOuts       = pageOutBuffers.size();
+    auto isUnderAge = [&](const std::shared_ptr<HdPageableBufferCore>& buffer)
     {
-        if (!it->second)
+        if (!buffer ||
+            std::find(pageOutBuffers.begin(), pageOutBuffers.begin() + poolPageOuts, buffer) !=
+                pageOutBuffers.begin() + poolPageOuts)
         {
-            it = mBuffers.unsafe_erase(it);
+            return true;
         }
-        else
-        {
-            ++it;
-        }
-    }
-
-    // Create selection context
-    HdSelectionContext selectionContext;
-    selectionContext.currentFrame   = mCurrentFrame;
-    selectionContext.requestedCount = numToCheck;
-
-    // Use configurable buffer selection strategy
-    std::vector<std::shared_ptr<HdPageableBufferCore>> selectedBuffers =
-        mBufferSelectionStrategy(mBuffers.begin(), mBuffers.end(), selectionContext);
-
-    // Start async operations for each selected buffer
-    for (auto& buffer : selectedBuffers)
+        const unsigned int frameStamp = buffer->FrameStamp();
+        return (currentFrame > frameStamp ? currentFrame - frameStamp : 0) < mAgeLimit;
+    };
+    selectedBuffers.erase(
+        std::remove_if(selectedBuffers.begin(), selectedBuffers.end(), isUnderAge),
+        selectedBuffers.end());
+    const std::vector<HdPagingDecision> decisions =
+        MakePagingDecisions(selectedBuffers, scenePressure, rendererPressure);
+
+    // Start async operations for each selected buffer. Page-outs are collected into one task
+    // writing them together.
+    for (size_t i = 0; i < selectedBuffers.size(); ++i)
     {
-        if (!buffer)
+        if (IsPageOutDecision(decisions[i]))
         {
-            continue;
+            pageOutBuffers.push_back(selectedBuffers[i]);
+            pageOutDecisions.push_back(decisions[i]);
         }
-
-        // Check if buffer should be disposed based on age and pressure
-        unsigned int bufferAge = (mCurrentFrame > buffer->FrameStamp()) ? (mCurrentFrame - buffer->FrameStamp()) : 0;
-        if (bufferAge < mAgeLimit) // Buffer is not over age
+        else if (decisions[i].shouldPage)
         {
-            continue;
+            futures.push_back(ExecutePagingDecisionAsync(selectedBuffers[i], decisions[i]));
         }
+    }
 
-        // Create paging context and get decision
-        HdPagingContext context;
-        context.ageLimit         = mAgeLimit;
-        context.scenePressure    = scenePressure;
-        context.rendererPressure = rendererPressure;
-        context.bufferAge        = bufferAge;
-
-        HdPagingDecision decision = mPagingStrategy(*buffer, context);
-
-        // Start async operation
-        if (decision.shouldPage)
+    if (!pageOutBuffers.empty())
+    {
+        // All page-outs are written as one batch on the page I/O engine.
+        for (auto& future :
+            PageOutAsync(std::move(pageOutBuffers), std::move(pageOutDecisions), {}))
         {
-            futures.push_back(ExecutePagingDecisionAsync(buffer, decision));
+            futures.push_back(std::move(future));
         }
     }
     return futures;
@@ -650,6 +1466,53 @@ size_t HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType,
     return (!mTaskArena || !mTaskGroup) ? 0 : mPendingTaskCount.load();
 }
 
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+size_t HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::GetPendingOperations(HdPagingPriority priority) const
+{
+    return (!mTaskArena || !mTaskGroup)
+        ? 0
+        : mPendingPriorityCounts[static_cast<size_t>(priority)].load();
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::Schedule(HdPagingPriority priority, HdPagingTaskQueue::Step step)
+{
+    mTaskQueue.Push(priority, std::move(step));
+    mTaskArena->execute([this]() { mTaskGroup->run([this]() { mTaskQueue.RunNext(); }); });
+
+    // A waiting thread helps running the step, the arena may have no worker threads.
+    std::lock_guard<std::mutex> lock(mOperationsMutex);
+    mOperationsChanged.notify_all();
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::BeginOperation(HdPagingPriority priority) noexcept
+{
+    mPendingTaskCount.fetch_add(1);
+    mPendingPriorityCounts[static_cast<size_t>(priority)].fetch_add(1);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::EndOperation(HdPagingPriority priority) noexcept
+{
+    // The total is decremented last: WaitForAllOperations returns once it is zero.
+    mPendingPriorityCounts[static_cast<size_t>(priority)].fetch_sub(
+        1, std::memory_order_relaxed);
+    if (mPendingTaskCount.fetch_sub(1) == 1)
+    {
+        std::lock_guard<std::mutex> lock(mOperationsMutex);
+        mOperationsChanged.notify_all();
+    }
+}
+
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
@@ -660,10 +1523,23 @@ void HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, Ke
         return;
     }
 
-    mTaskArena->execute([this]() { mTaskGroup->wait(); });
+    // Page I/O completions schedule their steps once the I/O is done: sleep until a step is
+    // scheduled or the last operation ends, and run the scheduled steps in the arena.
+    for (;;)
+    {
+        mTaskArena->execute([this]() { mTaskGroup->wait(); });
 
-    // Reset pending count after all tasks complete
-    mPendingTaskCount.store(0);
+        std::unique_lock<std::mutex> lock(mOperationsMutex);
+        mOperationsChanged.wait(lock,
+            [this]() { return mPendingTaskCount.load() == 0 || mTaskQueue.GetQueuedCount() > 0; });
+        if (mPendingTaskCount.load() == 0)
+        {
+            break;
+        }
+    }
+
+    // The tasks of the last operations may still be returning.
+    mTaskArena->execute([this]() { mTaskGroup->wait(); });
 }
 
 // Helper method for submitting tasks with TBB task_group and future support ///
@@ -671,7 +1547,8 @@ template <typename PagingStrategyType, typename BufferSelectionStrategyType, typ
     typename KeyHash>
 template <typename Callable>
 std::future<std::invoke_result_t<Callable>> HdPageableBufferManager<PagingStrategyType,
-    BufferSelectionStrategyType, KeyType, KeyHash>::SubmitTask(Callable&& task)
+    BufferSelectionStrategyType, KeyType, KeyHash>::SubmitTask(HdPagingPriority priority,
+    const HdPagingTaskOptions& options, Callable&& task)
 {
     using ResultType = std::invoke_result_t<Callable>;
 
@@ -682,18 +1559,48 @@ std::future<std::invoke_result_t<Callable>> HdPageableBufferManager<PagingStrate
     }
 
     // Create a packaged_task to get a future. To ensure correct pending task count, wrap the 
-    // callable so mPendingTaskCount is decremented before the packaged_task marks the future ready.
-    auto wrappedTask = [this, task = std::forward<Callable>(task)]() mutable -> ResultType
+    // callable so the operation ends before the packaged_task marks the future ready.
+    // The operation ends even if the task throws, WaitForAllOperations relies on it.
+    auto wrappedTask = [this, priority, options,
+                           task = std::forward<Callable>(task)]() mutable -> ResultType
     {
+        struct PendingTaskGuard
+        {
+            HdPageableBufferManager& manager;
+            HdPagingPriority priority;
+            bool released = false;
+            void Release()
+            {
+                manager.EndOperation(priority);
+                released = true;
+            }
+            ~PendingTaskGuard()
+            {
+                if (!released)
+                    manager.EndOperation(priority);
+            }
+        } guard { *this, priority };
+
         if constexpr (std::is_void_v<ResultType>)
         {
-            task();
-            mPendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+            if (!options.IsCancelled())
+            {
+                task();
+            }
+            guard.Release();
         }
         else
         {
-            ResultType result = task();
-            mPendingTaskCount.fetch_sub(1, std::memory_order_relaxed);
+            ResultType result {};
+            if (!options.IsCancelled())
+            {
+                result = task();
+            }
+            else if constexpr (std::is_same_v<ResultType, HdPagingResult>)
+            {
+                result = HdPagingResult::Cancelled();
+            }
+            guard.Release();
             return result;
         }
     };
@@ -703,107 +1610,159 @@ std::future<std::invoke_result_t<Callable>> HdPageableBufferManager<PagingStrate
     auto future = packagedTask->get_future();
 
     // Submit task
-    mPendingTaskCount.fetch_add(1);
-    mTaskArena->execute(
-        [this, packagedTask]()
-        {
-            mTaskGroup->run(
-                [packagedTask]()
-                {
-                    (*packagedTask)();
-                });
-        });
+    BeginOperation(priority);
+    Schedule(priority, [packagedTask]() { (*packagedTask)(); });
 
     return future;
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::PageToSceneMemoryAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force)
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::PageToSceneMemoryAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
+    const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force]() -> bool { return buffer->PageToSceneMemory(force); });
+    return PageInAsync(std::move(buffer), force, false, HdBufferState::Unknown, options);
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::PageToRendererMemoryAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force)
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::PageToRendererMemoryAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
+    const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force]() -> bool { return buffer->PageToRendererMemory(force); });
+    return SubmitTask(options.GetPriority(HdPagingPriority::OnDemand), options,
+        [buffer, force]() -> HdPagingResult { return buffer->PageToRendererMemory(force); });
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::PageToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force)
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::PageToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
+    const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force]() -> bool { return buffer->PageToDisk(force); });
+    return SubmitTask(options.GetPriority(HdPagingPriority::Eviction), options,
+        [buffer, force]() -> HdPagingResult { return buffer->PageToDisk(force); });
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::SwapSceneToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force)
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::SwapSceneToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
+    const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force]() -> bool { return buffer->SwapSceneToDisk(force); });
+    HdPagingDecision decision;
+    decision.shouldPage     = true;
+    decision.forceOperation = force;
+    decision.action         = HdPagingDecision::Action::SwapSceneToDisk;
+    return std::move(PageOutAsync({ std::move(buffer) }, { decision }, options).front());
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::SwapRendererToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force)
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+    KeyHash>::SwapRendererToDiskAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
+    const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force]() -> bool { return buffer->SwapRendererToDisk(force); });
+    HdPagingDecision decision;
+    decision.shouldPage     = true;
+    decision.forceOperation = force;
+    decision.action         = HdPagingDecision::Action::SwapRendererToDisk;
+    return std::move(PageOutAsync({ std::move(buffer) }, { decision }, options).front());
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
     KeyHash>::SwapToSceneMemoryAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
-    HdBufferState releaseBuffer)
+    HdBufferState releaseBuffer, const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force, releaseBuffer]() -> bool
-        { return buffer->SwapToSceneMemory(force, releaseBuffer); });
+    return PageInAsync(std::move(buffer), force, true, releaseBuffer, options);
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
-std::future<bool> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
+HdPagingFuture HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
     KeyHash>::SwapToRendererMemoryAsync(std::shared_ptr<HdPageableBufferCore> buffer, bool force,
-    HdBufferState releaseBuffer)
+    HdBufferState releaseBuffer, const HdPagingTaskOptions& options)
 {
-    return SubmitTask([buffer, force, releaseBuffer]() -> bool
+    return SubmitTask(options.GetPriority(HdPagingPriority::OnDemand), options,
+        [buffer, force, releaseBuffer]() -> HdPagingResult
         { return buffer->SwapToRendererMemory(force, releaseBuffer); });
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 std::future<void> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::ReleaseSceneBufferAsync(std::shared_ptr<HdPageableBufferCore> buffer) noexcept
+    KeyHash>::ReleaseSceneBufferAsync(std::shared_ptr<HdPageableBufferCore> buffer,
+    const HdPagingTaskOptions& options) noexcept
 {
-    return SubmitTask([buffer]() -> void { buffer->ReleaseSceneBuffer(); });
+    return SubmitTask(options.GetPriority(HdPagingPriority::Eviction), options,
+        [buffer]() -> void { buffer->ReleaseSceneBuffer(); });
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 std::future<void> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::ReleaseRendererBufferAsync(std::shared_ptr<HdPageableBufferCore> buffer) noexcept
+    KeyHash>::ReleaseRendererBufferAsync(std::shared_ptr<HdPageableBufferCore> buffer,
+    const HdPagingTaskOptions& options) noexcept
 {
-    return SubmitTask([buffer]() -> void { buffer->ReleaseRendererBuffer(); });
+    return SubmitTask(options.GetPriority(HdPagingPriority::Eviction), options,
+        [buffer]() -> void { buffer->ReleaseRendererBuffer(); });
 }
 
 template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
     typename KeyHash>
 std::future<void> HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType, KeyType,
-    KeyHash>::ReleaseDiskPageAsync(std::shared_ptr<HdPageableBufferCore> buffer) noexcept
+    KeyHash>::ReleaseDiskPageAsync(std::shared_ptr<HdPageableBufferCore> buffer,
+    const HdPagingTaskOptions& options) noexcept
+{
+    return SubmitTask(options.GetPriority(HdPagingPriority::Eviction), options,
+        [buffer]() -> void { buffer->ReleaseDiskPage(); });
+}
+
+// Page File Compaction //////////////////////////////////////////////////////
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdPageFileCompactionResult HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType,
+    KeyType, KeyHash>::CompactPageFiles(size_t ioBudget)
+{
+    return mPageFileManager->Compact(ioBudget);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::future<HdPageFileCompactionResult> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::CompactPageFilesAsync(size_t ioBudget)
+{
+    return SubmitTask(HdPagingPriority::Background, {},
+        [this, ioBudget]() -> HdPageFileCompactionResult
+        { return mPageFileManager->Compact(ioBudget); });
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+HdPageFileCompactionResult HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType,
+    KeyType, KeyHash>::MigrateColdPages(size_t ioBudget, std::chrono::milliseconds minAge)
 {
-    return SubmitTask([buffer]() -> void { buffer->ReleaseDiskPage(); });
+    return mPageFileManager->MigrateColdPages(ioBudget, minAge);
+}
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType, typename KeyType,
+    typename KeyHash>
+std::future<HdPageFileCompactionResult> HdPageableBufferManager<PagingStrategyType,
+    BufferSelectionStrategyType, KeyType, KeyHash>::MigrateColdPagesAsync(size_t ioBudget,
+    std::chrono::milliseconds minAge)
+{
+    return SubmitTask(HdPagingPriority::Background, {},
+        [this, ioBudget, minAge]() -> HdPageFileCompactionResult
+        { return mPageFileManager->MigrateColdPages(ioBudget, minAge); });
 }
 
 // Built-in BufferManager Aliases /////////////////////////////////////////////
 
-// Default HdPageableBufferManager (also the one offered in HdPageableDataSourceManager)
+// Default HdPageableBufferManager (the strategies of HdPageableDataSourceManager by default)
 using DefaultBufferManager = HdPageableBufferManager<HdPagingStrategies::HybridStrategy,
     HdPagingStrategies::LRUSelectionStrategy>;
 
@@ -829,4 +1788,16 @@ using AgeBasedBufferManager = HdPageableBufferManager<HdPagingStrategies::AgeBas
 using FIFOBufferManager     = HdPageableBufferManager<HdPagingStrategies::HybridStrategy,
         HdPagingStrategies::FIFOSelectionStrategy>;
 
+// Scan-resistant combinations
+using ClockProBufferManager = HdPageableBufferManager<HdPagingStrategies::HybridStrategy,
+    HdPagingStrategies::ClockProSelectionStrategy>;
+using ArcBufferManager      = HdPageableBufferManager<HdPagingStrategies::HybridStrategy,
+    HdPagingStrategies::ArcSelectionStrategy>;
+using TwoQueueBufferManager = HdPageableBufferManager<HdPagingStrategies::HybridStrategy,
+    HdPagingStrategies::TwoQueueSelectionStrategy>;
+
+// Strategies replaceable at runtime (also the one offered in HdPageableDataSourceManager)
+using RuntimeBufferManager = HdPageableBufferManager<HdPagingStrategies::RuntimePagingStrategy,
+    HdPagingStrategies::RuntimeSelectionStrategy>;
+
 } // namespace HVT_NS
@@ -0,0 +1,153 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+#include <hvt/pageableBuffer/pageableDataSource.h>
+#include <hvt/pageableBuffer/pageableValueTypes.h>
+
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/imaging/hd/dataSource.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace HVT_NS
+{
+
+/// Memory-managed data source of a large array, e.g. the points of a scan, split into chunks of
+/// a fixed size with a disk page each. Range accesses page in only the chunks they touch, so
+/// the consumers streaming the array never need it whole in memory.
+///
+/// Only the arrays whose payload is their storage are chunked (HdValueType::elementSize): the
+/// VtArrays of the numeric and Gf types, and of the registered user PODs. GetValue, for the
+/// consumers which are not chunk-aware, pages in every chunk and returns the whole array.
+class HVT_API HdPageableChunkedArrayDataSource : public PXR_NS::HdSampledDataSource,
+                                                 public HdPageableBufferBase<>
+{
+public:
+    HD_DECLARE_DATASOURCE_ABSTRACT(HdPageableChunkedArrayDataSource);
+
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * ONE_MiB;
+
+    /// Visits a chunk: its VtArray, and the index of its first element in the array. Returns
+    /// false to stop.
+    using ChunkVisitor = std::function<bool(const PXR_NS::VtValue& chunk, size_t firstElement)>;
+
+    /// Splits the array into chunks of chunkSize bytes, rounded down to whole elements. Returns
+    /// nullptr if the array cannot be chunked.
+    static Handle New(const PXR_NS::VtValue& array, const PXR_NS::SdfPath& primPath,
+        const PXR_NS::TfToken& attributeName,
+        const std::unique_ptr<HdPageFileManager>& pageFileManager,
+        const std::unique_ptr<HdMemoryMonitor>& memoryMonitor,
+        DestructionCallback destructionCallback,
+        HdBufferUsage usage = HdBufferUsage::Static, size_t chunkSize = DEFAULT_CHUNK_SIZE,
+        bool enableImplicitPaging = true);
+
+    /// Check if the value is an array which can be chunked
+    static bool CanChunk(const PXR_NS::VtValue& value);
+
+    /// HdSampledDataSource interface: the whole array. These may trigger implicit paging.
+    PXR_NS::VtValue GetValue(Time shutterOffset) override;
+    bool GetContributingSampleTimesForInterval(
+        Time startTime, Time endTime, std::vector<Time>* outSampleTimes) override;
+
+    /// The elements [first, first + count), clamped to the array, paging in only the chunks
+    /// holding them. Returns empty VtValue if one of them cannot be paged in.
+    PXR_NS::VtValue GetRange(size_t first, size_t count);
+
+    /// Visits the chunks holding the elements [first, first + count) in order, without copying
+    /// them. Returns false if the visitor stopped, or if a chunk cannot be paged in.
+    bool ForEachChunk(size_t first, size_t count, const ChunkVisitor& visitor);
+
+    /// The VtArray of a chunk. It may trigger implicit paging.
+    PXR_NS::VtValue GetChunk(size_t index);
+
+    /// Get a chunk without triggering implicit paging
+    PXR_NS::VtValue GetChunkIfResident(size_t index) const;
+
+    /// Layout
+    size_t GetElementCount() const noexcept { return mElementCount; }
+    size_t GetElementsPerChunk() const noexcept { return mElementsPerChunk; }
+    size_t GetChunkCount() const noexcept { return mChunks.size(); }
+    size_t GetChunkIndex(size_t element) const noexcept { return element / mElementsPerChunk; }
+    PXR_NS::TfToken GetDataType() const { return mAttributeName; }
+
+    /// Residency of the chunks
+    bool IsChunkResident(size_t index) const;
+    size_t GetResidentChunkCount() const;
+
+    /// Buffers of the chunks holding the elements [first, first + count), e.g. to prefetch them
+    /// or to page them out once consumed.
+    std::vector<std::shared_ptr<HdPageableValue>> GetChunkBuffers(
+        size_t first, size_t count) const;
+
+    bool IsImplicitPagingEnabled() const { return mEnableImplicitPaging; }
+
+    /// Observability metrics
+    size_t GetAccessCount() const { return mAccessCount.load(); }
+    size_t GetPageInCount() const { return mPageInCount.load(); }
+    size_t GetPageOutCount() const { return mPageOutCount.load(); }
+
+    /// HdPageableBufferBase<> methods: all the chunks at once.
+    bool SwapSceneToDisk(bool force = false,
+        HdBufferState releaseBuffer = static_cast<HdBufferState>(
+            static_cast<int>(HdBufferState::SceneBuffer) |
+            static_cast<int>(HdBufferState::RendererBuffer))) override;
+    bool SwapToSceneMemory(
+        bool force = false, HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
+
+private:
+    HdPageableChunkedArrayDataSource(const PXR_NS::VtValue& array, const HdValueType& type,
+        const PXR_NS::SdfPath& primPath, const PXR_NS::TfToken& attributeName,
+        const std::unique_ptr<HdPageFileManager>& pageFileManager,
+        const std::unique_ptr<HdMemoryMonitor>& memoryMonitor,
+        DestructionCallback destructionCallback, HdBufferUsage usage, size_t chunkSize,
+        bool enableImplicitPaging);
+
+    /// The chunks are set once constructed: only their buffers page, which are thread-safe.
+    std::vector<std::shared_ptr<HdPageableValue>> mChunks;
+    const HdValueType& mType;
+    PXR_NS::SdfPath mPrimPath;
+    PXR_NS::TfToken mAttributeName;
+    size_t mElementCount { 0 };
+    size_t mElementsPerChunk { 1 };
+
+    const bool mEnableImplicitPaging { true };
+    mutable HvtDebugCounter mAccessCount {};
+    mutable HvtDebugCounter mPageInCount {};
+    mutable HvtDebugCounter mPageOutCount {};
+
+    /// Get buffer key of a chunk
+    std::string GetChunkKey(size_t index) const;
+
+    /// Helper method: get a chunk with or without implicit paging based on flag
+    PXR_NS::VtValue GetChunkValue(size_t index) const;
+};
+HD_DECLARE_DATASOURCE_HANDLES(HdPageableChunkedArrayDataSource);
+
+namespace HdPageableDataSourceUtils
+{
+/// Create chunked data source of a large array, see HdPageableChunkedArrayDataSource. Values
+/// which cannot be chunked get the data source of CreateFromValue.
+HVT_API
+PXR_NS::HdDataSourceBaseHandle CreateChunkedArray(const PXR_NS::VtValue& value,
+    const PXR_NS::SdfPath& primPath, const PXR_NS::TfToken& name,
+    const std::shared_ptr<HdPageableDataSourceManager>& memoryManager,
+    size_t chunkSize = HdPageableChunkedArrayDataSource::DEFAULT_CHUNK_SIZE);
+} // namespace HdPageableDataSourceUtils
+
+} // namespace HVT_NS
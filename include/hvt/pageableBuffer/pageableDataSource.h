@@ -14,10 +14,15 @@
 #pragma once
 
 #include <hvt/api.h>
+#include <hvt/pageableBuffer/pageCodec.h>
+#include <hvt/pageableBuffer/pageQuantization.h>
 #include <hvt/pageableBuffer/pageableBuffer.h>
 #include <hvt/pageableBuffer/pageableBufferManager.h>
+#include <hvt/pageableBuffer/pageablePressureController.h>
 #include <hvt/pageableBuffer/pageableStrategies.h>
 
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/frustum.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/value.h>
@@ -26,13 +31,16 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstring>
 #include <filesystem>
+#include <future>
 #include <map>
 #include <memory>
 #include <shared_mutex>
 #include <thread>
 #include <typeindex>
+#include <utility>
 #include <vector>
 
 namespace HVT_NS
@@ -73,12 +81,28 @@ public:
     /// Serialize a VtValue to bytes
     virtual std::vector<uint8_t> Serialize(const PXR_NS::VtValue& value) const = 0;
 
+    /// Serialize the value of an attribute: the data type of the value (its typeHint, e.g. the
+    /// attribute name) may select the encoding. The default serializes the value.
+    virtual std::vector<uint8_t> SerializeAttribute(
+        const PXR_NS::VtValue& value, const PXR_NS::TfToken& /*typeHint*/) const
+    {
+        return Serialize(value);
+    }
+
     /// Deserialize bytes to a VtValue
     virtual PXR_NS::VtValue Deserialize(
         const std::vector<uint8_t>& data, const PXR_NS::TfToken& typeHint) const = 0;
 
     /// Estimate memory usage for a value
     virtual size_t EstimateSize(const PXR_NS::VtValue& value) const = 0;
+
+    /// Streaming serialization: the size of Serialize(value), or 0 if it is only known once
+    /// serialized, e.g. compressed. Values of a known size are written with SerializeTo.
+    virtual size_t GetSerializedSize(const PXR_NS::VtValue& /*value*/) const { return 0; }
+
+    /// Writes the bytes of Serialize(value) to the sink in chunks, straight from the value.
+    /// The default serializes the value first.
+    virtual bool SerializeTo(const PXR_NS::VtValue& value, const HdPageSink& sink) const;
 };
 
 // Default serializer supporting common USD types
@@ -91,11 +115,94 @@ public:
         const std::vector<uint8_t>& data, const PXR_NS::TfToken& typeHint) const override;
 
     /// Zero-copy deserialization from a raw data pointer.
+    PXR_NS::VtValue DeserializeFromSpan(
+        const uint8_t* data, size_t size, const PXR_NS::TfToken& typeHint) const;
+    /// Deserialization straight from a disk page: POD arrays are read into the storage of the
+    /// array, without a staging buffer, so a page-in needs no more memory than the payload.
+    /// Values only use it with the default serializer itself, not with its subclasses.
+    PXR_NS::VtValue DeserializeFromPage(HdPageFileManager& pageFileManager,
+        const HdBufferPageEntry& pageEntry, const PXR_NS::TfToken& typeHint) const;
+    size_t EstimateSize(const PXR_NS::VtValue& value) const override;
+    /// POD arrays are written from the array storage, string arrays element by element.
+    /// Subclasses, which may override Serialize, take the IHdValueSerializer defaults.
+    size_t GetSerializedSize(const PXR_NS::VtValue& value) const override;
+    bool SerializeTo(const PXR_NS::VtValue& value, const HdPageSink& sink) const override;
+};
+
+/// Serializer decorator encoding the output of another serializer with a page codec.
+/// Every serialized value starts with its HdPageCodec tag; values which do not compress are
+/// stored raw, so mixed pages are always readable.
+class HVT_API HdCompressedValueSerializer : public IHdValueSerializer
+{
+public:
+    explicit HdCompressedValueSerializer(std::shared_ptr<IHdValueSerializer> serializer,
+        HdPageCodec codec = HdPageCodec::ShuffleLZ);
+
+    bool CanSerialize(const std::type_index& type) const override;
+    std::vector<uint8_t> Serialize(const PXR_NS::VtValue& value) const override;
+    std::vector<uint8_t> SerializeAttribute(
+        const PXR_NS::VtValue& value, const PXR_NS::TfToken& typeHint) const override;
+    PXR_NS::VtValue Deserialize(
+        const std::vector<uint8_t>& data, const PXR_NS::TfToken& typeHint) const override;
+
+    /// Deserialization from a raw data pointer. Raw pages are not copied.
     PXR_NS::VtValue DeserializeFromSpan(
         const uint8_t* data, size_t size, const PXR_NS::TfToken& typeHint) const;
     size_t EstimateSize(const PXR_NS::VtValue& value) const override;
+
+    HdPageCodec GetCodec() const noexcept { return mCodec; }
+    const std::shared_ptr<IHdValueSerializer>& GetSerializer() const { return mSerializer; }
+
+private:
+    std::shared_ptr<IHdValueSerializer> mSerializer;
+    HdPageCodec mCodec;
+};
+
+/// Serializer decorator storing the points, normals and texture coordinates lossy, for the
+/// sessions which trade exactness for memory (e.g. the PerformantViewing mode). The role of a
+/// value is selected by its data type, the attribute name by default (see GetDefaultRoles):
+///   Position: VtVec3fArray as 16-bit offsets in its bounding box, 2x smaller
+///   Normal:   VtVec3fArray as octahedral 2 x 16-bit, 3x smaller, decoded unit length
+///   TexCoord: VtVec2fArray as half floats, 2x smaller
+/// See HdPageQuantization for the error bounds. Every serialized value starts with its
+/// HdQuantizedRole; the other values, and the ones out of the range of their encoding, are
+/// serialized exactly by the wrapped serializer.
+class HVT_API HdQuantizedValueSerializer : public IHdValueSerializer
+{
+public:
+    using RoleMap = std::map<PXR_NS::TfToken, HdQuantizedRole>;
+
+    explicit HdQuantizedValueSerializer(std::shared_ptr<IHdValueSerializer> serializer,
+        RoleMap roles = GetDefaultRoles());
+
+    /// points, normals and st / uv, as attributes and as primvars.
+    static RoleMap GetDefaultRoles();
+
+    bool CanSerialize(const std::type_index& type) const override;
+    /// Values without a data type are serialized exactly.
+    std::vector<uint8_t> Serialize(const PXR_NS::VtValue& value) const override;
+    std::vector<uint8_t> SerializeAttribute(
+        const PXR_NS::VtValue& value, const PXR_NS::TfToken& typeHint) const override;
+    PXR_NS::VtValue Deserialize(
+        const std::vector<uint8_t>& data, const PXR_NS::TfToken& typeHint) const override;
+
+    /// Deserialization from a raw data pointer, quantized pages are decoded into the array.
+    PXR_NS::VtValue DeserializeFromSpan(
+        const uint8_t* data, size_t size, const PXR_NS::TfToken& typeHint) const;
+    size_t EstimateSize(const PXR_NS::VtValue& value) const override;
+
+    /// Role of a data type, None if it is stored exactly.
+    HdQuantizedRole GetRole(const PXR_NS::TfToken& typeHint) const;
+    const RoleMap& GetRoles() const { return mRoles; }
+    const std::shared_ptr<IHdValueSerializer>& GetSerializer() const { return mSerializer; }
+
+private:
+    std::shared_ptr<IHdValueSerializer> mSerializer;
+    RoleMap mRoles;
 };
 
+class HdPageableSampledDataSource;
+
 /// Pageable data source memory manager with a background cleanup thread.
 /// Supports metrics-based observability and custom serializers.
 class HVT_API HdPageableDataSourceManager
@@ -113,6 +220,33 @@ public:
         bool enableBackgroundCleanup    = true;
         int ageLimit                    = 20;
         unsigned int numThreads         = 2;
+        HdPageFileIOMode pageFileIOMode  = HdPageFileIOMode::Positional;
+        size_t compactionBudget         = HdPageFileManager::DEFAULT_COMPACTION_BUDGET; ///< 0 = off
+        HdPageCodec pageCodec           = HdPageCodec::Raw; ///< Codec of the written pages
+        bool pageDeduplication          = false; ///< Identical pages share their disk space
+        bool persistentPageCache        = false; ///< Reuse the pages of earlier sessions
+        /// Lossy pages of the points, normals and UVs (HdQuantizedValueSerializer), e.g. for
+        /// the PerformantViewing mode
+        bool quantizedPages = false;
+        std::string stageIdentity; ///< Persistent page cache key, e.g. the root layer identifier
+        HdPageIOConfig pageIO;     ///< Page I/O engine of the async paging
+        std::vector<HdPageStorageTier> storageTiers; ///< Fastest first, replaces pageFileDirectory
+        size_t migrationBudget = HdPageFileManager::DEFAULT_COMPACTION_BUDGET; ///< 0 = off
+        std::chrono::milliseconds coldPageAge = HdPageFileManager::DEFAULT_COLD_PAGE_AGE;
+        std::filesystem::path tracePath; ///< Paging trace for offline replay, empty = off
+        /// The background cleanup keeps the scene memory near pressureController.targetPressure
+        /// instead of crawling freeCrawlPercentage above the fixed pressure thresholds.
+        bool pressureControl = false;
+        HdPressureControllerConfig pressureController;
+        /// Scene memory limit following the system memory, e.g. an HdSystemMemoryProbe;
+        /// nullptr = sceneMemoryLimit.
+        std::shared_ptr<IHdSystemMemoryProbe> systemMemoryProbe;
+        HdSystemMemoryBudget systemMemoryBudget;
+        /// Paging I/O per frame: implicit page-ins beyond it are postponed to the next frames
+        /// and the crawls page out the rest later. Unlimited by default.
+        HdFrameIOBudgetConfig frameIOBudget;
+        /// Prefetch of the buffers paged in together with a demand page-in.
+        HdPrefetchConfig prefetch;
     };
 
     HdPageableDataSourceManager();
@@ -125,10 +259,51 @@ public:
     std::shared_ptr<HdPageableBufferCore> GetOrCreateBuffer(const PXR_NS::SdfPath& primPath,
         const PXR_NS::VtValue& data, const PXR_NS::TfToken& dataType);
 
-    /// Frame management for age-based eviction
-    void AdvanceFrame(unsigned int advanceCount = 1) { mBufferManager->AdvanceFrame(advanceCount); }
+    /// Frame management for age-based eviction. A new frame renews the paging I/O budget and
+    /// issues the page-ins postponed by the previous frames, within the budget.
+    void AdvanceFrame(unsigned int advanceCount = 1);
     unsigned int GetCurrentFrame() const noexcept { return mBufferManager->GetCurrentFrame(); }
 
+    /// Paging I/O budget of a frame (Config::frameIOBudget) and the work it postponed.
+    void SetFrameIOBudget(const HdFrameIOBudgetConfig& config)
+    {
+        GetMemoryMonitor()->GetFrameIOBudget().SetConfig(config);
+    }
+    HdFrameIOBudgetConfig GetFrameIOBudget() const
+    {
+        return mBufferManager->GetMemoryMonitor()->GetFrameIOBudget().GetConfig();
+    }
+    HdFrameIOStats GetFrameIOStats() const
+    {
+        return mBufferManager->GetMemoryMonitor()->GetFrameIOBudget().GetStats();
+    }
+
+    /// Prefetch: page-ins issued ahead of the accesses from hints of the application, on the
+    /// async threads with the Prefetch priority (synchronously without async threads). The
+    /// page-ins beyond the frame I/O budget are dropped. Return the number of page-ins issued.
+    /// The buffers under the prim paths.
+    size_t Prefetch(const PXR_NS::SdfPathVector& primPaths);
+    /// The buffers under the prims whose bounds intersect the frustum.
+    size_t Prefetch(const PXR_NS::GfFrustum& frustum,
+        const std::vector<std::pair<PXR_NS::SdfPath, PXR_NS::GfBBox3d>>& primBounds);
+    /// The sampleCount samples of a time-sampled data source from time on.
+    size_t PrefetchTimeSamples(const HdPageableSampledDataSource& source,
+        PXR_NS::HdSampledDataSource::Time time, size_t sampleCount);
+
+    /// Co-access learning (Config::prefetch) and the hit rate of the prefetches.
+    void SetPrefetchConfig(const HdPrefetchConfig& config)
+    {
+        GetMemoryMonitor()->GetPrefetchHistory().SetConfig(config);
+    }
+    HdPrefetchConfig GetPrefetchConfig() const
+    {
+        return mBufferManager->GetMemoryMonitor()->GetPrefetchHistory().GetConfig();
+    }
+    HdPrefetchStats GetPrefetchStats() const
+    {
+        return mBufferManager->GetMemoryMonitor()->GetPrefetchHistory().GetStats();
+    }
+
     /// Configuration
     int GetAgeLimit() const noexcept { return mBufferManager->GetAgeLimit(); }
     void SetFreeCrawlPercentage(float percentage) noexcept { mFreeCrawlPercentage = percentage; }
@@ -137,6 +312,57 @@ public:
     int GetFreeCrawlInterval() const noexcept { return mFreeCrawlInterval; }
     void SetBackgroundCleanupEnabled(bool enabled) noexcept { mBackgroundCleanupEnabled = enabled; }
     bool IsBackgroundCleanupEnabled() const noexcept { return mBackgroundCleanupEnabled; }
+    void SetCompactionBudget(size_t ioBudget) noexcept { mCompactionBudget = ioBudget; }
+    size_t GetCompactionBudget() const noexcept { return mCompactionBudget; }
+    void SetMigrationBudget(size_t ioBudget) noexcept { mMigrationBudget = ioBudget; }
+    size_t GetMigrationBudget() const noexcept { return mMigrationBudget; }
+    void SetPressureControlEnabled(bool enabled) noexcept { mPressureControl = enabled; }
+    bool IsPressureControlEnabled() const noexcept { return mPressureControl; }
+
+    /// Closed-loop scene memory control of the background cleanup (Config::pressureControl).
+    HdPressureController& GetPressureController() noexcept { return mPressureController; }
+    HdPressureControllerState GetPressureControllerState() const
+    {
+        return mPressureController.GetState();
+    }
+
+    /// Paging and buffer selection strategies (HdPagingStrategies), HybridStrategy and
+    /// LRUSelectionStrategy by default. A new strategy is used from the next crawl on, the
+    /// buffers are kept.
+    template <typename PagingStrategyType>
+    void SetPagingStrategy(PagingStrategyType strategy)
+    {
+        mBufferManager->GetPagingStrategy().Set(std::move(strategy));
+    }
+    template <typename BufferSelectionStrategyType>
+    void SetSelectionStrategy(BufferSelectionStrategyType strategy)
+    {
+        mBufferManager->GetBufferSelectionStrategy().Set(std::move(strategy));
+    }
+    HdPagingStrategies::RuntimePagingStrategy GetPagingStrategy() const
+    {
+        return mBufferManager->GetPagingStrategy();
+    }
+    HdPagingStrategies::RuntimeSelectionStrategy GetSelectionStrategy() const
+    {
+        return mBufferManager->GetBufferSelectionStrategy();
+    }
+
+    /// Memory pools of the data sources under prim path prefixes, e.g. one per loaded stage,
+    /// with an optional scene memory budget each (see HdMemoryPool).
+    HdMemoryPool* CreateMemoryPool(
+        const std::string& name, size_t sceneBudget = 0, HdMemoryPool* parent = nullptr)
+    {
+        return mBufferManager->CreateMemoryPool(name, sceneBudget, parent);
+    }
+    void AssignMemoryPool(const PXR_NS::SdfPath& prefix, HdMemoryPool* pool)
+    {
+        mBufferManager->AssignMemoryPool(prefix, pool);
+    }
+    std::vector<HdMemoryPoolStats> GetMemoryPoolStats() const
+    {
+        return mBufferManager->GetMemoryPoolStats();
+    }
 
     /// Access to internal managers for utility functions
     std::unique_ptr<HdPageFileManager>& GetPageFileManager()
@@ -148,7 +374,8 @@ public:
         return mBufferManager->GetMemoryMonitor();
     }
 
-    /// Customization: Set custom serializer (replaces default)
+    /// Customization: Set custom serializer (replaces default). Its output is encoded with the
+    /// configured page codec.
     void SetSerializer(std::shared_ptr<IHdValueSerializer> serializer);
     const std::shared_ptr<IHdValueSerializer>& GetSerializer() const { return mSerializer; }
 
@@ -163,17 +390,30 @@ public:
     void PrintMemoryStatistics() const { mBufferManager->PrintCacheStats(); }
 
 private:
-    std::unique_ptr<DefaultBufferManager> mBufferManager;
+    std::unique_ptr<RuntimeBufferManager> mBufferManager;
     std::atomic<bool> mBackgroundCleanupEnabled { true };
     std::atomic<float> mFreeCrawlPercentage { 10.0f };
     std::atomic<int> mFreeCrawlInterval { 100 }; ///< milliseconds
+    std::atomic<size_t> mCompactionBudget { HdPageFileManager::DEFAULT_COMPACTION_BUDGET };
     std::thread mCleanupThread;
+    std::future<HdPageFileCompactionResult> mCompaction; ///< Owned by the cleanup thread
+    std::atomic<size_t> mMigrationBudget { HdPageFileManager::DEFAULT_COMPACTION_BUDGET };
+    std::chrono::milliseconds mColdPageAge = HdPageFileManager::DEFAULT_COLD_PAGE_AGE;
+    std::future<HdPageFileCompactionResult> mMigration; ///< Owned by the cleanup thread
+    std::atomic<bool> mPressureControl { false };
+    HdPressureController mPressureController;
 
     // Customization
     std::shared_ptr<IHdValueSerializer> mSerializer;
+    HdPageCodec mPageCodec = HdPageCodec::Raw;
+    std::string mStageIdentity;
 
     void BackgroundCleanupLoop();
     void InitializeDefaults();
+    void ResumeDeferredPageIns();
+    bool PrefetchBuffer(const PXR_NS::SdfPath& key,
+        const std::shared_ptr<HdPageableBufferCore>& buffer, bool learned);
+    void PrefetchNeighbours(const std::vector<PXR_NS::SdfPath>& keys);
 };
 
 /// Utility functions for creating memory-managed data sources
@@ -224,7 +464,8 @@ public:
         const IHdValueSerializer* serializer = nullptr);
 
     /// Get the original VtValue data (triggers implicit page-in if needed).
-    /// Thread-safe. Returns empty VtValue if page-in fails.
+    /// Thread-safe. Returns empty VtValue if page-in fails, or if it does not fit in the frame
+    /// I/O budget: the page-in is then postponed (see HdFrameIOBudget).
     /// @param outPagedIn Optional output to indicate if data was paged in
     PXR_NS::VtValue GetValue(bool* outPagedIn = nullptr);
 
@@ -254,6 +495,12 @@ public:
     void SetResidentValue(const PXR_NS::VtValue& value);
     void ClearResidentValue();
 
+    /// Persistent page cache (the page file manager must be persistent). Reuses the page an
+    /// earlier session stored for this stage, path and content: the value then has a valid disk
+    /// copy and its first page-out writes nothing. Otherwise the page written by the next
+    /// page-out is stored for later sessions. Returns true if a stored page was reused.
+    bool AttachPersistentPage(const std::string& stageIdentity);
+
     /// HdPageableBufferBase<> methods /////////////////////////////////////////
 
     bool SwapSceneToDisk(bool force = false,
@@ -262,6 +509,23 @@ public:
             static_cast<int>(HdBufferState::RendererBuffer))) override;
     bool SwapToSceneMemory(
         bool force = false, HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
+    /// Writes the disk page of the value, which stays resident.
+    [[nodiscard]] bool PageToDisk(bool force = false) override;
+
+    /// Batched page-out: the serialized value is parked until CompletePageOut, which drops the
+    /// written page if the value changed in the meantime. Values of at least
+    /// HdPageFileManager::STREAM_CHUNK_SIZE bytes are not batched, SwapSceneToDisk streams them.
+    [[nodiscard]] PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState source) override;
+    bool CompletePageOut(std::unique_ptr<HdBufferPageEntry> pageEntry,
+        HdBufferState releaseBuffer = static_cast<HdBufferState>(
+            static_cast<int>(HdBufferState::SceneBuffer) |
+            static_cast<int>(HdBufferState::RendererBuffer))) override;
+    /// Asynchronous page-in: the page read on the page I/O engine is deserialized by
+    /// CompletePageIn. Memory-mapped page files are deserialized in place, and the default
+    /// serializer reads into the value without a staging page, by SwapToSceneMemory.
+    [[nodiscard]] const HdBufferPageEntry* PreparePageIn() override;
+    bool CompletePageIn(PXR_NS::TfSpan<const std::byte> page,
+        HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
 
     [[nodiscard]] PXR_NS::TfSpan<const std::byte> GetSceneMemorySpan() const noexcept override;
     [[nodiscard]] PXR_NS::TfSpan<std::byte> GetSceneMemorySpan() noexcept override;
@@ -275,7 +539,14 @@ public:
 private:
     mutable std::shared_mutex mDataMutex; ///< Protects mSourceValue and mSerializedCache
     PXR_NS::VtValue mSourceValue;
-    mutable std::vector<uint8_t> mSerializedCache; ///< Thread-safe cached serialization
+    /// Serialized value of the span access and the smaller page-outs; larger values are
+    /// streamed into the page file without it.
+    mutable std::vector<uint8_t> mSerializedCache;
+    std::vector<uint8_t> mPendingPageOut; ///< Bytes being written by a batched page-out
+    bool mPendingPageOutValid { false };  ///< False once the value changed after PreparePageOut
+    bool mDiskPageCurrent { false };      ///< The disk page holds the current value
+    bool mPersistent { false };           ///< Pages are stored in the persistent page cache
+    std::string mPersistentStage;
     PXR_NS::TfToken mDataType;
 
     const IHdValueSerializer* mSerializer { nullptr }; // nullptr means use default serializer
@@ -289,6 +560,15 @@ private:
 
     // Internal helpers
     void UpdateSerializedCache() const;
+    bool LoadSourceValueFromDisk();
+    /// Writes mSourceValue to the disk page, updated in place if its size did not change.
+    bool WriteDiskPage();
+    /// Size of the page streamed from the value, 0 if it is written from mSerializedCache.
+    size_t GetStreamedPageSize() const;
+    /// Pages in without a staging page, see HdDefaultValueSerializer::DeserializeFromPage.
+    bool ReadsPageInPlace() const noexcept;
+    HdPersistentPageKey MakePersistentPageKey(const std::vector<uint8_t>& page) const;
+    void StorePersistentPage(const std::vector<uint8_t>& page);
 };
 
 struct HVT_API HdContainerPageEntry
@@ -346,6 +626,13 @@ public:
             static_cast<int>(HdBufferState::RendererBuffer))) override;
     bool SwapToSceneMemory(
         bool force = false, HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
+    /// Packed pages are written by SwapSceneToDisk, never by a batched page-out.
+    [[nodiscard]] PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState) override
+    {
+        return {};
+    }
+    /// Packed pages are read by SwapToSceneMemory, never by an asynchronous page-in.
+    [[nodiscard]] const HdBufferPageEntry* PreparePageIn() override { return nullptr; }
 
     bool IsImplicitPagingEnabled() const { return mEnableImplicitPaging; }
 
@@ -421,6 +708,13 @@ public:
             static_cast<int>(HdBufferState::RendererBuffer))) override;
     bool SwapToSceneMemory(
         bool force = false, HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
+    /// Packed pages are written by SwapSceneToDisk, never by a batched page-out.
+    [[nodiscard]] PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState) override
+    {
+        return {};
+    }
+    /// Packed pages are read by SwapToSceneMemory, never by an asynchronous page-in.
+    [[nodiscard]] const HdBufferPageEntry* PreparePageIn() override { return nullptr; }
 
     bool IsImplicitPagingEnabled() const { return mEnableImplicitPaging; }
 
@@ -507,6 +801,10 @@ public:
     /// Get all available sample times. It may trigger implicit paging.
     std::vector<Time> GetAllSampleTimes() const;
 
+    /// Buffers of the sampleCount samples from time on, e.g. to prefetch them.
+    std::vector<std::shared_ptr<HdPageableValue>> GetSampleBuffers(
+        Time time, size_t sampleCount) const;
+
     bool IsImplicitPagingEnabled() const { return mEnableImplicitPaging; }
 
     /// Observability metrics
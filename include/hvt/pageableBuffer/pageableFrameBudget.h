@@ -0,0 +1,111 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace HVT_NS
+{
+
+/// Paging I/O allowed per frame; a zero limit is unlimited.
+struct HdFrameIOBudgetConfig
+{
+    size_t bytesPerFrame = 0; ///< Bytes read or written
+    std::chrono::microseconds timePerFrame { 0 }; ///< Time spent in synchronous paging I/O
+};
+
+/// Paging I/O of the frames, for diagnostics. The deferred counters are totals.
+struct HdFrameIOStats
+{
+    size_t frames               = 0;
+    size_t frameBytes           = 0; ///< Spent in the current frame
+    size_t frameMicroseconds    = 0; ///< Spent in the current frame
+    size_t deferredPageIns      = 0; ///< Implicit page-ins postponed to a later frame
+    size_t deferredPageInBytes  = 0;
+    size_t deferredPageOuts     = 0; ///< Page-outs left to a later crawl
+    size_t deferredPageOutBytes = 0;
+    size_t resumedPageIns       = 0; ///< Postponed page-ins issued in a later frame
+    size_t pendingPageIns       = 0; ///< Postponed page-ins not issued yet
+};
+
+/// Bounds the paging I/O of a frame, so that paging in the data a new view needs or evicting
+/// a large part of the scene does not stall a single frame.
+///
+/// The paging operations reserve their bytes before running and charge their time after; a
+/// reservation fails once the frame has spent its bytes or its time. The first operation of a
+/// frame is always allowed, so a buffer larger than the budget still makes progress. Implicit
+/// page-ins which do not fit are queued, and the data source manager issues them in the next
+/// frames. AdvanceFrame of the buffer manager starts a new frame.
+class HVT_API HdFrameIOBudget
+{
+public:
+    void SetConfig(const HdFrameIOBudgetConfig& config) noexcept;
+    [[nodiscard]] HdFrameIOBudgetConfig GetConfig() const noexcept;
+    [[nodiscard]] bool IsEnabled() const noexcept
+    {
+        return mBytesPerFrame.load(std::memory_order_relaxed) > 0 ||
+            mMicrosecondsPerFrame.load(std::memory_order_relaxed) > 0;
+    }
+
+    /// Starts a new frame with the whole budget available.
+    void BeginFrame() noexcept;
+
+    /// Reserves bytes of I/O in the current frame. Always true while the budget is disabled.
+    [[nodiscard]] bool TryAcquire(size_t bytes) noexcept;
+    /// Time spent by an operation which acquired its bytes.
+    void Charge(std::chrono::microseconds elapsed) noexcept;
+
+    /// Queues the page-in of a buffer to a later frame; the buffer is queued once.
+    void DeferPageIn(const PXR_NS::SdfPath& key, size_t bytes);
+    /// Takes the queued page-ins, oldest first.
+    [[nodiscard]] std::vector<PXR_NS::SdfPath> TakeDeferredPageIns();
+    /// Queues the page-ins taken with TakeDeferredPageIns which still do not fit, in front.
+    void RequeuePageIns(const std::vector<PXR_NS::SdfPath>& keys);
+    void RecordResumedPageIn() noexcept { ++mResumedPageIns; }
+    void RecordDeferredPageOut(size_t bytes) noexcept;
+
+    [[nodiscard]] HdFrameIOStats GetStats() const;
+
+private:
+    std::atomic<size_t> mBytesPerFrame { 0 };
+    std::atomic<int64_t> mMicrosecondsPerFrame { 0 };
+
+    std::atomic<size_t> mFrames { 0 };
+    std::atomic<size_t> mFrameBytes { 0 };
+    std::atomic<int64_t> mFrameMicroseconds { 0 };
+    std::atomic<size_t> mFrameOperations { 0 };
+
+    std::atomic<size_t> mDeferredPageIns { 0 };
+    std::atomic<size_t> mDeferredPageInBytes { 0 };
+    std::atomic<size_t> mDeferredPageOuts { 0 };
+    std::atomic<size_t> mDeferredPageOutBytes { 0 };
+    std::atomic<size_t> mResumedPageIns { 0 };
+
+    mutable std::mutex mQueueMutex; ///< Guards the queued page-ins
+    std::vector<PXR_NS::SdfPath> mQueue;
+    std::unordered_set<PXR_NS::SdfPath, PXR_NS::SdfPath::Hash> mQueued;
+};
+
+} // namespace HVT_NS
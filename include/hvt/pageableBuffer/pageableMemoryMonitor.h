@@ -14,10 +14,18 @@
 #pragma once
 
 #include <hvt/api.h>
+#include <hvt/pageableBuffer/pageableFrameBudget.h>
+#include <hvt/pageableBuffer/pageablePrefetch.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace HVT_NS
 {
@@ -29,6 +37,135 @@ constexpr size_t ONE_GiB = ONE_KiB * ONE_MiB;
 // Helper function to format byte sizes for display
 std::string FormatBytes(size_t bytes);
 
+/// Statistics of one page storage tier (see HdPageFileManager).
+struct HVT_API HdPageTierStats
+{
+    std::filesystem::path directory;
+    size_t capacity      = 0; ///< 0 = unlimited
+    size_t usedBytes     = 0; ///< Bytes allocated in the tier's page files, holes included
+    size_t liveBytes     = 0; ///< Bytes of the pages stored in the tier
+    size_t pageCount     = 0;
+    size_t pageFileCount = 0;
+    size_t spilledBytes  = 0; ///< Bytes stored here because the faster tiers were full
+    size_t migratedBytes = 0; ///< Bytes of cold pages moved out to a slower tier
+    size_t promotedBytes = 0; ///< Bytes of rewritten pages moved in from a slower tier
+};
+
+/// Memory of the system and of the process' cgroup, as read by an IHdSystemMemoryProbe.
+struct HVT_API HdSystemMemoryReading
+{
+    bool hasCgroup         = false; ///< cgroup v2 memory controller found
+    size_t cgroupLimit     = 0;     ///< memory.max, 0 = unlimited
+    size_t cgroupUsage     = 0;     ///< memory.current
+    bool hasMeminfo        = false;
+    size_t totalMemory     = 0;     ///< MemTotal
+    size_t availableMemory = 0;     ///< MemAvailable
+    bool hasPressure       = false; ///< Pressure stall information (PSI) found
+    float stallSome        = 0.0f;  ///< "some avg10": share of the time a task stalled on memory
+    float stallFull        = 0.0f;  ///< "full avg10": share of the time all tasks stalled
+
+    /// Bytes which can still be allocated: the smallest of the cgroup and system headrooms,
+    /// SIZE_MAX when neither is known.
+    [[nodiscard]] size_t GetHeadroom() const;
+};
+
+/// Source of the system memory readings. Tests inject fake readings through it.
+class HVT_API IHdSystemMemoryProbe
+{
+public:
+    virtual ~IHdSystemMemoryProbe() = default;
+
+    /// Reads the current state. Missing sources leave their fields unset.
+    virtual HdSystemMemoryReading Read() = 0;
+};
+
+/// Linux probe reading cgroup v2 `memory.max`, `memory.current` and `memory.pressure` of the
+/// process' cgroup, `/proc/meminfo` and `/proc/pressure/memory`. Elsewhere nothing is found and
+/// the static limits are kept. The roots can be moved, e.g. to a test directory.
+class HVT_API HdSystemMemoryProbe : public IHdSystemMemoryProbe
+{
+public:
+    explicit HdSystemMemoryProbe(std::filesystem::path procRoot = "/proc",
+        std::filesystem::path cgroupRoot = "/sys/fs/cgroup");
+
+    HdSystemMemoryReading Read() override;
+
+private:
+    std::filesystem::path mProcRoot;
+    std::filesystem::path mCgroupRoot;
+};
+
+/// How the scene memory limit follows the system memory (see HdMemoryMonitor).
+struct HVT_API HdSystemMemoryBudget
+{
+    float sceneShare           = 0.5f;            ///< Share of the headroom the scene may use
+    size_t reservedMemory      = 256 * ONE_MiB;   ///< Headroom left to the rest of the system
+    size_t minSceneMemoryLimit = 64 * ONE_MiB;
+    size_t maxSceneMemoryLimit = 0;    ///< 0 = unbounded
+    float stallSaturation      = 0.2f; ///< "some avg10" stall reported as a scene pressure of 1
+    std::chrono::milliseconds refreshInterval { 100 }; ///< Minimal delay between two reads
+};
+
+/// Statistics of one memory pool.
+struct HVT_API HdMemoryPoolStats
+{
+    std::string name;
+    std::string parent; ///< Empty for a top-level pool
+    size_t sceneBudget        = 0; ///< 0 = unlimited
+    size_t usedSceneMemory    = 0; ///< Descendant pools included
+    size_t usedRendererMemory = 0;
+    size_t bufferCount        = 0; ///< Buffers assigned to this pool itself
+};
+
+/// Budgeted share of the memory of a buffer manager, e.g. one stage or one subtree. Pools nest:
+/// the bytes of a pool also count in its ancestors. The counters are lock-free; a pool lives as
+/// long as its memory monitor.
+class HVT_API HdMemoryPool
+{
+public:
+    const std::string& GetName() const noexcept { return mName; }
+    HdMemoryPool* GetParent() const noexcept { return mParent; }
+    /// Depth in the pool hierarchy, 0 for a top-level pool.
+    size_t GetDepth() const noexcept;
+    /// Whether the pool is this pool or one of its ancestors.
+    bool IsWithin(const HdMemoryPool& pool) const noexcept;
+
+    void SetSceneBudget(size_t budget) noexcept { mSceneBudget = budget; }
+    size_t GetSceneBudget() const noexcept { return mSceneBudget; }
+    size_t GetUsedSceneMemory() const noexcept { return mUsedSceneMemory; }
+    size_t GetUsedRendererMemory() const noexcept { return mUsedRendererMemory; }
+    size_t GetBufferCount() const noexcept { return mBufferCount; }
+    /// Used over budget scene memory, 0 without budget.
+    float GetScenePressure() const noexcept;
+    bool IsOverBudget() const noexcept;
+
+    // Memory tracking, also applied to the ancestors.
+    void AddSceneMemory(size_t size) noexcept;
+    void ReduceSceneMemory(size_t size) noexcept;
+    void AddRendererMemory(size_t size) noexcept;
+    void ReduceRendererMemory(size_t size) noexcept;
+    void AddBuffer() noexcept { ++mBufferCount; }
+    void RemoveBuffer() noexcept { --mBufferCount; }
+
+    HdMemoryPoolStats GetStats() const;
+
+private:
+    HdMemoryPool(std::string name, size_t sceneBudget, HdMemoryPool* parent);
+
+    // Disable copy and move
+    HdMemoryPool(const HdMemoryPool&) = delete;
+    HdMemoryPool(HdMemoryPool&&)      = delete;
+
+    const std::string mName;
+    HdMemoryPool* const mParent;
+    std::atomic<size_t> mSceneBudget;
+    std::atomic<size_t> mUsedSceneMemory { 0 };
+    std::atomic<size_t> mUsedRendererMemory { 0 };
+    std::atomic<size_t> mBufferCount { 0 };
+
+    friend class HdMemoryMonitor;
+};
+
 class HVT_API HdMemoryMonitor
 {
 public:
@@ -50,6 +187,36 @@ public:
     float GetSceneMemoryPressure() const;
     float GetRendererMemoryPressure() const;
 
+    // Page storage tiers, fastest first, as reported by the page file manager.
+    std::vector<HdPageTierStats> GetStorageTierStats() const;
+
+    // System memory. With a probe, the scene memory limit is the used scene memory plus
+    // sceneShare of the system headroom above reservedMemory, and the memory stalls raise the
+    // scene pressure; the configured limit is the fallback. Refreshed by the crawls at most
+    // once per refreshInterval; returns whether the probe was read.
+    bool RefreshSystemMemory(bool force = false);
+    bool HasSystemMemoryProbe() const { return mSystemMemoryProbe != nullptr; }
+    HdSystemMemoryReading GetSystemMemoryReading() const;
+    size_t GetConfiguredSceneMemoryLimit() const { return mConfiguredSceneMemoryLimit; }
+    float GetSystemMemoryPressure() const { return mSystemMemoryPressure; }
+
+    // Memory pools. Names are unique; a parent must belong to this monitor. Pools are never
+    // destroyed before the monitor, so buffers may keep pointers to them.
+    HdMemoryPool* CreatePool(
+        const std::string& name, size_t sceneBudget = 0, HdMemoryPool* parent = nullptr);
+    HdMemoryPool* FindPool(const std::string& name) const;
+    /// Pools over their scene budget, deepest first.
+    std::vector<HdMemoryPool*> GetOverBudgetPools() const;
+    std::vector<HdMemoryPoolStats> GetPoolStats() const;
+
+    // Paging I/O budget of a frame, shared by the buffers and the crawls. Disabled by default.
+    HdFrameIOBudget& GetFrameIOBudget() { return mFrameIOBudget; }
+    const HdFrameIOBudget& GetFrameIOBudget() const { return mFrameIOBudget; }
+
+    // Hit rate of the prefetches and buffers paged in together, recorded by the buffers.
+    HdPrefetchHistory& GetPrefetchHistory() { return mPrefetchHistory; }
+    const HdPrefetchHistory& GetPrefetchHistory() const { return mPrefetchHistory; }
+
     // Thresholds (percentages to memory limits)
     static constexpr float LOW_MEMORY_THRESHOLD             = 0.9f;
     static constexpr float RENDERER_PAGING_THRESHOLD        = 0.5f;
@@ -68,12 +235,36 @@ private:
     HdMemoryMonitor(const HdMemoryMonitor&) = delete;
     HdMemoryMonitor(HdMemoryMonitor&&)      = delete;
 
+    // Set once by HdPageableBufferManager, before the monitor is shared.
+    using StorageTierStatsSource = std::function<std::vector<HdPageTierStats>()>;
+    void SetStorageTierStatsSource(StorageTierStatsSource source);
+    void SetSystemMemoryProbe(
+        std::shared_ptr<IHdSystemMemoryProbe> probe, const HdSystemMemoryBudget& budget);
+
     std::atomic<size_t> mUsedSceneMemory { 0 };
     std::atomic<size_t> mUsedRendererMemory { 0 };
 
-    const size_t mSceneMemoryLimit    = static_cast<size_t>(2) * ONE_GiB;
+    const size_t mConfiguredSceneMemoryLimit = static_cast<size_t>(2) * ONE_GiB;
+    std::atomic<size_t> mSceneMemoryLimit { static_cast<size_t>(2) * ONE_GiB };
     const size_t mRendererMemoryLimit = static_cast<size_t>(1) * ONE_GiB;
 
+    StorageTierStatsSource mStorageTierStatsSource;
+
+    std::shared_ptr<IHdSystemMemoryProbe> mSystemMemoryProbe;
+    HdSystemMemoryBudget mSystemMemoryBudget;
+    std::atomic<float> mSystemMemoryPressure { 0.0f };
+    mutable std::mutex mSystemMemoryMutex; ///< Guards the reading and the probe calls
+    HdSystemMemoryReading mSystemMemoryReading;
+    std::chrono::steady_clock::time_point mLastSystemMemoryRefresh;
+    bool mSystemMemoryRead = false;
+
+    mutable std::mutex mPoolMutex; ///< Guards the pool list, not the pool counters
+    std::vector<std::unique_ptr<HdMemoryPool>> mPools;
+    std::atomic<size_t> mPoolCount { 0 }; ///< Skips the lock while there is no pool
+
+    HdFrameIOBudget mFrameIOBudget;
+    HdPrefetchHistory mPrefetchHistory;
+
     template <typename, typename, typename, typename>
     friend class HdPageableBufferManager;
 };
@@ -0,0 +1,117 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace HVT_NS
+{
+
+/// Prefetching of the buffers paged in together.
+struct HdPrefetchConfig
+{
+    bool learnCoAccess       = true; ///< Prefetch the neighbours of the demand page-ins
+    unsigned int minCoAccess = 2;    ///< Frames two buffers were paged in together to be neighbours
+    unsigned int hitWindow   = 16;   ///< Frames a prefetched buffer waits for its first access
+};
+
+/// Prefetch metrics, totals.
+struct HdPrefetchStats
+{
+    size_t requested     = 0; ///< Buffers named by the prefetch hints
+    size_t issued        = 0; ///< Page-ins issued ahead of the accesses
+    size_t learned       = 0; ///< Of which for the neighbours of demand page-ins
+    size_t dropped       = 0; ///< Not issued, beyond the frame I/O budget
+    size_t hits          = 0; ///< Prefetched buffers accessed while resident
+    size_t expired       = 0; ///< Prefetched buffers not accessed within the hit window
+    size_t demandPageIns = 0; ///< Accesses which paged in
+
+    /// Share of the issued prefetches which were hits.
+    [[nodiscard]] float HitRate() const noexcept
+    {
+        return issued > 0 ? static_cast<float>(hits) / static_cast<float>(issued) : 0.0f;
+    }
+};
+
+/// Access history of the prefetches: their hit rate, and the buffers paged in together.
+///
+/// Buffers demand paged in during the same frame, or in consecutive frames, become neighbours
+/// once it happened minCoAccess times. A demand page-in of a buffer then calls the neighbour
+/// callback with its neighbours, which the data source manager prefetches. A prefetched buffer
+/// is a hit if its first access finds it resident within hitWindow frames.
+class HVT_API HdPrefetchHistory
+{
+public:
+    using NeighbourCallback = std::function<void(const std::vector<PXR_NS::SdfPath>&)>;
+
+    void SetConfig(const HdPrefetchConfig& config);
+    [[nodiscard]] HdPrefetchConfig GetConfig() const;
+    void SetNeighbourCallback(NeighbourCallback callback);
+
+    /// Page-in by the first access of a buffer; calls the neighbour callback, if any.
+    void RecordDemandPageIn(const PXR_NS::SdfPath& key);
+    /// Page-in issued ahead of the accesses.
+    void RecordPrefetch(const PXR_NS::SdfPath& key, bool learned);
+    /// First access of a prefetched buffer, while it was resident.
+    void RecordHit(const PXR_NS::SdfPath& key);
+    void RecordRequested(size_t count) noexcept;
+    void RecordDropped() noexcept;
+
+    /// Learns the buffers paged in together and expires the prefetches not accessed in time.
+    void EndFrame();
+
+    /// Neighbours of a buffer, the most paged in together first.
+    [[nodiscard]] std::vector<PXR_NS::SdfPath> GetNeighbours(const PXR_NS::SdfPath& key) const;
+    [[nodiscard]] HdPrefetchStats GetStats() const;
+
+private:
+    static constexpr size_t MAX_FRAME_PAGE_INS = 64; ///< Learned page-ins of a frame
+    static constexpr size_t MAX_NEIGHBOURS     = 8;
+
+    struct Neighbour
+    {
+        PXR_NS::SdfPath key;
+        unsigned int count = 0;
+    };
+
+    void Learn(const PXR_NS::SdfPath& from, const PXR_NS::SdfPath& to);
+    std::vector<PXR_NS::SdfPath> FindNeighbours(const PXR_NS::SdfPath& key) const;
+
+    mutable std::mutex mMutex;
+    HdPrefetchConfig mConfig;
+    NeighbourCallback mNeighbourCallback;
+    unsigned int mFrame = 0;
+
+    std::vector<PXR_NS::SdfPath> mFramePageIns;
+    std::vector<PXR_NS::SdfPath> mPreviousPageIns;
+    std::unordered_map<PXR_NS::SdfPath, std::vector<Neighbour>, PXR_NS::SdfPath::Hash> mNeighbours;
+    /// Prefetched buffers waiting for their first access, with the frame of the prefetch
+    std::unordered_map<PXR_NS::SdfPath, unsigned int, PXR_NS::SdfPath::Hash> mPending;
+
+    std::atomic<size_t> mRequested { 0 };
+    std::atomic<size_t> mDropped { 0 };
+    HdPrefetchStats mStats; ///< The other counters, guarded by mMutex
+};
+
+} // namespace HVT_NS
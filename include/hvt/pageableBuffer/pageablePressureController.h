@@ -0,0 +1,103 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace HVT_NS
+{
+
+/// Tuning of HdPressureController. The pressures are fractions of the memory limit.
+struct HdPressureControllerConfig
+{
+    float targetPressure   = 0.75f; ///< Setpoint of the resident memory
+    float deadband         = 0.02f; ///< Nothing is evicted up to targetPressure + deadband
+    float proportionalGain = 1.0f;  ///< Share of the pressure error evicted at once
+    /// Seconds of the current growth rate added to the pressure, i.e. the derivative gain.
+    float lookahead         = 0.5f;
+    float maxEvictPressure  = 0.25f; ///< Cap of one eviction, in limit fraction
+    float rateSmoothing     = 0.5f;  ///< Weight of the newest rate sample, in (0, 1]
+    std::chrono::milliseconds minInterval { 10 };
+    std::chrono::milliseconds maxInterval { 1000 };
+};
+
+/// Output of one controller update.
+struct HdPressureControlStep
+{
+    size_t bytesToEvict = 0;
+    std::chrono::milliseconds nextInterval { 0 }; ///< Delay until the next update
+};
+
+/// Controller state, for diagnostics.
+struct HdPressureControllerState
+{
+    float pressure          = 0.0f; ///< Last measured pressure
+    float pressureRate      = 0.0f; ///< Smoothed growth, per second, evictions excluded
+    float predictedPressure = 0.0f; ///< pressure + lookahead * pressureRate
+    float error             = 0.0f; ///< predictedPressure - targetPressure
+    float targetPressure    = 0.0f;
+    size_t lastBytesToEvict = 0;
+    size_t bytesEvicted     = 0; ///< Total reported with ReportEvicted
+    size_t updates          = 0;
+    size_t evictions        = 0; ///< Updates which asked for an eviction
+    std::chrono::milliseconds interval { 0 };
+};
+
+/// Feedback controller keeping the resident memory near a setpoint, in place of fixed
+/// pressure thresholds and crawl percentages.
+///
+/// Each update measures the pressure and its rate of change, predicts the pressure a lookahead
+/// later and asks to evict the part above the setpoint (a PD controller). The bytes reported
+/// as evicted are taken out of the rate, so the controller's own evictions do not hide a
+/// growing load. The next update comes sooner while memory grows toward the setpoint and later
+/// while it is steady or falling.
+class HVT_API HdPressureController
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    HdPressureController() = default;
+    explicit HdPressureController(const HdPressureControllerConfig& config);
+
+    /// Measures usedBytes of limitBytes at time now and returns the bytes to evict.
+    HdPressureControlStep Update(size_t usedBytes, size_t limitBytes, Clock::time_point now);
+    HdPressureControlStep Update(size_t usedBytes, size_t limitBytes)
+    {
+        return Update(usedBytes, limitBytes, Clock::now());
+    }
+
+    /// Bytes freed since the last update, by this controller's evictions.
+    void ReportEvicted(size_t bytes);
+
+    /// Forgets the measurements, keeps the configuration.
+    void Reset();
+
+    void SetConfig(const HdPressureControllerConfig& config);
+    [[nodiscard]] HdPressureControllerConfig GetConfig() const;
+    [[nodiscard]] HdPressureControllerState GetState() const;
+
+private:
+    mutable std::mutex mMutex;
+    HdPressureControllerConfig mConfig;
+    HdPressureControllerState mState;
+    Clock::time_point mLastUpdate;
+    size_t mEvictedSinceUpdate = 0;
+    bool mHasSample            = false;
+};
+
+} // namespace HVT_NS
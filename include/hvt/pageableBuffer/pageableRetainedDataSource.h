@@ -86,6 +86,11 @@ public:
             static_cast<int>(HdBufferState::RendererBuffer))) override;
     bool SwapToSceneMemory(
         bool force = false, HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
+    /// Packed pages are written by SwapSceneToDisk, never by a batched page-out.
+    [[nodiscard]] PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState) override
+    {
+        return {};
+    }
 
     bool IsImplicitPagingEnabled() const { return mEnableImplicitPaging; }
 
@@ -172,6 +177,11 @@ public:
             static_cast<int>(HdBufferState::RendererBuffer))) override;
     bool SwapToSceneMemory(
         bool force = false, HdBufferState releaseBuffer = HdBufferState::DiskBuffer) override;
+    /// Packed pages are written by SwapSceneToDisk, never by a batched page-out.
+    [[nodiscard]] PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState) override
+    {
+        return {};
+    }
 
     bool IsImplicitPagingEnabled() const { return mEnableImplicitPaging; }
 
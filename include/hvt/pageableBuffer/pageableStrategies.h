@@ -14,13 +14,19 @@
 #pragma once
 
 #include <hvt/api.h>
+#include <hvt/pageableBuffer/pageableAccessIndex.h>
 #include <hvt/pageableBuffer/pageableBuffer.h>
 #include <hvt/pageableBuffer/pageableMemoryMonitor.h>
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace HVT_NS
@@ -86,14 +92,39 @@ struct HVT_API HybridStrategy
         const HdPageableBufferCore& buffer, const HdPagingContext& context) const;
 };
 
+// Decisions of a paging strategy for the buffers of a crawl, the buffer age of the context set
+// for each buffer.
+template <typename PagingStrategyType>
+std::vector<HdPagingDecision> MakePagingDecisions(PagingStrategyType& strategy,
+    const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers, unsigned int currentFrame,
+    HdPagingContext context)
+{
+    std::vector<HdPagingDecision> decisions;
+    decisions.reserve(buffers.size());
+    for (const auto& buffer : buffers)
+    {
+        context.bufferAge =
+            currentFrame > buffer->FrameStamp() ? currentFrame - buffer->FrameStamp() : 0;
+        decisions.push_back(strategy(*buffer, context));
+    }
+    return decisions;
+}
+
 // Buffer Selection Strategies ////////////////////////////////////////////////
 
 // NOTE: Inline template ops; omit HVT_API (MSVC C2491).
+// Strategies which can also select from the access index of the buffer manager (buffers ordered
+// by frame stamp) are called with it, and visit only the buffers they select.
 struct LRUSelectionStrategy
 {
     template <typename InputIterator>
     std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
         InputIterator first, InputIterator last, const HdSelectionContext& context) const;
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        const HdBufferAccessIndex& accessIndex, const HdSelectionContext& context) const
+    {
+        return accessIndex.SelectOldest(context.requestedCount);
+    }
 };
 
 struct FIFOSelectionStrategy
@@ -108,6 +139,11 @@ struct OldestFirstSelectionStrategy
     template <typename InputIterator>
     std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
         InputIterator first, InputIterator last, const HdSelectionContext& context) const;
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        const HdBufferAccessIndex& accessIndex, const HdSelectionContext& context) const
+    {
+        return accessIndex.SelectOldest(context.requestedCount);
+    }
 };
 
 struct LargestFirstSelectionStrategy
@@ -117,7 +153,190 @@ struct LargestFirstSelectionStrategy
         InputIterator first, InputIterator last, const HdSelectionContext& context) const;
 };
 
+// Scan-resistant Buffer Selection Strategies /////////////////////////////////
+// An orbit sweeping across the model once touches every buffer a single time; these strategies
+// keep the buffers used again (frequency) ahead of the buffers used recently (recency), so such
+// a scan does not evict the working set. Their state lives in a replacement policy shared by
+// the copies of a strategy. Each call visits all given buffers to observe the accesses since
+// the previous call (access count and frame stamp), and selects only buffers holding scene or
+// renderer memory. Buffers left out of a call are forgotten.
+
+/// Replacement state common to the scan-resistant strategies: per buffer entries kept on up to
+/// four lists, the first two for buffers holding memory, the others for evicted buffers whose
+/// history is kept (ghosts).
+class HVT_API ReplacementPolicy
+{
+public:
+    ReplacementPolicy() = default;
+    virtual ~ReplacementPolicy();
+
+    /// Replays the accesses since the previous call, oldest first, then selects up to
+    /// context.requestedCount buffers holding memory, first victim first. The selected buffers
+    /// are considered evicted; the ones still holding memory at the next call are restored.
+    std::vector<std::shared_ptr<HdPageableBufferCore>> Select(
+        const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        const HdSelectionContext& context);
+
+    /// Buffers with an entry, ghosts included.
+    size_t GetTrackedCount() const;
+
+protected:
+    using BufferId                   = const HdPageableBufferCore*;
+    static constexpr int NO_LIST     = -1;
+    static constexpr int LIST_COUNT  = 4;
+    static constexpr int GHOST_LISTS = 2; ///< Lists from this index on hold evicted buffers
+
+    struct Entry
+    {
+        std::weak_ptr<HdPageableBufferCore> handle;
+        unsigned int accessCount = 0; ///< Access count at the previous call
+        unsigned int epoch       = 0; ///< Last call which saw the buffer
+        int list                 = NO_LIST;
+        std::list<BufferId>::iterator position;
+        unsigned int weight = 0; ///< Reference bits or counter, up to the policy
+        bool flag           = false;
+    };
+
+    /// The buffer was accessed `references` times since the previous call.
+    virtual void OnAccess(BufferId id, Entry& entry, unsigned int references) = 0;
+    /// The buffer is on a resident list but released its memory without being selected.
+    virtual void OnReleased(BufferId id, Entry& entry) = 0;
+    /// The buffer holds memory again without having been accessed.
+    virtual void OnRestored(BufferId id, Entry& entry) = 0;
+    /// Picks up to count victims from the resident lists, moving them off these lists.
+    virtual void SelectVictims(size_t count, std::vector<BufferId>& victims) = 0;
+
+    // List helpers; the front of a list is its oldest entry.
+    void MoveToBack(BufferId id, Entry& entry, int list);
+    void MoveToFront(BufferId id, Entry& entry, int list);
+    void Unlink(Entry& entry);
+    size_t ListSize(int list) const { return mLists[list].size(); }
+    BufferId Front(int list) const { return mLists[list].front(); }
+    Entry& GetEntry(BufferId id) { return mEntries.at(id); }
+
+    size_t mCapacity = 0; ///< Buffers holding memory, as of the current call
+
+private:
+    // Disable copy and move
+    ReplacementPolicy(const ReplacementPolicy&) = delete;
+    ReplacementPolicy(ReplacementPolicy&&)      = delete;
+
+    mutable std::mutex mMutex;
+    std::unordered_map<BufferId, Entry> mEntries;
+    std::array<std::list<BufferId>, LIST_COUNT> mLists;
+    unsigned int mEpoch = 0;
+};
+
+/// CLOCK-Pro: resident buffers are cold or hot. A cold buffer referenced again while in its
+/// test period becomes hot, the hot hand demotes hot buffers not referenced since its last pass.
+/// Evicted cold buffers stay in test as ghosts, a reload during the test grows the cold share.
+class HVT_API ClockProPolicy final : public ReplacementPolicy
+{
+private:
+    enum List
+    {
+        Cold,
+        Hot,
+        Test
+    };
+
+    void OnAccess(BufferId id, Entry& entry, unsigned int references) override;
+    void OnReleased(BufferId id, Entry& entry) override;
+    void OnRestored(BufferId id, Entry& entry) override;
+    void SelectVictims(size_t count, std::vector<BufferId>& victims) override;
+
+    void RunHotHand();
+    void TrimTest();
+
+    size_t mColdTarget = 0; ///< Resident cold buffers aimed for, 0 until the first selection
+};
+
+/// ARC: T1 holds the buffers referenced once, T2 the buffers referenced again; B1 and B2 remember
+/// the buffers evicted from each. A reload of a B1 ghost grows the target size of T1, a reload
+/// of a B2 ghost shrinks it.
+class HVT_API ArcPolicy final : public ReplacementPolicy
+{
+private:
+    enum List
+    {
+        T1,
+        T2,
+        B1,
+        B2
+    };
+
+    void OnAccess(BufferId id, Entry& entry, unsigned int references) override;
+    void OnReleased(BufferId id, Entry& entry) override;
+    void OnRestored(BufferId id, Entry& entry) override;
+    void SelectVictims(size_t count, std::vector<BufferId>& victims) override;
+
+    void TrimGhosts();
+
+    double mTargetT1  = 0.0;
+    bool mLastHitInB2 = false;
+};
+
+/// 2Q: new buffers enter the A1in FIFO, buffers referenced again move to the Am LRU. Buffers
+/// evicted from A1in are remembered in A1out and go to Am when reloaded. A1in is evicted first
+/// while above a quarter of the resident buffers.
+class HVT_API TwoQueuePolicy final : public ReplacementPolicy
+{
+private:
+    enum List
+    {
+        A1In,
+        Am,
+        A1Out
+    };
+
+    void OnAccess(BufferId id, Entry& entry, unsigned int references) override;
+    void OnReleased(BufferId id, Entry& entry) override;
+    void OnRestored(BufferId id, Entry& entry) override;
+    void SelectVictims(size_t count, std::vector<BufferId>& victims) override;
+
+    void TrimA1Out();
+};
+
+// NOTE: Inline template ops; omit HVT_API (MSVC C2491).
+struct ClockProSelectionStrategy
+{
+    template <typename InputIterator>
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        InputIterator first, InputIterator last, const HdSelectionContext& context) const;
+
+    std::shared_ptr<ClockProPolicy> policy = std::make_shared<ClockProPolicy>();
+};
+
+struct ArcSelectionStrategy
+{
+    template <typename InputIterator>
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        InputIterator first, InputIterator last, const HdSelectionContext& context) const;
+
+    std::shared_ptr<ArcPolicy> policy = std::make_shared<ArcPolicy>();
+};
+
+struct TwoQueueSelectionStrategy
+{
+    template <typename InputIterator>
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        InputIterator first, InputIterator last, const HdSelectionContext& context) const;
+
+    std::shared_ptr<TwoQueuePolicy> policy = std::make_shared<TwoQueuePolicy>();
+};
+
 // Buffer Selection Strategies Implementation /////////////////////////////////
+
+// True for map values, whose buffer is the second member.
+template <typename T, typename = void>
+struct IsKeyValuePair : std::false_type
+{
+};
+template <typename T>
+struct IsKeyValuePair<T, std::void_t<typename T::second_type>> : std::true_type
+{
+};
+
 // Helper function to extract non-null values from iterator pairs.
 template <typename InputIterator>
 std::vector<std::shared_ptr<HdPageableBufferCore>> GetValidBuffers(InputIterator first,
@@ -129,9 +348,8 @@ std::vector<std::shared_ptr<HdPageableBufferCore>> GetValidBuffers(InputIterator
         auto buffer = [&]() -> std::shared_ptr<HdPageableBufferCore>
         {
             // Handle both container iterators and map iterators
-            if constexpr (std::is_same_v<
-                              typename std::iterator_traits<InputIterator>::value_type::second_type,
-                              std::shared_ptr<HdPageableBufferCore>>)
+            if constexpr (IsKeyValuePair<
+                              typename std::iterator_traits<InputIterator>::value_type>::value)
             {
                 return it->second; // Map iterator
             }
@@ -218,6 +436,210 @@ std::vector<std::shared_ptr<HdPageableBufferCore>> LargestFirstSelectionStrategy
     return validBuffers;
 }
 
+template <typename InputIterator>
+std::vector<std::shared_ptr<HdPageableBufferCore>> ClockProSelectionStrategy::operator()(
+    InputIterator first, InputIterator last, const HdSelectionContext& context) const
+{
+    return policy->Select(GetValidBuffers(first, last), context);
+}
+
+template <typename InputIterator>
+std::vector<std::shared_ptr<HdPageableBufferCore>> ArcSelectionStrategy::operator()(
+    InputIterator first, InputIterator last, const HdSelectionContext& context) const
+{
+    return policy->Select(GetValidBuffers(first, last), context);
+}
+
+template <typename InputIterator>
+std::vector<std::shared_ptr<HdPageableBufferCore>> TwoQueueSelectionStrategy::operator()(
+    InputIterator first, InputIterator last, const HdSelectionContext& context) const
+{
+    return policy->Select(GetValidBuffers(first, last), context);
+}
+
+// Runtime-selectable Strategies //////////////////////////////////////////////
+// Hold one of the strategies above behind a virtual interface, so it can be replaced while the
+// buffer manager runs (Set), e.g. from ConservativeStrategy to PressureBasedStrategy when a
+// second model is loaded. The buffer manager calls them once per crawl: the paging strategy
+// decides for all the selected buffers in one call, and the selection strategy selects from the
+// access index. A replacement takes effect on the next crawl. Copies of a holder share the
+// strategy, like the scan-resistant strategies share their policy.
+
+// NOTE: Inline template ops; omit HVT_API (MSVC C2491).
+class RuntimePagingStrategy
+{
+public:
+    /// Starts with HybridStrategy.
+    RuntimePagingStrategy() { Set(HybridStrategy {}); }
+
+    template <typename PagingStrategyType>
+    void Set(PagingStrategyType strategy)
+    {
+        std::shared_ptr<const Interface> model =
+            std::make_shared<const Model<PagingStrategyType>>(std::move(strategy));
+        std::lock_guard<std::mutex> lock(mSlot->mutex);
+        mSlot->strategy = std::move(model);
+    }
+
+    template <typename PagingStrategyType>
+    [[nodiscard]] bool Holds() const
+    {
+        return dynamic_cast<const Model<PagingStrategyType>*>(Get().get()) != nullptr;
+    }
+
+    HdPagingDecision operator()(
+        const HdPageableBufferCore& buffer, const HdPagingContext& context) const
+    {
+        return Get()->Decide(buffer, context);
+    }
+    std::vector<HdPagingDecision> operator()(
+        const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+        unsigned int currentFrame, const HdPagingContext& context) const
+    {
+        return Get()->DecideAll(buffers, currentFrame, context);
+    }
+
+private:
+    struct Interface
+    {
+        virtual ~Interface() = default;
+        virtual HdPagingDecision Decide(
+            const HdPageableBufferCore& buffer, const HdPagingContext& context) const = 0;
+        virtual std::vector<HdPagingDecision> DecideAll(
+            const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+            unsigned int currentFrame, const HdPagingContext& context) const = 0;
+    };
+
+    template <typename PagingStrategyType>
+    struct Model final : Interface
+    {
+        explicit Model(PagingStrategyType strategy) : strategy(std::move(strategy)) {}
+
+        HdPagingDecision Decide(
+            const HdPageableBufferCore& buffer, const HdPagingContext& context) const override
+        {
+            return strategy(buffer, context);
+        }
+        std::vector<HdPagingDecision> DecideAll(
+            const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+            unsigned int currentFrame, const HdPagingContext& context) const override
+        {
+            return MakePagingDecisions(strategy, buffers, currentFrame, context);
+        }
+
+        mutable PagingStrategyType strategy;
+    };
+
+    struct Slot
+    {
+        std::mutex mutex;
+        std::shared_ptr<const Interface> strategy;
+    };
+
+    std::shared_ptr<const Interface> Get() const
+    {
+        std::lock_guard<std::mutex> lock(mSlot->mutex);
+        return mSlot->strategy;
+    }
+
+    std::shared_ptr<Slot> mSlot = std::make_shared<Slot>();
+};
+
+/// Selection strategy replaceable at runtime. The strategies which select from the access index
+/// (LRU, OldestFirst) visit only the buffers they select. The others (FIFO, LargestFirst,
+/// ClockPro, Arc, TwoQueue) need all the buffers: each selection copies every buffer of the
+/// index, under its mutex, which is O(n) per crawl like with these strategies held statically.
+class RuntimeSelectionStrategy
+{
+public:
+    /// Starts with LRUSelectionStrategy.
+    RuntimeSelectionStrategy() { Set(LRUSelectionStrategy {}); }
+
+    template <typename BufferSelectionStrategyType>
+    void Set(BufferSelectionStrategyType strategy)
+    {
+        std::shared_ptr<const Interface> model =
+            std::make_shared<const Model<BufferSelectionStrategyType>>(std::move(strategy));
+        std::lock_guard<std::mutex> lock(mSlot->mutex);
+        mSlot->strategy = std::move(model);
+    }
+
+    template <typename BufferSelectionStrategyType>
+    [[nodiscard]] bool Holds() const
+    {
+        return dynamic_cast<const Model<BufferSelectionStrategyType>*>(Get().get()) != nullptr;
+    }
+
+    template <typename InputIterator>
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        InputIterator first, InputIterator last, const HdSelectionContext& context) const
+    {
+        return Get()->Select(GetValidBuffers(first, last), context);
+    }
+    /// Strategies which cannot select from the access index are given all its buffers: O(n).
+    std::vector<std::shared_ptr<HdPageableBufferCore>> operator()(
+        const HdBufferAccessIndex& accessIndex, const HdSelectionContext& context) const
+    {
+        return Get()->Select(accessIndex, context);
+    }
+
+private:
+    struct Interface
+    {
+        virtual ~Interface() = default;
+        virtual std::vector<std::shared_ptr<HdPageableBufferCore>> Select(
+            const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+            const HdSelectionContext& context) const = 0;
+        virtual std::vector<std::shared_ptr<HdPageableBufferCore>> Select(
+            const HdBufferAccessIndex& accessIndex, const HdSelectionContext& context) const = 0;
+    };
+
+    template <typename BufferSelectionStrategyType>
+    struct Model final : Interface
+    {
+        explicit Model(BufferSelectionStrategyType strategy) : strategy(std::move(strategy)) {}
+
+        std::vector<std::shared_ptr<HdPageableBufferCore>> Select(
+            const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+            const HdSelectionContext& context) const override
+        {
+            return strategy(buffers.begin(), buffers.end(), context);
+        }
+        std::vector<std::shared_ptr<HdPageableBufferCore>> Select(
+            const HdBufferAccessIndex& accessIndex,
+            const HdSelectionContext& context) const override
+        {
+            if constexpr (std::is_invocable_r_v<std::vector<std::shared_ptr<HdPageableBufferCore>>,
+                              BufferSelectionStrategyType&, const HdBufferAccessIndex&,
+                              const HdSelectionContext&>)
+            {
+                return strategy(accessIndex, context);
+            }
+            else
+            {
+                // Copies all the buffers, see the class comment.
+                return Select(accessIndex.SelectOldest(accessIndex.Size()), context);
+            }
+        }
+
+        mutable BufferSelectionStrategyType strategy;
+    };
+
+    struct Slot
+    {
+        std::mutex mutex;
+        std::shared_ptr<const Interface> strategy;
+    };
+
+    std::shared_ptr<const Interface> Get() const
+    {
+        std::lock_guard<std::mutex> lock(mSlot->mutex);
+        return mSlot->strategy;
+    }
+
+    std::shared_ptr<Slot> mSlot = std::make_shared<Slot>();
+};
+
 } // namespace HdPagingStrategies
 
 } // namespace HVT_NS
\ No newline at end of file
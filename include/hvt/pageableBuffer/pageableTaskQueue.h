@@ -0,0 +1,131 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace HVT_NS
+{
+
+/// Priority of an asynchronous paging operation, most urgent first.
+enum class HdPagingPriority : uint8_t
+{
+    OnDemand,   ///< Page-ins of data needed now (default of the page-ins)
+    Prefetch,   ///< Page-ins of data needed soon, e.g. decided by a crawl
+    Eviction,   ///< Page-outs and releases (default of the page-outs)
+    Background, ///< Page file compaction and migration
+};
+constexpr size_t HD_PAGING_PRIORITY_COUNT = 4;
+
+/// Outcome of an asynchronous paging operation. Converts to true when the operation succeeded,
+/// so it reads like the bool of the synchronous operations.
+class HdPagingResult
+{
+public:
+    enum class Status : uint8_t
+    {
+        Failed,
+        Succeeded,
+        Cancelled, ///< Cancelled before it started, nothing was done
+    };
+
+    constexpr HdPagingResult(bool succeeded = false) noexcept :
+        mStatus(succeeded ? Status::Succeeded : Status::Failed)
+    {
+    }
+    [[nodiscard]] static constexpr HdPagingResult Cancelled() noexcept
+    {
+        HdPagingResult result;
+        result.mStatus = Status::Cancelled;
+        return result;
+    }
+
+    [[nodiscard]] constexpr Status GetStatus() const noexcept { return mStatus; }
+    [[nodiscard]] constexpr bool IsCancelled() const noexcept
+    {
+        return mStatus == Status::Cancelled;
+    }
+    constexpr operator bool() const noexcept { return mStatus == Status::Succeeded; }
+
+private:
+    Status mStatus;
+};
+
+using HdPagingFuture = std::future<HdPagingResult>;
+
+/// Cancels the asynchronous operations it was given to. Copies share the cancellation.
+/// An operation checks its token when it starts: a cancelled operation does nothing and its
+/// future reports HdPagingResult::Status::Cancelled; a running one completes.
+class HVT_API HdPagingCancellationToken
+{
+public:
+    HdPagingCancellationToken();
+
+    void Cancel() noexcept;
+    [[nodiscard]] bool IsCancelled() const noexcept;
+
+private:
+    std::shared_ptr<std::atomic<bool>> mCancelled;
+};
+
+/// Options of an asynchronous paging operation.
+struct HdPagingTaskOptions
+{
+    /// Empty = the default of the operation (see HdPagingPriority).
+    std::optional<HdPagingPriority> priority;
+    std::optional<HdPagingCancellationToken> cancellation;
+
+    [[nodiscard]] HdPagingPriority GetPriority(HdPagingPriority fallback) const noexcept
+    {
+        return priority.value_or(fallback);
+    }
+    [[nodiscard]] bool IsCancelled() const noexcept
+    {
+        return cancellation && cancellation->IsCancelled();
+    }
+};
+
+/// Start order of the asynchronous paging operations: the most urgent queued step runs first,
+/// in submission order within a priority. The buffer manager schedules one task per step
+/// pushed, and each task runs the next step, so the steps which wait the longest are the least
+/// urgent ones.
+class HVT_API HdPagingTaskQueue
+{
+public:
+    using Step = std::function<void()>;
+
+    void Push(HdPagingPriority priority, Step step);
+    /// Runs the most urgent step. Returns false if the queue was empty.
+    bool RunNext();
+
+    [[nodiscard]] size_t GetQueuedCount(HdPagingPriority priority) const;
+    [[nodiscard]] size_t GetQueuedCount() const;
+
+private:
+    mutable std::mutex mMutex;
+    std::array<std::deque<Step>, HD_PAGING_PRIORITY_COUNT> mQueues;
+};
+
+} // namespace HVT_NS
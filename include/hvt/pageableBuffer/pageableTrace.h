@@ -0,0 +1,150 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace HVT_NS
+{
+
+class HdPageableBufferCore;
+
+/// Events of a paging trace.
+enum class HdPagingTraceEvent : uint8_t
+{
+    Create  = 1, ///< First event of a buffer: size, usage and residency
+    Access  = 2, ///< UpdateFrameStamp, with the residency at that time
+    PageIn  = 3, ///< Scene or renderer memory filled from the disk page: bytes
+    PageOut = 4, ///< Last memory copy released, the data left on disk: bytes
+    Remove  = 5, ///< Buffer removed from the manager or destroyed
+    Frame   = 6, ///< AdvanceFrame: the new current frame
+    Crawl   = 7, ///< FreeCrawl: the crawl percentage, in hundredths
+};
+
+struct HdPagingTraceRecord
+{
+    static constexpr uint8_t RESIDENT = 1 << 0; ///< Holds scene or renderer memory
+    static constexpr uint8_t DYNAMIC  = 1 << 1; ///< HdBufferUsage::Dynamic
+
+    HdPagingTraceEvent event = HdPagingTraceEvent::Frame;
+    uint8_t flags            = 0;
+    uint32_t buffer          = 0; ///< Buffer id, numbered in order of appearance
+    uint64_t value           = 0; ///< Size, bytes, frame or crawl percentage
+};
+
+/// Buffer manager settings the trace was recorded with, the defaults of the replay.
+struct HdPagingTraceHeader
+{
+    size_t sceneMemoryLimit    = 0;
+    size_t rendererMemoryLimit = 0;
+    int ageLimit               = 0;
+    unsigned int startFrame    = 0;
+};
+
+/// Event counts of a recorder since Start.
+struct HdPagingTraceStats
+{
+    size_t records       = 0;
+    size_t accesses      = 0;
+    size_t hits          = 0; ///< Accesses to buffers holding memory
+    size_t pageIns       = 0;
+    size_t pageOuts      = 0;
+    size_t bytesPagedIn  = 0;
+    size_t bytesPagedOut = 0;
+    size_t traceBytes    = 0; ///< Size of the trace written so far
+};
+
+/// Records the paging events of a buffer manager into a compact binary trace.
+///
+/// A record is one byte holding the event and its flags followed by LEB128 varints, so most
+/// accesses take 2 to 4 bytes. Buffers are numbered in order of appearance: a buffer seen for
+/// the first time (including the buffers already existing when the recording starts) gets a
+/// Create record first. The records are buffered and written in blocks. Thread-safe; when not
+/// recording, the events cost one atomic load.
+class HVT_API HdPagingTraceRecorder
+{
+public:
+    HdPagingTraceRecorder() = default;
+    ~HdPagingTraceRecorder();
+
+    /// Starts a new trace at path, replacing the file. An empty path only counts the events
+    /// (GetStats), which the replay uses to measure the simulated paging.
+    bool Start(const std::filesystem::path& path, const HdPagingTraceHeader& header);
+    /// Flushes and closes the trace.
+    void Stop();
+    [[nodiscard]] bool IsRecording() const noexcept
+    {
+        return mRecording.load(std::memory_order_relaxed);
+    }
+
+    void RecordAccess(const HdPageableBufferCore& buffer) noexcept;
+    void RecordPaging(
+        HdPagingTraceEvent event, const HdPageableBufferCore& buffer, size_t bytes) noexcept;
+    void RecordRemove(const HdPageableBufferCore& buffer) noexcept;
+    void RecordFrame(unsigned int frame) noexcept;
+    void RecordCrawl(float percentage) noexcept;
+
+    [[nodiscard]] HdPagingTraceStats GetStats() const;
+
+private:
+    // Disable copy and move
+    HdPagingTraceRecorder(const HdPagingTraceRecorder&) = delete;
+    HdPagingTraceRecorder(HdPagingTraceRecorder&&)      = delete;
+
+    // Caller holds mMutex.
+    uint32_t GetBufferId(const HdPageableBufferCore& buffer);
+    void Write(HdPagingTraceEvent event, uint8_t flags);
+    void WriteVarint(uint64_t value);
+    void Flush();
+
+    std::atomic<bool> mRecording { false };
+    mutable std::mutex mMutex;
+    std::ofstream mFile;
+    std::vector<uint8_t> mPending;
+    std::unordered_map<const HdPageableBufferCore*, uint32_t> mBufferIds;
+    uint32_t mNextBufferId = 0;
+    HdPagingTraceStats mStats;
+};
+
+/// Reads a trace written by HdPagingTraceRecorder, one record at a time.
+class HVT_API HdPagingTraceReader
+{
+public:
+    explicit HdPagingTraceReader(const std::filesystem::path& path);
+
+    /// False when the file is missing or is not a paging trace.
+    [[nodiscard]] bool IsValid() const noexcept { return mValid; }
+    [[nodiscard]] const HdPagingTraceHeader& GetHeader() const noexcept { return mHeader; }
+
+    /// Reads the next record. False at the end of the trace or on a truncated record.
+    bool Next(HdPagingTraceRecord& record);
+
+private:
+    bool ReadVarint(uint64_t& value);
+
+    std::ifstream mFile;
+    HdPagingTraceHeader mHeader;
+    bool mValid = false;
+};
+
+} // namespace HVT_NS
@@ -0,0 +1,217 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+#include <hvt/pageableBuffer/pageableBuffer.h>
+#include <hvt/pageableBuffer/pageableBufferManager.h>
+#include <hvt/pageableBuffer/pageableMemoryMonitor.h>
+#include <hvt/pageableBuffer/pageableTrace.h>
+
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace HVT_NS
+{
+
+/// Options of a trace replay. The defaults keep the recorded settings.
+struct HdPagingReplayConfig
+{
+    float freeCrawlPercentage  = 0.0f;  ///< Percentage of the crawls, 0 = the recorded ones
+    bool crawlEachFrame        = false; ///< Also crawl after each frame
+    int ageLimit               = -1;    ///< Negative = the recorded age limit
+    size_t sceneMemoryLimit    = 0;     ///< 0 = the recorded limit
+    size_t rendererMemoryLimit = 0;     ///< 0 = the recorded limit
+    std::filesystem::path pageFileDirectory =
+        std::filesystem::temp_directory_path() / "hvt_trace_replay"; ///< No page is written
+};
+
+struct HdPagingReplayStats
+{
+    size_t buffers           = 0;
+    size_t frames            = 0;
+    size_t crawls            = 0;
+    size_t accesses          = 0;
+    size_t hits              = 0; ///< Accesses to buffers holding scene or renderer memory
+    size_t pageIns           = 0;
+    size_t pageOuts          = 0;
+    size_t bytesPagedIn      = 0;
+    size_t bytesPagedOut     = 0;
+    size_t peakResidentBytes = 0;
+
+    [[nodiscard]] double HitRate() const
+    {
+        return accesses > 0 ? static_cast<double>(hits) / static_cast<double>(accesses) : 0.0;
+    }
+    [[nodiscard]] size_t BytesMoved() const { return bytesPagedIn + bytesPagedOut; }
+};
+
+/// Statistics of the recorded run, from the trace alone. The resident bytes are the sizes of
+/// the buffers holding memory.
+HVT_API HdPagingReplayStats SummarizePagingTrace(const std::filesystem::path& tracePath);
+
+/// Stands in for a traced buffer during a replay: it has the size and usage of the original
+/// buffer, and its paging operations only update its state and the memory monitor. The disk
+/// page is a placeholder which is never read or written.
+class HVT_API HdReplayBuffer : public HdPageableBufferBase<PXR_NS::SdfPath>
+{
+public:
+    HdReplayBuffer(const PXR_NS::SdfPath& key, size_t size, HdBufferUsage usage, bool resident,
+        const std::unique_ptr<HdPageFileManager>& pageFileManager,
+        const std::unique_ptr<HdMemoryMonitor>& memoryMonitor);
+    ~HdReplayBuffer() override;
+
+    [[nodiscard]] bool PageToSceneMemory(bool force = false) override;
+    [[nodiscard]] bool PageToRendererMemory(bool force = false) override;
+    [[nodiscard]] bool PageToDisk(bool force = false) override;
+
+    // Keeps the buffer manager on the individual paging operations above.
+    [[nodiscard]] PXR_NS::TfSpan<const std::byte> PreparePageOut(HdBufferState source) override;
+    [[nodiscard]] const HdBufferPageEntry* PreparePageIn() override;
+
+    void ReleaseDiskPage() noexcept override;
+};
+
+/// Replays a paging trace against the strategies of BufferManagerType without I/O: the traced
+/// buffers are replaced by HdReplayBuffer, accesses to paged out buffers page them in, and the
+/// recorded crawls run the strategies of the buffer manager. The recorded page-ins and
+/// page-outs are ignored, the ones of the strategies are counted instead.
+template <typename BufferManagerType>
+HdPagingReplayStats ReplayPagingTrace(
+    const std::filesystem::path& tracePath, const HdPagingReplayConfig& config = {})
+{
+    static_assert(std::is_same_v<typename BufferManagerType::KeyTypeAlias, PXR_NS::SdfPath>,
+        "The replay buffers use SdfPath keys");
+
+    HdPagingReplayStats stats;
+    HdPagingTraceReader reader(tracePath);
+    if (!reader.IsValid())
+    {
+        return stats;
+    }
+    const HdPagingTraceHeader& header = reader.GetHeader();
+
+    typename BufferManagerType::InitializeDesc desc;
+    desc.pageFileDirectory   = config.pageFileDirectory;
+    desc.ageLimit            = config.ageLimit >= 0 ? config.ageLimit : header.ageLimit;
+    desc.sceneMemoryLimit    = config.sceneMemoryLimit > 0 ? config.sceneMemoryLimit
+                                                           : header.sceneMemoryLimit;
+    desc.rendererMemoryLimit = config.rendererMemoryLimit > 0 ? config.rendererMemoryLimit
+                                                              : header.rendererMemoryLimit;
+    BufferManagerType bufferManager(desc);
+    bufferManager.AdvanceFrame(header.startFrame);
+
+    // A trace without file counts the page-ins and page-outs of the replay.
+    bufferManager.StartTrace({});
+    const auto& memoryMonitor = bufferManager.GetMemoryMonitor();
+
+    // Indexed by buffer id, released before the buffer manager.
+    std::vector<std::shared_ptr<HdReplayBuffer>> buffers;
+    float crawlPercentage =
+        config.freeCrawlPercentage > 0.0f ? config.freeCrawlPercentage : 10.0f;
+
+    HdPagingTraceRecord record;
+    while (reader.Next(record))
+    {
+        const bool known = record.buffer < buffers.size() && buffers[record.buffer];
+        switch (record.event)
+        {
+        case HdPagingTraceEvent::Create:
+        {
+            if (record.buffer >= buffers.size())
+            {
+                buffers.resize(static_cast<size_t>(record.buffer) + 1);
+            }
+            const PXR_NS::SdfPath key("/Replay/Buffer" + std::to_string(record.buffer));
+            auto buffer = std::make_shared<HdReplayBuffer>(key, static_cast<size_t>(record.value),
+                (record.flags & HdPagingTraceRecord::DYNAMIC) ? HdBufferUsage::Dynamic
+                                                              : HdBufferUsage::Static,
+                (record.flags & HdPagingTraceRecord::RESIDENT) != 0,
+                bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor());
+            bufferManager.AddBuffer(key, buffer);
+            buffers[record.buffer] = std::move(buffer);
+            ++stats.buffers;
+            break;
+        }
+        case HdPagingTraceEvent::Access:
+            if (known)
+            {
+                HdReplayBuffer& buffer = *buffers[record.buffer];
+                buffer.UpdateFrameStamp(bufferManager.GetCurrentFrame());
+                ++stats.accesses;
+                if (buffer.HasSceneBuffer() || buffer.HasRendererBuffer())
+                {
+                    ++stats.hits;
+                }
+                else
+                {
+                    // The application reads the data it stamps.
+                    (void)buffer.SwapToSceneMemory(true);
+                }
+            }
+            break;
+        case HdPagingTraceEvent::Remove:
+            if (known)
+            {
+                bufferManager.RemoveBuffer(buffers[record.buffer]->Key());
+                buffers[record.buffer].reset();
+            }
+            break;
+        case HdPagingTraceEvent::Frame:
+            if (record.value > bufferManager.GetCurrentFrame())
+            {
+                bufferManager.AdvanceFrame(
+                    static_cast<unsigned int>(record.value) - bufferManager.GetCurrentFrame());
+            }
+            ++stats.frames;
+            if (config.crawlEachFrame)
+            {
+                bufferManager.FreeCrawl(crawlPercentage);
+                ++stats.crawls;
+            }
+            break;
+        case HdPagingTraceEvent::Crawl:
+            if (config.freeCrawlPercentage <= 0.0f)
+            {
+                crawlPercentage = static_cast<float>(record.value) / 100.0f;
+            }
+            bufferManager.FreeCrawl(crawlPercentage);
+            ++stats.crawls;
+            break;
+        default:
+            break; // Paging decisions of the recorded run
+        }
+
+        stats.peakResidentBytes = std::max(stats.peakResidentBytes,
+            memoryMonitor->GetUsedSceneMemory() + memoryMonitor->GetUsedRendererMemory());
+    }
+
+    const HdPagingTraceStats paging = bufferManager.GetTraceRecorder().GetStats();
+    stats.pageIns                   = paging.pageIns;
+    stats.pageOuts                  = paging.pageOuts;
+    stats.bytesPagedIn              = paging.bytesPagedIn;
+    stats.bytesPagedOut             = paging.bytesPagedOut;
+    bufferManager.StopTrace();
+
+    return stats;
+}
+
+} // namespace HVT_NS
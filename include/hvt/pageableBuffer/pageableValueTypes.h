@@ -0,0 +1,236 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <hvt/api.h>
+#include <hvt/pageableBuffer/pageFileManager.h>
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/span.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/base/vt/value.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <shared_mutex>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace HVT_NS
+{
+
+/// Serialization of a type held by VtValue, in the format of HdDefaultValueSerializer:
+/// [uint8 tag] [payload]. The functions are only called with values holding the type.
+struct HdValueType
+{
+    uint8_t tag                = 0;
+    const std::type_info* type = nullptr;
+    size_t scalarSize          = 1; ///< Byte shuffle stride of the page codecs, 1 for none
+    /// Size of the elements of the arrays whose payload is their storage, 0 for other types:
+    /// a range of elements is then a range of the payload, e.g. a chunk of the array.
+    size_t elementSize = 0;
+
+    /// Size of the payload of a value, 0 if a nested value cannot be serialized.
+    size_t (*payloadSize)(const PXR_NS::VtValue& value) = nullptr;
+    /// Writes the payload of a value in chunks. Returns false if the sink fails, or if a nested
+    /// value cannot be serialized.
+    bool (*write)(const PXR_NS::VtValue& value, const HdPageSink& sink) = nullptr;
+    /// Reads a value from its payload, empty if the payload is corrupted.
+    PXR_NS::VtValue (*read)(const uint8_t* payload, size_t size) = nullptr;
+    /// Memory held by a value: its storage, and the heap of its elements.
+    size_t (*memoryUsage)(const PXR_NS::VtValue& value) = nullptr;
+    /// Optional, reads size payload bytes at offset of a page straight into the storage of the
+    /// value, without a staging buffer.
+    PXR_NS::VtValue (*readFromPage)(HdPageFileManager& pageFileManager,
+        const HdBufferPageEntry& pageEntry, size_t offset, size_t size) = nullptr;
+};
+
+/// Codec of a trivially copyable type T: the payload is the bytes of the value.
+template <typename T>
+struct HdPodValueCodec
+{
+    static size_t PayloadSize(const PXR_NS::VtValue& /*value*/) { return sizeof(T); }
+
+    static bool Write(const PXR_NS::VtValue& value, const HdPageSink& sink)
+    {
+        const T& v = value.UncheckedGet<T>();
+        return sink(PXR_NS::TfSpan<const std::byte>(reinterpret_cast<const std::byte*>(&v),
+            sizeof(T)));
+    }
+
+    static PXR_NS::VtValue Read(const uint8_t* payload, size_t size)
+    {
+        if (size != sizeof(T))
+        {
+            return {};
+        }
+        T v;
+        std::memcpy(&v, payload, sizeof(T));
+        return PXR_NS::VtValue(v);
+    }
+
+    static size_t MemoryUsage(const PXR_NS::VtValue& /*value*/) { return sizeof(T); }
+};
+
+/// Codec of a VtArray of a trivially copyable type T: the payload is the array storage, with
+/// no header nor padding.
+template <typename T>
+struct HdPodArrayCodec
+{
+    static constexpr size_t ELEMENT_SIZE = sizeof(T);
+
+    static size_t PayloadSize(const PXR_NS::VtValue& value)
+    {
+        return value.UncheckedGet<PXR_NS::VtArray<T>>().size() * sizeof(T);
+    }
+
+    static bool Write(const PXR_NS::VtValue& value, const HdPageSink& sink)
+    {
+        const auto& array = value.UncheckedGet<PXR_NS::VtArray<T>>();
+        return array.empty() ||
+            sink(PXR_NS::TfSpan<const std::byte>(
+                reinterpret_cast<const std::byte*>(array.cdata()), array.size() * sizeof(T)));
+    }
+
+    // The elements are copied into the uninitialized storage, without value-initializing it
+    // first.
+    static PXR_NS::VtValue Read(const uint8_t* payload, size_t size)
+    {
+        PXR_NS::VtArray<T> array;
+        array.resize(size / sizeof(T),
+            [payload](T* first, T* last)
+            { std::memcpy(first, payload, static_cast<size_t>(last - first) * sizeof(T)); });
+        return PXR_NS::VtValue(std::move(array));
+    }
+
+    static size_t MemoryUsage(const PXR_NS::VtValue& value) { return PayloadSize(value); }
+
+    static PXR_NS::VtValue ReadFromPage(HdPageFileManager& pageFileManager,
+        const HdBufferPageEntry& pageEntry, size_t offset, size_t size)
+    {
+        bool read = true;
+        PXR_NS::VtArray<T> array;
+        array.resize(size / sizeof(T),
+            [&](T* first, T* last)
+            {
+                read = pageFileManager.LoadPageRange(pageEntry, offset,
+                    PXR_NS::TfSpan<std::byte>(reinterpret_cast<std::byte*>(first),
+                        static_cast<size_t>(last - first) * sizeof(T)));
+            });
+        return read ? PXR_NS::VtValue(std::move(array)) : PXR_NS::VtValue();
+    }
+};
+
+namespace HdValueTypeDetail
+{
+template <typename Codec, typename = void>
+struct HasReadFromPage : std::false_type
+{
+};
+template <typename Codec>
+struct HasReadFromPage<Codec, std::void_t<decltype(&Codec::ReadFromPage)>> : std::true_type
+{
+};
+template <typename Codec, typename = void>
+struct HasElementSize : std::false_type
+{
+};
+template <typename Codec>
+struct HasElementSize<Codec, std::void_t<decltype(Codec::ELEMENT_SIZE)>> : std::true_type
+{
+};
+} // namespace HdValueTypeDetail
+
+/// Makes the HdValueType of T from a codec with the static functions of HdValueType, such as
+/// HdPodValueCodec<T>.
+template <typename T, typename Codec>
+HdValueType MakeValueType(uint8_t tag, size_t scalarSize = 1)
+{
+    HdValueType type;
+    type.tag         = tag;
+    type.type        = &typeid(T);
+    type.scalarSize  = scalarSize;
+    type.payloadSize = &Codec::PayloadSize;
+    type.write       = &Codec::Write;
+    type.read        = &Codec::Read;
+    type.memoryUsage = &Codec::MemoryUsage;
+    if constexpr (HdValueTypeDetail::HasReadFromPage<Codec>::value)
+    {
+        type.readFromPage = &Codec::ReadFromPage;
+    }
+    if constexpr (HdValueTypeDetail::HasElementSize<Codec>::value)
+    {
+        type.elementSize = Codec::ELEMENT_SIZE;
+    }
+    return type;
+}
+
+/// Value types of HdDefaultValueSerializer, looked up in constant time by the type held by a
+/// VtValue, or by the tag of a page.
+///
+/// The built-in types are the scalars and the VtArrays of the numeric types, of the Gf vector,
+/// matrix, quaternion, dual quaternion and range types and of GfRect2i, the strings, tokens and
+/// SdfPaths and their arrays, and VtDictionary holding any of them. Their tags never change, as
+/// pages outlive the sessions with the persistent page cache. The tags from FIRST_USER_TAG on
+/// are left to the types registered by the applications.
+class HVT_API HdValueTypeRegistry
+{
+public:
+    static constexpr uint8_t FIRST_USER_TAG = 128;
+
+    static HdValueTypeRegistry& GetInstance();
+
+    /// Returns the type, nullptr if it is not serializable.
+    [[nodiscard]] const HdValueType* Find(const std::type_index& type) const;
+    [[nodiscard]] const HdValueType* Find(const std::type_info& type) const
+    {
+        return Find(std::type_index(type));
+    }
+    [[nodiscard]] const HdValueType* FindTag(uint8_t tag) const noexcept;
+
+    /// Registers a user type. Fails if its tag is below FIRST_USER_TAG, or if its tag or its
+    /// type is registered already.
+    bool Register(const HdValueType& type);
+
+    /// Registers a trivially copyable type T and VtArray<T>, with the tags tag and tag + 1.
+    template <typename T>
+    bool RegisterPod(uint8_t tag, size_t scalarSize = 1)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "The type must be trivially copyable");
+        return tag < UINT8_MAX &&
+            Register(MakeValueType<T, HdPodValueCodec<T>>(tag, scalarSize)) &&
+            Register(MakeValueType<PXR_NS::VtArray<T>, HdPodArrayCodec<T>>(tag + 1, scalarSize));
+    }
+
+    /// Number of registered types, built-in ones included.
+    [[nodiscard]] size_t GetTypeCount() const;
+
+private:
+    HdValueTypeRegistry();
+    void AddBuiltIn(const HdValueType& type);
+
+    std::deque<HdValueType> mTypes; ///< Stable addresses
+    std::array<std::atomic<const HdValueType*>, UINT8_MAX + 1> mByTag {};
+    std::unordered_map<std::type_index, const HdValueType*> mBuiltIns; ///< Immutable
+    std::unordered_map<std::type_index, const HdValueType*> mUserTypes;
+    mutable std::shared_mutex mUserMutex; ///< Guards mTypes and mUserTypes
+};
+
+} // namespace HVT_NS
@@ -0,0 +1,400 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageCodec.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace HVT_NS
+{
+
+namespace
+{
+
+constexpr size_t RAW_HEADER_SIZE        = sizeof(uint8_t);
+constexpr size_t SHUFFLE_LZ_HEADER_SIZE = sizeof(uint8_t) * 2 + sizeof(uint64_t);
+
+// LZ block format, one sequence after the other:
+//   [token: literal length (4 high bits) | match length - MIN_MATCH (4 low bits)]
+//   [literal length extension: 255... n] [literals]
+//   [uint16 match offset] [match length extension: 255... n]
+// The last sequence only has literals. A nibble of 15 means the length continues in extension
+// bytes, each 255 byte adding 255 until the first smaller byte.
+constexpr size_t MIN_MATCH     = 4;
+constexpr size_t LAST_LITERALS = 5;  // The block ends with literals (fast decoder tail)
+constexpr size_t MATCH_LIMIT   = 12; // No match starts in the last bytes
+constexpr size_t MAX_OFFSET    = 65535;
+constexpr int HASH_LOG         = 12;
+
+uint32_t ReadU32(const uint8_t* p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint32_t HashU32(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - HASH_LOG);
+}
+
+// Writes a length extension, returns false when it does not fit.
+bool WriteLength(size_t length, uint8_t*& out, const uint8_t* outEnd)
+{
+    for (; length >= 255; length -= 255)
+    {
+        if (out == outEnd)
+        {
+            return false;
+        }
+        *out++ = 255;
+    }
+    if (out == outEnd)
+    {
+        return false;
+    }
+    *out++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+bool ReadLength(size_t& length, const uint8_t*& in, const uint8_t* inEnd)
+{
+    uint8_t byte = 255;
+    while (byte == 255)
+    {
+        if (in == inEnd)
+        {
+            return false;
+        }
+        byte = *in++;
+        length += byte;
+    }
+    return true;
+}
+
+// Writes one sequence; matchLength is 0 for the final literals. Returns false when the output
+// is full.
+bool WriteSequence(const uint8_t* literals, size_t literalLength, size_t offset,
+    size_t matchLength, uint8_t*& out, const uint8_t* outEnd)
+{
+    if (out == outEnd)
+    {
+        return false;
+    }
+    uint8_t* token = out++;
+    *token         = static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4);
+    if (literalLength >= 15 && !WriteLength(literalLength - 15, out, outEnd))
+    {
+        return false;
+    }
+    if (static_cast<size_t>(outEnd - out) < literalLength)
+    {
+        return false;
+    }
+    std::memcpy(out, literals, literalLength);
+    out += literalLength;
+
+    if (matchLength == 0)
+    {
+        return true;
+    }
+    if (outEnd - out < 2)
+    {
+        return false;
+    }
+    *out++ = static_cast<uint8_t>(offset & 0xFF);
+    *out++ = static_cast<uint8_t>(offset >> 8);
+
+    const size_t extraLength = matchLength - MIN_MATCH;
+    *token |= static_cast<uint8_t>(std::min<size_t>(extraLength, 15));
+    return extraLength < 15 || WriteLength(extraLength - 15, out, outEnd);
+}
+
+// Greedy single pass compressor with a hash table of the last position of each 4 byte sequence.
+// Returns the compressed size, or 0 when it would not fit into capacity.
+size_t CompressLZ(const uint8_t* src, size_t size, uint8_t* dst, size_t capacity)
+{
+    std::array<uint32_t, size_t(1) << HASH_LOG> table {};
+
+    const uint8_t* in     = src;
+    const uint8_t* anchor = src;
+    const uint8_t* srcEnd = src + size;
+    uint8_t* out          = dst;
+    const uint8_t* outEnd = dst + capacity;
+
+    if (size > MATCH_LIMIT)
+    {
+        const uint8_t* matchStartLimit = srcEnd - MATCH_LIMIT;
+        const uint8_t* matchEndLimit   = srcEnd - LAST_LITERALS;
+        while (in < matchStartLimit)
+        {
+            const uint32_t sequence = ReadU32(in);
+            const uint32_t hash     = HashU32(sequence);
+            const uint8_t* match    = src + table[hash];
+            table[hash]             = static_cast<uint32_t>(in - src);
+
+            if (match >= in || static_cast<size_t>(in - match) > MAX_OFFSET ||
+                ReadU32(match) != sequence)
+            {
+                // Skip faster through data which does not compress.
+                in += 1 + ((in - anchor) >> 6);
+                continue;
+            }
+
+            // Extend the match backwards over the pending literals, then forwards.
+            while (in > anchor && match > src && in[-1] == match[-1])
+            {
+                --in;
+                --match;
+            }
+            const uint8_t* matchEnd = in + MIN_MATCH;
+            const uint8_t* ref      = match + MIN_MATCH;
+            while (matchEnd < matchEndLimit && *matchEnd == *ref)
+            {
+                ++matchEnd;
+                ++ref;
+            }
+
+            if (!WriteSequence(anchor, static_cast<size_t>(in - anchor),
+                    static_cast<size_t>(in - match), static_cast<size_t>(matchEnd - in), out,
+                    outEnd))
+            {
+                return 0;
+            }
+            in     = matchEnd;
+            anchor = in;
+            if (in < matchStartLimit)
+            {
+                table[HashU32(ReadU32(in - 2))] = static_cast<uint32_t>(in - 2 - src);
+            }
+        }
+    }
+
+    if (!WriteSequence(anchor, static_cast<size_t>(srcEnd - anchor), 0, 0, out, outEnd))
+    {
+        return 0;
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+// Decompresses exactly size bytes, checking every length and offset against the buffers.
+bool DecompressLZ(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t size)
+{
+    const uint8_t* in     = src;
+    const uint8_t* inEnd  = src + srcSize;
+    uint8_t* out          = dst;
+    const uint8_t* outEnd = dst + size;
+
+    while (in < inEnd)
+    {
+        const uint8_t token  = *in++;
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !ReadLength(literalLength, in, inEnd))
+        {
+            return false;
+        }
+        if (static_cast<size_t>(inEnd - in) < literalLength ||
+            static_cast<size_t>(outEnd - out) < literalLength)
+        {
+            return false;
+        }
+        if (literalLength > 0)
+        {
+            std::memcpy(out, in, literalLength);
+            in += literalLength;
+            out += literalLength;
+        }
+
+        if (in == inEnd)
+        {
+            break; // Final literals
+        }
+
+        if (inEnd - in < 2)
+        {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(in[0]) | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !ReadLength(matchLength, in, inEnd))
+        {
+            return false;
+        }
+        matchLength += MIN_MATCH;
+        if (offset == 0 || offset > static_cast<size_t>(out - dst) ||
+            static_cast<size_t>(outEnd - out) < matchLength)
+        {
+            return false;
+        }
+
+        // Overlapping matches repeat the last offset bytes, so copy forward byte by byte.
+        const uint8_t* ref = out - offset;
+        if (offset >= matchLength)
+        {
+            std::memcpy(out, ref, matchLength);
+            out += matchLength;
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                *out++ = *ref++;
+            }
+        }
+    }
+    return out == outEnd;
+}
+
+void Shuffle(const uint8_t* src, size_t size, size_t stride, uint8_t* dst)
+{
+    const size_t count = size / stride;
+    for (size_t byte = 0; byte < stride; ++byte)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[byte * count + i] = src[i * stride + byte];
+        }
+    }
+    // Trailing bytes of an incomplete element stay in place.
+    std::memcpy(dst + count * stride, src + count * stride, size - count * stride);
+}
+
+void Unshuffle(const uint8_t* src, size_t size, size_t stride, uint8_t* dst)
+{
+    const size_t count = size / stride;
+    for (size_t byte = 0; byte < stride; ++byte)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[i * stride + byte] = src[byte * count + i];
+        }
+    }
+    std::memcpy(dst + count * stride, src + count * stride, size - count * stride);
+}
+
+std::vector<uint8_t> EncodeRaw(const uint8_t* data, size_t size)
+{
+    std::vector<uint8_t> page(RAW_HEADER_SIZE + size);
+    page[0] = static_cast<uint8_t>(HdPageCodec::Raw);
+    if (size > 0)
+    {
+        std::memcpy(page.data() + RAW_HEADER_SIZE, data, size);
+    }
+    return page;
+}
+
+} // anonymous namespace
+
+namespace HdPageCodecs
+{
+
+std::vector<uint8_t> Encode(HdPageCodec codec, const uint8_t* data, size_t size, size_t stride)
+{
+    if (codec != HdPageCodec::ShuffleLZ || size <= MATCH_LIMIT)
+    {
+        return EncodeRaw(data, size);
+    }
+
+    stride = (stride > 1 && stride <= 255) ? stride : 1;
+    std::vector<uint8_t> shuffled;
+    const uint8_t* input = data;
+    if (stride > 1)
+    {
+        shuffled.resize(size);
+        Shuffle(data, size, stride, shuffled.data());
+        input = shuffled.data();
+    }
+
+    // Anything not smaller than the raw page is not worth decoding: stored raw instead.
+    std::vector<uint8_t> page(size);
+    const size_t compressedSize = CompressLZ(
+        input, size, page.data() + SHUFFLE_LZ_HEADER_SIZE, size - SHUFFLE_LZ_HEADER_SIZE);
+    if (compressedSize == 0)
+    {
+        return EncodeRaw(data, size);
+    }
+
+    const auto rawSize = static_cast<uint64_t>(size);
+    page[0]            = static_cast<uint8_t>(HdPageCodec::ShuffleLZ);
+    page[1]            = static_cast<uint8_t>(stride);
+    std::memcpy(page.data() + 2, &rawSize, sizeof(rawSize));
+    page.resize(SHUFFLE_LZ_HEADER_SIZE + compressedSize);
+    return page;
+}
+
+bool Decode(const uint8_t* page, size_t pageSize, std::vector<uint8_t>& scratch,
+    const uint8_t*& data, size_t& size)
+{
+    switch (GetCodec(page, pageSize))
+    {
+    case HdPageCodec::Raw:
+        if (pageSize < RAW_HEADER_SIZE)
+        {
+            return false;
+        }
+        data = page + RAW_HEADER_SIZE;
+        size = pageSize - RAW_HEADER_SIZE;
+        return true;
+
+    case HdPageCodec::ShuffleLZ:
+    {
+        if (pageSize < SHUFFLE_LZ_HEADER_SIZE)
+        {
+            return false;
+        }
+        const size_t stride = page[1];
+        uint64_t rawSize    = 0;
+        std::memcpy(&rawSize, page + 2, sizeof(rawSize));
+
+        // A compressed block expands at most 255 times (one extension byte per 255 bytes).
+        const size_t compressedSize = pageSize - SHUFFLE_LZ_HEADER_SIZE;
+        if (stride == 0 || rawSize / 255 > compressedSize)
+        {
+            return false;
+        }
+
+        // Unshuffled pages are decompressed straight into scratch.
+        std::vector<uint8_t> shuffled;
+        auto& decompressed = (stride > 1) ? shuffled : scratch;
+        decompressed.resize(static_cast<size_t>(rawSize));
+        if (!DecompressLZ(page + SHUFFLE_LZ_HEADER_SIZE, compressedSize, decompressed.data(),
+                decompressed.size()))
+        {
+            return false;
+        }
+        if (stride > 1)
+        {
+            scratch.resize(shuffled.size());
+            Unshuffle(shuffled.data(), shuffled.size(), stride, scratch.data());
+        }
+        data = scratch.data();
+        size = scratch.size();
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+HdPageCodec GetCodec(const uint8_t* page, size_t pageSize)
+{
+    return (pageSize > 0) ? static_cast<HdPageCodec>(page[0]) : HdPageCodec::Raw;
+}
+
+} // namespace HdPageCodecs
+
+} // namespace HVT_NS
@@ -16,362 +16,2860 @@
 #include <hvt/pageableBuffer/pageableBuffer.h>
 #include <hvt/pageableBuffer/pageableMemoryMonitor.h> // FormatBytes
 
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/tf/stringUtils.h>
 
 #include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <unordered_set>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace HVT_NS
 {
 
-// HdPageFileEntry Implementation
-HdPageFileEntry::HdPageFileEntry(const std::string& filename, size_t pageId) :
-    mFileName(filename), mPageId(pageId), mSizeLimit(HdPageFileManager::MAX_PAGE_FILE_SIZE)
+namespace
+{
+
+// Mapped page files grow by at least this amount to limit the number of file extensions.
+constexpr size_t MAPPED_FILE_GROWTH = static_cast<size_t>(64) * ONE_MiB;
+
+// Largest single positional read/write request (Windows takes a DWORD byte count).
+constexpr size_t MAX_IO_CHUNK = static_cast<size_t>(1) * ONE_GiB;
+
+const char* IOModeName(HdPageFileIOMode mode)
+{
+    return mode == HdPageFileIOMode::MemoryMapped ? "MemoryMapped" : "Positional";
+}
+
+// Page access stamps of the tiered storage, in steady clock milliseconds.
+std::int64_t AccessStamp()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Persistent page index, "page_index.bin" next to the page files:
+//   [magic] [uint64 session] [uint64 page file count] [uint64 page count]
+//   per page: [uint32 name size] [name] [uint64 content hash] [uint64 last session]
+//             [uint64 page file id] [int64 offset] [uint64 size]
+constexpr const char* PERSISTENT_INDEX_FILE_NAME  = "page_index.bin";
+constexpr char PERSISTENT_INDEX_MAGIC[8]          = { 'H', 'V', 'T', 'P', 'I', 'D', 'X', '1' };
+constexpr std::uint64_t MAX_PERSISTENT_PAGE_FILES = 4096;
+
+template <typename T>
+void AppendToIndex(std::vector<char>& index, const T& value)
+{
+    const auto* bytes = reinterpret_cast<const char*>(&value);
+    index.insert(index.end(), bytes, bytes + sizeof(T));
+}
+
+void AppendToIndex(std::vector<char>& index, const char* data, size_t size)
 {
-    // Try to open an existing file first.
-    mFile = std::fstream(filename, std::ios::binary | std::ios::in | std::ios::out);
-    if (!mFile)
+    index.insert(index.end(), data, data + size);
+}
+
+void AppendToIndex(std::vector<char>& index, const std::string& value)
+{
+    AppendToIndex(index, static_cast<std::uint32_t>(value.size()));
+    AppendToIndex(index, value.data(), value.size());
+}
+
+// Bounds checked reader of the persistent page index.
+class IndexReader
+{
+public:
+    explicit IndexReader(const std::vector<char>& index) : mIndex(index) {}
+
+    bool Read(void* data, size_t size)
     {
-        // File doesn't exist yet. Create it with truncate and reopen read/write.
-        mFile = std::fstream(filename, std::ios::binary | std::ios::out | std::ios::trunc);
-        if (!mFile)
+        if (size > mIndex.size() - mPosition)
         {
-            TF_WARN("HdPageFileEntry: Fails to open '%s'.\n", filename.c_str());
-            return;
+            return false;
         }
-        mFile.close();
-        mFile = std::fstream(filename, std::ios::binary | std::ios::in | std::ios::out);
-        if (!mFile)
+        std::memcpy(data, mIndex.data() + mPosition, size);
+        mPosition += size;
+        return true;
+    }
+
+    template <typename T>
+    bool Read(T& value)
+    {
+        return Read(&value, sizeof(T));
+    }
+
+    bool Read(std::string& value)
+    {
+        std::uint32_t size = 0;
+        if (!Read(size) || size > mIndex.size() - mPosition)
         {
-            TF_WARN("HdPageFileEntry: Fails to open '%s'.\n", filename.c_str());
-            return;
+            return false;
+        }
+        value.assign(mIndex.data() + mPosition, size);
+        mPosition += size;
+        return true;
+    }
+
+private:
+    const std::vector<char>& mIndex;
+    size_t mPosition = 0;
+};
+
+#if !defined(_WIN32)
+// Extends a mapped page file from oldSize to newSize bytes. The blocks are allocated up front:
+// on a full disk the growth fails like a positional write would, instead of a SIGBUS on the
+// first store into a sparse mapping. Only the file systems without preallocation grow sparse.
+bool GrowMappedFile(int fileDescriptor, size_t oldSize, size_t newSize)
+{
+#if defined(__APPLE__)
+    int error = EOPNOTSUPP;
+#else
+    int error = EINTR;
+    while (error == EINTR)
+    {
+        error = ::posix_fallocate(
+            fileDescriptor, static_cast<off_t>(oldSize), static_cast<off_t>(newSize - oldSize));
+    }
+#endif
+    if (error != 0 && error != EOPNOTSUPP && error != EINVAL)
+    {
+        return false;
+    }
+    return error == 0 || ::ftruncate(fileDescriptor, static_cast<off_t>(newSize)) == 0;
+}
+
+// Number of buffers submitted per gathered write (the portable IOV_MAX minimum is 1024).
+constexpr size_t MAX_IO_VECTORS = 1024;
+
+// Writes (or reads) all the vectors starting at position, resuming after partial transfers.
+bool TransferVectors(
+    int fileDescriptor, std::uint64_t position, std::vector<iovec>& vectors, bool write)
+{
+    size_t index = 0;
+    while (index < vectors.size())
+    {
+        const auto count       = static_cast<int>(vectors.size() - index);
+        const ssize_t transfer = write
+            ? ::pwritev(fileDescriptor, vectors.data() + index, count, static_cast<off_t>(position))
+            : ::preadv(fileDescriptor, vectors.data() + index, count, static_cast<off_t>(position));
+        if (transfer < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (transfer <= 0)
+        {
+            // Error, or a read beyond the end of the file.
+            return false;
+        }
+        position += static_cast<std::uint64_t>(transfer);
+
+        // Skip the fully transferred vectors and trim the partially transferred one.
+        auto done = static_cast<size_t>(transfer);
+        while (index < vectors.size() && done >= vectors[index].iov_len)
+        {
+            done -= vectors[index].iov_len;
+            ++index;
+        }
+        if (index < vectors.size() && done > 0)
+        {
+            vectors[index].iov_base = static_cast<char*>(vectors[index].iov_base) + done;
+            vectors[index].iov_len -= done;
+        }
+    }
+    return true;
+}
+#endif
+
+// Index of the power-of-two size class of a non-zero size, i.e. floor(log2(size)).
+size_t SizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    while (size >>= 1)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+// Index of the lowest set bit of a non-zero mask.
+size_t LowestSetBit(std::uint64_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index = 0;
+    _BitScanForward64(&index, mask);
+    return static_cast<size_t>(index);
+#else
+    return static_cast<size_t>(__builtin_ctzll(mask));
+#endif
+}
+
+// Writes a streamed page of size bytes at offset. Small chunks are gathered into writes of up
+// to HdPageFileManager::STREAM_CHUNK_SIZE, larger ones are written from the writer's storage.
+bool WriteStream(
+    HdPageFileEntry& entry, std::ptrdiff_t offset, size_t size, const HdPageWriter& writer)
+{
+    std::vector<std::byte> pending;
+    size_t position = 0; // Bytes received, including the pending ones
+    auto flush      = [&]()
+    {
+        const auto start = static_cast<std::ptrdiff_t>(position - pending.size());
+        const bool written =
+            pending.empty() || entry.WriteData(offset + start, pending.data(), pending.size());
+        pending.clear();
+        return written;
+    };
+    const HdPageSink sink = [&](TfSpan<const std::byte> chunk)
+    {
+        if (chunk.size() > size - position)
+        {
+            return false;
+        }
+        if (chunk.size() >= HdPageFileManager::STREAM_CHUNK_SIZE)
+        {
+            if (!flush() ||
+                !entry.WriteData(offset + static_cast<std::ptrdiff_t>(position), chunk.data(),
+                    chunk.size()))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (pending.size() + chunk.size() > HdPageFileManager::STREAM_CHUNK_SIZE && !flush())
+            {
+                return false;
+            }
+            pending.insert(pending.end(), chunk.begin(), chunk.end());
+        }
+        position += chunk.size();
+        return true;
+    };
+    return writer(sink) && flush() && position == size;
+}
+
+// Gathers a streamed page of size bytes in memory.
+bool GatherStream(size_t size, const HdPageWriter& writer, std::vector<std::byte>& page)
+{
+    page.clear();
+    page.reserve(size);
+    const HdPageSink sink = [&page, size](TfSpan<const std::byte> chunk)
+    {
+        if (chunk.size() > size - page.size())
+        {
+            return false;
+        }
+        page.insert(page.end(), chunk.begin(), chunk.end());
+        return true;
+    };
+    return writer(sink) && page.size() == size;
+}
+
+} // anonymous namespace
+
+// HdPageView Implementation
+
+HdPageView::~HdPageView()
+{
+    Reset();
+}
+
+HdPageView::HdPageView(HdPageView&& other) noexcept :
+    mPageFile(other.mPageFile), mData(other.mData)
+{
+    other.mPageFile = nullptr;
+    other.mData     = {};
+}
+
+HdPageView& HdPageView::operator=(HdPageView&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        mPageFile       = other.mPageFile;
+        mData           = other.mData;
+        other.mPageFile = nullptr;
+        other.mData     = {};
+    }
+    return *this;
+}
+
+void HdPageView::Reset() noexcept
+{
+    if (mPageFile)
+    {
+        mPageFile->mActiveReaders.fetch_sub(1, std::memory_order_release);
+        mPageFile = nullptr;
+    }
+    mData = {};
+}
+
+// HdPageFileFreeSpace Implementation
+
+std::ptrdiff_t HdPageFileFreeSpace::Allocate(size_t size)
+{
+    if (size == 0 || size > mFreeBytes)
+    {
+        return -1;
+    }
+
+    // Smallest fitting hole in the size class of the request, otherwise the smallest hole of
+    // the next non-empty (larger) class.
+    const size_t sizeClass = SizeClass(size);
+    const auto& bin        = mBins[sizeClass];
+    auto binIt             = bin.lower_bound({ size, std::numeric_limits<std::ptrdiff_t>::min() });
+    if (binIt == bin.end())
+    {
+        const std::uint64_t largerBins =
+            (sizeClass + 1 < NUM_SIZE_CLASSES) ? (mNonEmptyBins >> (sizeClass + 1)) : 0;
+        if (largerBins == 0)
+        {
+            return -1;
+        }
+        binIt = mBins[sizeClass + 1 + LowestSetBit(largerBins)].begin();
+    }
+
+    const auto [holeSize, holeOffset] = *binIt;
+    Remove(mHoles.find(holeOffset));
+    if (holeSize > size)
+    {
+        // Keep the remainder.
+        Insert(holeOffset + static_cast<std::ptrdiff_t>(size), holeSize - size);
+    }
+    return holeOffset;
+}
+
+HdFreeListEntry HdPageFileFreeSpace::Release(std::ptrdiff_t offset, size_t size)
+{
+    if (size == 0)
+    {
+        return HdFreeListEntry(offset, 0);
+    }
+
+    // Merge with the neighbours right away so the holes never fragment.
+    auto next = mHoles.lower_bound(offset);
+    if (next != mHoles.begin())
+    {
+        auto previous = std::prev(next);
+        if (previous->first + static_cast<std::ptrdiff_t>(previous->second) == offset)
+        {
+            offset = previous->first;
+            size += previous->second;
+            Remove(previous);
         }
     }
+    if (next != mHoles.end() && offset + static_cast<std::ptrdiff_t>(size) == next->first)
+    {
+        size += next->second;
+        Remove(next);
+    }
+
+    Insert(offset, size);
+    return HdFreeListEntry(offset, size);
+}
+
+void HdPageFileFreeSpace::Erase(std::ptrdiff_t offset)
+{
+    auto hole = mHoles.find(offset);
+    if (hole != mHoles.end())
+    {
+        Remove(hole);
+    }
+}
+
+void HdPageFileFreeSpace::Clear()
+{
+    mHoles.clear();
+    for (auto& bin : mBins)
+    {
+        bin.clear();
+    }
+    mNonEmptyBins = 0;
+    mFreeBytes    = 0;
+}
+
+size_t HdPageFileFreeSpace::LargestHole() const
+{
+    if (mNonEmptyBins == 0)
+    {
+        return 0;
+    }
+
+    size_t sizeClass = NUM_SIZE_CLASSES - 1;
+    while (!(mNonEmptyBins & (std::uint64_t { 1 } << sizeClass)))
+    {
+        --sizeClass;
+    }
+    return mBins[sizeClass].rbegin()->first;
+}
+
+void HdPageFileFreeSpace::Insert(std::ptrdiff_t offset, size_t size)
+{
+    const size_t sizeClass = SizeClass(size);
+    mHoles.emplace(offset, size);
+    mBins[sizeClass].emplace(size, offset);
+    mNonEmptyBins |= std::uint64_t { 1 } << sizeClass;
+    mFreeBytes += size;
+}
+
+void HdPageFileFreeSpace::Remove(std::map<std::ptrdiff_t, size_t>::iterator hole)
+{
+    const size_t sizeClass = SizeClass(hole->second);
+    auto& bin              = mBins[sizeClass];
+    bin.erase({ hole->second, hole->first });
+    if (bin.empty())
+    {
+        mNonEmptyBins &= ~(std::uint64_t { 1 } << sizeClass);
+    }
+    mFreeBytes -= hole->second;
+    mHoles.erase(hole);
+}
+
+// HdPageFileEntry Implementation
+HdPageFileEntry::HdPageFileEntry(
+    const std::string& filename, size_t pageId, HdPageFileIOMode ioMode, size_t tier) :
+    mFileName(filename),
+    mPageId(pageId),
+    mTier(tier),
+    mSizeLimit(HdPageFileManager::MAX_PAGE_FILE_SIZE),
+    mIOMode(ioMode)
+{
+    // Open an existing file or create a new one.
+    if (!OpenFile())
+    {
+        TF_WARN("HdPageFileEntry: Fails to open '%s'.\n", filename.c_str());
+        return;
+    }
 
     // Get current file size
-    mNextOffset = std::filesystem::file_size(filename);
+    mNextOffset = static_cast<std::ptrdiff_t>(mFileSize.load());
+
+    if (mIOMode == HdPageFileIOMode::MemoryMapped && !OpenMapping())
+    {
+        TF_WARN("HdPageFileEntry: Fails to map '%s', falling back to positional I/O.\n",
+            filename.c_str());
+        mIOMode = HdPageFileIOMode::Positional;
+    }
 }
 
 HdPageFileEntry::~HdPageFileEntry()
 {
     // Close and clean up the file
-    mFile.close();
+    CloseMapping();
+    CloseFile();
     try
     {
-        if (std::filesystem::exists(mFileName))
+        if (!mKeepFile && std::filesystem::exists(mFileName))
         {
             std::filesystem::remove(mFileName);
         }
     }
     catch (const std::filesystem::filesystem_error&)
     {
-        // Ignore cleanup errors
+        // Ignore cleanup errors
+    }
+}
+
+std::ptrdiff_t HdPageFileEntry::FindPageFileGap(size_t size)
+{
+    // Try to find a gap first
+    std::ptrdiff_t offset = mFreeSpace.Allocate(size);
+    if (offset != -1)
+    {
+        return offset;
+    }
+
+    // No suitable gap found, use end of file
+    offset = mNextOffset;
+    if (SetNextOffset(mNextOffset + size))
+    {
+        return offset;
+    }
+    return -1;
+}
+
+bool HdPageFileEntry::SetNextOffset(std::ptrdiff_t offset)
+{
+    if (static_cast<size_t>(offset) > mSizeLimit)
+    {
+        return false;
+    }
+    mNextOffset = offset;
+    return true;
+}
+
+void HdPageFileEntry::AddFreeListEntry(std::ptrdiff_t offset, size_t size)
+{
+    const HdFreeListEntry hole = mFreeSpace.Release(offset, size);
+
+    // A hole reaching the end of the file is given back to the tail instead.
+    if (hole.size > 0 && hole.offset + static_cast<std::ptrdiff_t>(hole.size) == mNextOffset)
+    {
+        mFreeSpace.Erase(hole.offset);
+        mNextOffset = hole.offset;
+    }
+}
+
+void HdPageFileEntry::AddPage(std::ptrdiff_t offset, size_t size)
+{
+    // Empty pages hold no data and may share their offset with the next page.
+    if (size > 0 && mPages.emplace(offset, size).second)
+    {
+        mLiveBytes += size;
+        if (mTrackAccess)
+        {
+            mPageAccess[offset] = AccessStamp();
+        }
+    }
+}
+
+bool HdPageFileEntry::RemovePage(std::ptrdiff_t offset, size_t size)
+{
+    auto page = mPages.find(offset);
+    if (page == mPages.end() || page->second != size)
+    {
+        return false;
+    }
+    mLiveBytes -= size;
+    mPages.erase(page);
+    mPageAccess.erase(offset);
+    return true;
+}
+
+const HdPageLocation* HdPageFileEntry::FindForward(std::ptrdiff_t offset) const
+{
+    if (mForwards.empty())
+    {
+        return nullptr;
+    }
+    auto forward = mForwards.find(offset);
+    return (forward != mForwards.end()) ? &forward->second : nullptr;
+}
+
+void HdPageFileEntry::TouchPage(std::ptrdiff_t offset)
+{
+    if (!mTrackAccess)
+    {
+        return;
+    }
+    auto access = mPageAccess.find(offset);
+    if (access != mPageAccess.end())
+    {
+        access->second.store(AccessStamp(), std::memory_order_relaxed);
+    }
+}
+
+std::int64_t HdPageFileEntry::LastAccess(std::ptrdiff_t offset) const
+{
+    const auto access = mPageAccess.find(offset);
+    return (access != mPageAccess.end()) ? access->second.load(std::memory_order_relaxed)
+                                         : AccessStamp();
+}
+
+size_t HdPageFileEntry::PhysicalSize() const
+{
+    if (mIOMode == HdPageFileIOMode::MemoryMapped)
+    {
+        return mFileSize.load();
+    }
+#if defined(_WIN32)
+    LARGE_INTEGER fileSize {};
+    if (!mFileHandle || !::GetFileSizeEx(static_cast<HANDLE>(mFileHandle), &fileSize))
+    {
+        return 0;
+    }
+    return static_cast<size_t>(fileSize.QuadPart);
+#else
+    struct stat fileStat {};
+    if (mFileDescriptor < 0 || ::fstat(mFileDescriptor, &fileStat) != 0)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(fileStat.st_size);
+#endif
+}
+
+size_t HdPageFileEntry::Truncate()
+{
+    std::lock_guard<std::mutex> lock(mFileMutex);
+
+    // Mapped files grow in large steps, only shrink them by at least as much.
+    const size_t physicalSize = PhysicalSize();
+    const auto targetSize     = static_cast<size_t>(mNextOffset);
+    const size_t minShrink =
+        (mIOMode == HdPageFileIOMode::MemoryMapped) ? MAPPED_FILE_GROWTH : static_cast<size_t>(1);
+    if (mClosed || physicalSize < targetSize + minShrink)
+    {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    FILE_END_OF_FILE_INFO endOfFile {};
+    endOfFile.EndOfFile.QuadPart = static_cast<LONGLONG>(targetSize);
+    if (!::SetFileInformationByHandle(
+            static_cast<HANDLE>(mFileHandle), FileEndOfFileInfo, &endOfFile, sizeof(endOfFile)))
+    {
+        return 0;
+    }
+#else
+    if (::ftruncate(mFileDescriptor, static_cast<off_t>(targetSize)) != 0)
+    {
+        return 0;
+    }
+#endif
+    mFileSize = targetSize;
+    return physicalSize - targetSize;
+}
+
+size_t HdPageFileEntry::Close()
+{
+    const size_t physicalSize = PhysicalSize();
+
+    CloseMapping();
+    CloseFile();
+    try
+    {
+        if (std::filesystem::exists(mFileName))
+        {
+            std::filesystem::remove(mFileName);
+        }
+    }
+    catch (const std::filesystem::filesystem_error&)
+    {
+        // Ignore cleanup errors
+    }
+
+    mFreeSpace.Clear();
+    mHeldRanges.clear();
+    mNextOffset = 0;
+    mFileSize   = 0;
+    mClosed     = true;
+    return physicalSize;
+}
+
+bool HdPageFileEntry::OpenFile()
+{
+#if defined(_WIN32)
+    HANDLE handle = ::CreateFileA(mFileName.c_str(), GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER fileSize {};
+    if (!::GetFileSizeEx(handle, &fileSize))
+    {
+        ::CloseHandle(handle);
+        return false;
+    }
+    mFileHandle = handle;
+    mFileSize   = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+#else
+    mFileDescriptor = ::open(mFileName.c_str(), O_RDWR | O_CREAT, 0600);
+    if (mFileDescriptor < 0)
+    {
+        return false;
+    }
+    struct stat fileStat {};
+    if (::fstat(mFileDescriptor, &fileStat) != 0)
+    {
+        CloseFile();
+        return false;
+    }
+    mFileSize = static_cast<size_t>(fileStat.st_size);
+    return true;
+#endif
+}
+
+void HdPageFileEntry::CloseFile()
+{
+#if defined(_WIN32)
+    if (mFileHandle)
+    {
+        ::CloseHandle(static_cast<HANDLE>(mFileHandle));
+        mFileHandle = nullptr;
+    }
+#else
+    if (mFileDescriptor >= 0)
+    {
+        ::close(mFileDescriptor);
+        mFileDescriptor = -1;
+    }
+#endif
+}
+
+bool HdPageFileEntry::OpenMapping()
+{
+#if defined(_WIN32)
+    // Not supported yet, the caller falls back to positional I/O.
+    return false;
+#else
+    // Reserve the address range for the whole size limit so views handed out by MappedData()
+    // never move when the file grows. Only the part backed by the file is accessible.
+    void* mapping =
+        ::mmap(nullptr, mSizeLimit, PROT_READ | PROT_WRITE, MAP_SHARED, mFileDescriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    mMapping = static_cast<std::byte*>(mapping);
+    return true;
+#endif
+}
+
+void HdPageFileEntry::CloseMapping()
+{
+#if !defined(_WIN32)
+    if (mMapping)
+    {
+        ::munmap(mMapping, mSizeLimit);
+        mMapping = nullptr;
+    }
+#endif
+}
+
+bool HdPageFileEntry::EnsureMappedCapacity(size_t requiredSize)
+{
+#if defined(_WIN32)
+    (void)requiredSize;
+    return false;
+#else
+    if (requiredSize <= mFileSize.load())
+    {
+        return true;
+    }
+    if (requiredSize > mSizeLimit)
+    {
+        return false;
+    }
+
+    const size_t oldSize = mFileSize.load();
+    const size_t newSize =
+        std::min(std::max(requiredSize, oldSize + MAPPED_FILE_GROWTH), mSizeLimit);
+    if (!GrowMappedFile(mFileDescriptor, oldSize, newSize))
+    {
+        return false;
+    }
+    mFileSize = newSize;
+    return true;
+#endif
+}
+
+TfSpan<const std::byte> HdPageFileEntry::MappedData(std::ptrdiff_t offset, size_t size) const
+{
+    if (!mMapping || offset < 0 || static_cast<size_t>(offset) + size > mFileSize.load())
+    {
+        return {};
+    }
+    return TfSpan<const std::byte>(mMapping + offset, size);
+}
+
+bool HdPageFileEntry::PositionalWrite(std::ptrdiff_t offset, const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const char*>(data);
+    auto position     = static_cast<std::uint64_t>(offset);
+    while (size > 0)
+    {
+        const size_t chunk = std::min(size, MAX_IO_CHUNK);
+#if defined(_WIN32)
+        OVERLAPPED overlapped {};
+        overlapped.Offset     = static_cast<DWORD>(position & 0xFFFFFFFFull);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        DWORD written         = 0;
+        if (!::WriteFile(static_cast<HANDLE>(mFileHandle), bytes, static_cast<DWORD>(chunk),
+                &written, &overlapped) ||
+            written == 0)
+        {
+            return false;
+        }
+        const size_t done = written;
+#else
+        const ssize_t written =
+            ::pwrite(mFileDescriptor, bytes, chunk, static_cast<off_t>(position));
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return false;
+        }
+        const auto done = static_cast<size_t>(written);
+#endif
+        bytes += done;
+        position += done;
+        size -= done;
+    }
+    return true;
+}
+
+bool HdPageFileEntry::PositionalRead(std::ptrdiff_t offset, void* data, size_t size) const
+{
+    auto* bytes   = static_cast<char*>(data);
+    auto position = static_cast<std::uint64_t>(offset);
+    while (size > 0)
+    {
+        const size_t chunk = std::min(size, MAX_IO_CHUNK);
+#if defined(_WIN32)
+        OVERLAPPED overlapped {};
+        overlapped.Offset     = static_cast<DWORD>(position & 0xFFFFFFFFull);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        DWORD read            = 0;
+        if (!::ReadFile(static_cast<HANDLE>(mFileHandle), bytes, static_cast<DWORD>(chunk), &read,
+                &overlapped) ||
+            read == 0)
+        {
+            return false;
+        }
+        const size_t done = read;
+#else
+        const ssize_t read = ::pread(mFileDescriptor, bytes, chunk, static_cast<off_t>(position));
+        if (read < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (read <= 0)
+        {
+            // Error, or the page lies beyond the end of the file.
+            return false;
+        }
+        const auto done = static_cast<size_t>(read);
+#endif
+        bytes += done;
+        position += done;
+        size -= done;
+    }
+    return true;
+}
+
+bool HdPageFileEntry::WriteData(std::ptrdiff_t offset, const void* data, size_t size)
+{
+#if defined(_WIN32)
+    if (!mFileHandle || offset < 0)
+#else
+    if (mFileDescriptor < 0 || offset < 0)
+#endif
+    {
+        return false;
+    }
+
+    // nullptr is allowed for buffers with scene state but no backing storage
+    if (!data)
+    {
+        return true;
+    }
+
+    if (mIOMode == HdPageFileIOMode::MemoryMapped)
+    {
+        {
+            // Only the file growth needs to be serialized, the copy itself is not.
+            std::lock_guard<std::mutex> lock(mFileMutex);
+            if (!EnsureMappedCapacity(static_cast<size_t>(offset) + size))
+            {
+                return false;
+            }
+        }
+        std::memcpy(mMapping + offset, data, size);
+        return true;
+    }
+
+    // Different pages never overlap, so positional writes need no lock.
+    return PositionalWrite(offset, data, size);
+}
+
+bool HdPageFileEntry::ReadData(std::ptrdiff_t offset, void* data, size_t size)
+{
+#if defined(_WIN32)
+    if (!mFileHandle || offset < 0 || (size > 0 && !data))
+#else
+    if (mFileDescriptor < 0 || offset < 0 || (size > 0 && !data))
+#endif
+    {
+        return false;
+    }
+
+    if (mIOMode == HdPageFileIOMode::MemoryMapped)
+    {
+        auto view = MappedData(offset, size);
+        if (view.size() != size)
+        {
+            return false;
+        }
+        if (size > 0)
+        {
+            std::memcpy(data, view.data(), size);
+        }
+        return true;
+    }
+
+    return PositionalRead(offset, data, size);
+}
+
+bool HdPageFileEntry::WriteDataGather(
+    std::ptrdiff_t offset, TfSpan<const TfSpan<const std::byte>> buffers)
+{
+#if defined(_WIN32)
+    if (!mFileHandle || offset < 0)
+#else
+    if (mFileDescriptor < 0 || offset < 0)
+#endif
+    {
+        return false;
+    }
+
+    size_t totalSize = 0;
+    for (const auto& buffer : buffers)
+    {
+        totalSize += buffer.size();
+    }
+
+    if (mIOMode == HdPageFileIOMode::MemoryMapped)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mFileMutex);
+            if (!EnsureMappedCapacity(static_cast<size_t>(offset) + totalSize))
+            {
+                return false;
+            }
+        }
+        std::byte* destination = mMapping + offset;
+        for (const auto& buffer : buffers)
+        {
+            if (buffer.data())
+            {
+                std::memcpy(destination, buffer.data(), buffer.size());
+            }
+            destination += buffer.size();
+        }
+        return true;
+    }
+
+#if defined(_WIN32)
+    // Gathered writes (WriteFileGather) need unbuffered handles, so write the buffers back to
+    // back; the I/O is still sequential.
+    auto position = offset;
+    for (const auto& buffer : buffers)
+    {
+        if (buffer.data() && !PositionalWrite(position, buffer.data(), buffer.size()))
+        {
+            return false;
+        }
+        position += static_cast<std::ptrdiff_t>(buffer.size());
+    }
+    return true;
+#else
+    // Contiguous runs of buffers with data are submitted as one pwritev each.
+    std::vector<iovec> vectors;
+    vectors.reserve(std::min(buffers.size(), MAX_IO_VECTORS));
+    auto position = static_cast<std::uint64_t>(offset);
+    auto runStart = position;
+    for (const auto& buffer : buffers)
+    {
+        if (!buffer.data() || vectors.size() == MAX_IO_VECTORS)
+        {
+            if (!TransferVectors(mFileDescriptor, runStart, vectors, true))
+            {
+                return false;
+            }
+            vectors.clear();
+            runStart = position;
+        }
+        if (buffer.data() && !buffer.empty())
+        {
+            vectors.push_back(
+                iovec { const_cast<std::byte*>(buffer.data()), buffer.size() });
+        }
+        position += buffer.size();
+        if (!buffer.data())
+        {
+            runStart = position;
+        }
+    }
+    return TransferVectors(mFileDescriptor, runStart, vectors, true);
+#endif
+}
+
+bool HdPageFileEntry::ReadDataScatter(
+    std::ptrdiff_t offset, TfSpan<const TfSpan<std::byte>> buffers)
+{
+#if defined(_WIN32)
+    if (!mFileHandle || offset < 0)
+#else
+    if (mFileDescriptor < 0 || offset < 0)
+#endif
+    {
+        return false;
+    }
+
+    size_t totalSize = 0;
+    for (const auto& buffer : buffers)
+    {
+        if (!buffer.data() && !buffer.empty())
+        {
+            return false;
+        }
+        totalSize += buffer.size();
+    }
+
+    if (mIOMode == HdPageFileIOMode::MemoryMapped)
+    {
+        auto view = MappedData(offset, totalSize);
+        if (view.size() != totalSize)
+        {
+            return false;
+        }
+        const std::byte* source = view.data();
+        for (const auto& buffer : buffers)
+        {
+            if (!buffer.empty())
+            {
+                std::memcpy(buffer.data(), source, buffer.size());
+            }
+            source += buffer.size();
+        }
+        return true;
+    }
+
+#if defined(_WIN32)
+    auto position = offset;
+    for (const auto& buffer : buffers)
+    {
+        if (!buffer.empty() && !PositionalRead(position, buffer.data(), buffer.size()))
+        {
+            return false;
+        }
+        position += static_cast<std::ptrdiff_t>(buffer.size());
+    }
+    return true;
+#else
+    // Submitted as one preadv per MAX_IO_VECTORS buffers.
+    std::vector<iovec> vectors;
+    vectors.reserve(std::min(buffers.size(), MAX_IO_VECTORS));
+    auto position = static_cast<std::uint64_t>(offset);
+    auto runStart = position;
+    for (const auto& buffer : buffers)
+    {
+        if (vectors.size() == MAX_IO_VECTORS)
+        {
+            if (!TransferVectors(mFileDescriptor, runStart, vectors, false))
+            {
+                return false;
+            }
+            vectors.clear();
+            runStart = position;
+        }
+        if (!buffer.empty())
+        {
+            vectors.push_back(iovec { buffer.data(), buffer.size() });
+        }
+        position += buffer.size();
+    }
+    return TransferVectors(mFileDescriptor, runStart, vectors, false);
+#endif
+}
+
+// HdPageFileManager Implementation
+HdPageFileManager::HdPageFileManager(std::filesystem::path pageFileDirectory,
+    HdPageFileIOMode ioMode, bool deduplicatePages, bool persistent,
+    const HdPageIOConfig& ioConfig, std::vector<HdPageStorageTier> storageTiers) :
+    mPageFileDirectory(std::move(pageFileDirectory)), mIOMode(ioMode),
+    mDeduplication(deduplicatePages), mPersistent(persistent), mIOConfig(ioConfig)
+{
+    if (storageTiers.empty())
+    {
+        storageTiers.push_back({ mPageFileDirectory, 0 });
+    }
+    mPageFileDirectory = storageTiers.front().directory;
+    for (auto& tier : storageTiers)
+    {
+        mStorageTiers.push_back({ std::move(tier) });
+    }
+
+    // Reattach the page files of the previous session, or start from an empty directory.
+    if (!mPersistent || !LoadPersistentIndex())
+    {
+        if (mPersistent)
+        {
+            RemovePageFiles();
+        }
+        CreatePageFile();
+    }
+
+    // The entry falls back to positional I/O when the platform cannot map the file.
+    if (!mPageFileEntries.empty())
+    {
+        mIOMode = mPageFileEntries.back()->IOMode();
+    }
+}
+
+HdPageFileManager::~HdPageFileManager()
+{
+    // Completes the pending page I/O while the page files are still open.
+    mIOEngine.reset();
+
+    if (mPersistent)
+    {
+        // The page files holding persistent pages are kept, the others are removed.
+        SavePersistentIndex();
+        mPageFileEntries.clear();
+        return;
+    }
+
+    mPageFileEntries.clear();
+
+    // Clean up temp directories
+    for (const auto& tier : mStorageTiers)
+    {
+        try
+        {
+            if (std::filesystem::exists(tier.config.directory))
+            {
+                std::filesystem::remove_all(tier.config.directory);
+            }
+        }
+        catch (const std::filesystem::filesystem_error&)
+        {
+            // Ignore cleanup errors
+        }
+    }
+}
+
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::CreatePageEntry(const void* data, size_t size)
+{
+    const bool deduplicate = mDeduplication && data && size > 0;
+    std::uint64_t hash     = 0;
+    if (deduplicate)
+    {
+        hash = ArchHash64(static_cast<const char*>(data), size);
+        if (auto alias = FindSharedPage(hash, data, size))
+        {
+            return alias;
+        }
+    }
+
+    HdPageFileEntry* pageEntry = nullptr;
+    std::ptrdiff_t offset      = -1;
+    {
+        // Only the allocation is serialized, the write below runs without the lock.
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        pageEntry = AllocatePageRange(size, offset);
+        if (!pageEntry)
+        {
+            return nullptr;
+        }
+        pageEntry->AddPage(offset, size);
+        pageEntry->mActiveWriters.fetch_add(1, std::memory_order_relaxed);
+        pageEntry->mWriteGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Write data to file
+    const bool written = pageEntry->WriteData(offset, data, size);
+    pageEntry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+    if (!written)
+    {
+        // Give the reserved range back.
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        pageEntry->RemovePage(offset, size);
+        pageEntry->AddFreeListEntry(offset, size);
+        return nullptr;
+    }
+
+    if (deduplicate)
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        return SharePage({ pageEntry->PageFileId(), offset }, size, hash);
+    }
+    return std::make_unique<HdBufferPageEntry>(pageEntry->PageFileId(), size, offset);
+}
+
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::CreatePageEntry(TfSpan<const std::byte> data)
+{
+    return CreatePageEntry(data.data(), data.size());
+}
+
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::CreatePageEntry(
+    size_t size, const HdPageWriter& writer)
+{
+    if (mDeduplication)
+    {
+        std::vector<std::byte> page;
+        if (!GatherStream(size, writer, page))
+        {
+            return nullptr;
+        }
+        return CreatePageEntry(page.data(), page.size());
+    }
+
+    HdPageFileEntry* pageEntry = nullptr;
+    std::ptrdiff_t offset      = -1;
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        pageEntry = AllocatePageRange(size, offset);
+        if (!pageEntry)
+        {
+            return nullptr;
+        }
+        pageEntry->AddPage(offset, size);
+        pageEntry->mActiveWriters.fetch_add(1, std::memory_order_relaxed);
+        pageEntry->mWriteGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const bool written = WriteStream(*pageEntry, offset, size, writer);
+    pageEntry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+    if (!written)
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        pageEntry->RemovePage(offset, size);
+        pageEntry->AddFreeListEntry(offset, size);
+        return nullptr;
+    }
+    return std::make_unique<HdBufferPageEntry>(pageEntry->PageFileId(), size, offset);
+}
+
+std::vector<std::unique_ptr<HdBufferPageEntry>> HdPageFileManager::CreatePageEntries(
+    TfSpan<const TfSpan<const std::byte>> pages)
+{
+    if (!mDeduplication)
+    {
+        return WritePageEntries(pages);
+    }
+
+    // Pages with the content of a stored page only get an alias, the others are written in one
+    // batch. Duplicates within the batch are resolved once the batch is stored.
+    std::vector<std::unique_ptr<HdBufferPageEntry>> pageEntries(pages.size());
+    std::vector<std::uint64_t> hashes(pages.size(), 0);
+    std::vector<TfSpan<const std::byte>> newPages;
+    std::vector<size_t> newPageIndices;
+    std::vector<size_t> batchDuplicates;
+    std::unordered_set<std::uint64_t> batchHashes;
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+        if (!pages[i].empty() && pages[i].data())
+        {
+            hashes[i] = ArchHash64(reinterpret_cast<const char*>(pages[i].data()), pages[i].size());
+            if (batchHashes.count(hashes[i]) > 0)
+            {
+                batchDuplicates.push_back(i);
+                continue;
+            }
+            pageEntries[i] = FindSharedPage(hashes[i], pages[i].data(), pages[i].size());
+            if (pageEntries[i])
+            {
+                continue;
+            }
+            batchHashes.insert(hashes[i]);
+        }
+        newPages.push_back(pages[i]);
+        newPageIndices.push_back(i);
+    }
+
+    auto written = WritePageEntries(newPages);
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        for (size_t j = 0; j < written.size(); ++j)
+        {
+            const size_t i = newPageIndices[j];
+            if (!written[j] || pages[i].empty() || !pages[i].data())
+            {
+                pageEntries[i] = std::move(written[j]);
+                continue;
+            }
+            pageEntries[i] = SharePage(
+                { written[j]->PageId(), written[j]->Offset() }, pages[i].size(), hashes[i]);
+        }
+    }
+
+    for (const size_t i : batchDuplicates)
+    {
+        pageEntries[i] = CreatePageEntry(pages[i]);
+    }
+
+    return pageEntries;
+}
+
+std::vector<std::unique_ptr<HdBufferPageEntry>> HdPageFileManager::WritePageEntries(
+    TfSpan<const TfSpan<const std::byte>> pages)
+{
+    std::vector<std::unique_ptr<HdBufferPageEntry>> pageEntries(pages.size());
+
+    size_t first = 0;
+    while (first < pages.size())
+    {
+        // Group as many consecutive pages as fit into one page file.
+        size_t last      = first;
+        size_t groupSize = 0;
+        while (last < pages.size() && groupSize + pages[last].size() <= MAX_PAGE_FILE_SIZE)
+        {
+            groupSize += pages[last].size();
+            ++last;
+        }
+        if (last == first)
+        {
+            // Larger than a page file, it cannot be stored.
+            ++first;
+            continue;
+        }
+
+        HdPageFileEntry* pageEntry = nullptr;
+        std::ptrdiff_t offset      = -1;
+        {
+            std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+            pageEntry = AllocatePageRange(groupSize, offset);
+            if (pageEntry)
+            {
+                auto pageOffset = offset;
+                for (size_t i = first; i < last; ++i)
+                {
+                    pageEntry->AddPage(pageOffset, pages[i].size());
+                    pageOffset += static_cast<std::ptrdiff_t>(pages[i].size());
+                }
+                pageEntry->mActiveWriters.fetch_add(1, std::memory_order_relaxed);
+                pageEntry->mWriteGeneration.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        const TfSpan<const TfSpan<const std::byte>> group(pages.data() + first, last - first);
+        const bool written = pageEntry && pageEntry->WriteDataGather(offset, group);
+        if (pageEntry)
+        {
+            pageEntry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+        }
+        if (written)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                pageEntries[i] = std::make_unique<HdBufferPageEntry>(
+                    pageEntry->PageFileId(), pages[i].size(), offset);
+                offset += static_cast<std::ptrdiff_t>(pages[i].size());
+            }
+        }
+        else if (pageEntry)
+        {
+            // Give the reserved range back.
+            std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+            auto pageOffset = offset;
+            for (size_t i = first; i < last; ++i)
+            {
+                pageEntry->RemovePage(pageOffset, pages[i].size());
+                pageOffset += static_cast<std::ptrdiff_t>(pages[i].size());
+            }
+            pageEntry->AddFreeListEntry(offset, groupSize);
+        }
+
+        first = last;
+    }
+
+    return pageEntries;
+}
+
+bool HdPageFileManager::LoadPage(const HdBufferPageEntry& handle, void* data)
+{
+    HdPageFileEntry* entry = nullptr;
+    std::ptrdiff_t offset  = -1;
+    {
+        // Pin the page file so compaction keeps it open while it is read.
+        std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+        entry = ResolvePage(handle, offset);
+        if (!entry)
+        {
+            return false;
+        }
+        entry->mActiveReaders.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const bool read = entry->ReadData(offset, data, handle.Size());
+    entry->mActiveReaders.fetch_sub(1, std::memory_order_release);
+    return read;
+}
+
+bool HdPageFileManager::LoadPage(const HdBufferPageEntry& handle, TfSpan<std::byte> dest)
+{
+    if (dest.size() < handle.Size())
+    {
+        return false;
+    }
+    return LoadPage(handle, dest.data());
+}
+
+bool HdPageFileManager::LoadPageRange(
+    const HdBufferPageEntry& handle, size_t offset, TfSpan<std::byte> dest)
+{
+    if (offset > handle.Size() || dest.size() > handle.Size() - offset)
+    {
+        return false;
+    }
+
+    HdPageFileEntry* entry    = nullptr;
+    std::ptrdiff_t pageOffset = -1;
+    {
+        // Pin the page file so compaction keeps it open while it is read.
+        std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+        entry = ResolvePage(handle, pageOffset);
+        if (!entry)
+        {
+            return false;
+        }
+        entry->mActiveReaders.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const bool read = entry->ReadData(
+        pageOffset + static_cast<std::ptrdiff_t>(offset), dest.data(), dest.size());
+    entry->mActiveReaders.fetch_sub(1, std::memory_order_release);
+    return read;
+}
+
+HdPageView HdPageFileManager::LoadPage(const HdBufferPageEntry& handle) const
+{
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+
+    std::ptrdiff_t offset = -1;
+    auto* entry           = ResolvePage(handle, offset);
+    if (!entry)
+    {
+        return {};
+    }
+    const auto data = entry->MappedData(offset, handle.Size());
+    if (data.empty())
+    {
+        return {};
+    }
+
+    // The view pins the page file until it is destroyed.
+    entry->mActiveReaders.fetch_add(1, std::memory_order_relaxed);
+    return HdPageView(entry, data);
+}
+
+bool HdPageFileManager::UpdatePage(const HdBufferPageEntry& handle, const void* data)
+{
+    std::ptrdiff_t offset  = -1;
+    HdPageFileEntry* entry = ResolvePageForUpdate(handle, offset);
+    if (!entry)
+    {
+        return false;
+    }
+
+    const bool written = entry->WriteData(offset, data, handle.Size());
+    entry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+    return written;
+}
+
+bool HdPageFileManager::UpdatePage(const HdBufferPageEntry& handle, TfSpan<const std::byte> data)
+{
+    return UpdatePage(handle, static_cast<const void*>(data.data()));
+}
+
+bool HdPageFileManager::UpdatePage(const HdBufferPageEntry& handle, const HdPageWriter& writer)
+{
+    std::ptrdiff_t offset  = -1;
+    HdPageFileEntry* entry = ResolvePageForUpdate(handle, offset);
+    if (!entry)
+    {
+        return false;
+    }
+
+    const bool written = WriteStream(*entry, offset, handle.Size(), writer);
+    entry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+    return written;
+}
+
+HdPageFileEntry* HdPageFileManager::ResolvePageForUpdate(
+    const HdBufferPageEntry& handle, std::ptrdiff_t& offset)
+{
+    // Shared pages are copied out first and pages in a slower tier may move up, which needs the
+    // exclusive lock.
+    std::shared_lock<std::shared_mutex> sharedLock(mSyncMutex, std::defer_lock);
+    std::unique_lock<std::shared_mutex> exclusiveLock(mSyncMutex, std::defer_lock);
+    HdPageFileEntry* entry = nullptr;
+    if (handle.PageId() == SHARED_PAGE_ID)
+    {
+        exclusiveLock.lock();
+        entry = DetachSharedPage(handle, offset);
+    }
+    else if (mStorageTiers.size() > 1)
+    {
+        exclusiveLock.lock();
+        entry = ResolvePage(handle, offset);
+    }
+    else
+    {
+        sharedLock.lock();
+        entry = ResolvePage(handle, offset);
+    }
+    if (!entry)
+    {
+        return nullptr;
+    }
+    if (exclusiveLock.owns_lock())
+    {
+        entry = PromotePage(entry, offset, handle.Size());
+    }
+
+    // A new write generation tells a running compaction its copy of the page is stale.
+    entry->mActiveWriters.fetch_add(1, std::memory_order_relaxed);
+    entry->mWriteGeneration.fetch_add(1, std::memory_order_relaxed);
+    return entry;
+}
+
+HdPageFileEntry* HdPageFileManager::PromotePage(
+    HdPageFileEntry* entry, std::ptrdiff_t& offset, size_t size)
+{
+    if (entry->Tier() == 0 || size == 0)
+    {
+        return entry;
+    }
+
+    std::ptrdiff_t promotedOffset = -1;
+    auto* promoted = AllocatePageRange(size, promotedOffset, 0, entry->Tier());
+    if (!promoted)
+    {
+        return entry; // The faster tiers are full, rewritten in place.
+    }
+    if (!entry->RemovePage(offset, size))
+    {
+        promoted->AddFreeListEntry(promotedOffset, size);
+        return entry;
+    }
+    promoted->AddPage(promotedOffset, size);
+    mStorageTiers[promoted->Tier()].promotedBytes += size;
+
+    // The old range stays allocated as long as its forward, so no new page of a page file still
+    // allocated from can take the offset of the forward.
+    entry->mHeldRanges.insert(offset);
+    entry->mForwards[offset] = HdPageLocation { promoted->PageFileId(), promotedOffset };
+    offset                   = promotedOffset;
+    return promoted;
+}
+
+void HdPageFileManager::ReleasePage(const HdBufferPageEntry& handle)
+{
+    if (handle.Size() == 0)
+    {
+        return; // Empty pages own no space.
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+
+    if (handle.PageId() == SHARED_PAGE_ID)
+    {
+        // Drops the alias, the shared page goes with its last alias.
+        const auto alias = mPageAliases.find(handle.Offset());
+        if (alias != mPageAliases.end())
+        {
+            const size_t sharedPageId = alias->second;
+            mPageAliases.erase(alias);
+            ReleaseSharedPage(sharedPageId);
+        }
+        return;
+    }
+
+    ReleaseLocation(handle.PageId(), handle.Offset(), handle.Size());
+}
+
+// Reserved ranges and outcome of the writes of one CreatePageEntriesAsync call. Each write
+// updates its own slot, the last one to complete hands the batch to CompletePageWrites.
+struct HdPageFileManager::PageWriteBatch
+{
+    static constexpr size_t NOT_A_DUPLICATE = std::numeric_limits<size_t>::max();
+
+    std::vector<std::unique_ptr<HdBufferPageEntry>> pageEntries;
+    std::vector<HdPageFileEntry*> pageFiles;  ///< nullptr for the pages with no reserved range
+    std::vector<std::ptrdiff_t> offsets;
+    std::vector<size_t> sizes;
+    std::vector<std::uint64_t> hashes;
+    std::vector<char> hashed;                 ///< Pages to share once written (deduplication)
+    std::vector<size_t> duplicateOf;          ///< Earlier page of the batch with the same content
+    std::vector<char> written;
+    std::atomic<size_t> remaining { 1 };      ///< Pending writes, plus one for the submission
+    HdPageEntriesCallback callback;
+};
+
+void HdPageFileManager::LoadPageAsync(
+    const HdBufferPageEntry& handle, TfSpan<std::byte> dest, HdPageIOCallback callback)
+{
+    HdPageFileEntry* entry = nullptr;
+    std::ptrdiff_t offset  = -1;
+    if (dest.size() >= handle.Size())
+    {
+        // Pin the page file so compaction keeps it open until the read completed.
+        std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+        entry = ResolvePage(handle, offset);
+        if (entry)
+        {
+            entry->mActiveReaders.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (!entry)
+    {
+        if (callback)
+        {
+            callback(false);
+        }
+        return;
+    }
+
+    HdPageIORequest request;
+    request.op       = HdPageIORequest::Op::Read;
+    request.file     = entry;
+    request.offset   = offset;
+    request.data     = dest.data();
+    request.size     = handle.Size();
+    request.callback = [entry, callback = std::move(callback)](bool success)
+    {
+        entry->mActiveReaders.fetch_sub(1, std::memory_order_release);
+        if (callback)
+        {
+            callback(success);
+        }
+    };
+    GetIOEngine().Submit(std::move(request));
+}
+
+std::future<bool> HdPageFileManager::LoadPageAsync(
+    const HdBufferPageEntry& handle, TfSpan<std::byte> dest)
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future  = promise->get_future();
+    LoadPageAsync(handle, dest, [promise](bool success) { promise->set_value(success); });
+    return future;
+}
+
+void HdPageFileManager::UpdatePageAsync(
+    const HdBufferPageEntry& handle, TfSpan<const std::byte> data, HdPageIOCallback callback)
+{
+    std::ptrdiff_t offset  = -1;
+    HdPageFileEntry* entry = nullptr;
+    if (data.size() >= handle.Size())
+    {
+        entry = ResolvePageForUpdate(handle, offset);
+    }
+    if (!entry)
+    {
+        if (callback)
+        {
+            callback(false);
+        }
+        return;
+    }
+
+    HdPageIORequest request;
+    request.op       = HdPageIORequest::Op::Write;
+    request.file     = entry;
+    request.offset   = offset;
+    request.data     = const_cast<std::byte*>(data.data());
+    request.size     = handle.Size();
+    request.callback = [entry, callback = std::move(callback)](bool success)
+    {
+        entry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+        if (callback)
+        {
+            callback(success);
+        }
+    };
+    GetIOEngine().Submit(std::move(request));
+}
+
+std::future<bool> HdPageFileManager::UpdatePageAsync(
+    const HdBufferPageEntry& handle, TfSpan<const std::byte> data)
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future  = promise->get_future();
+    UpdatePageAsync(handle, data, [promise](bool success) { promise->set_value(success); });
+    return future;
+}
+
+void HdPageFileManager::CreatePageEntriesAsync(
+    TfSpan<const TfSpan<const std::byte>> pages, HdPageEntriesCallback callback)
+{
+    auto batch = std::make_shared<PageWriteBatch>();
+    batch->pageEntries.resize(pages.size());
+    batch->pageFiles.resize(pages.size(), nullptr);
+    batch->offsets.resize(pages.size(), -1);
+    batch->sizes.resize(pages.size(), 0);
+    batch->hashes.resize(pages.size(), 0);
+    batch->hashed.resize(pages.size(), 0);
+    batch->duplicateOf.resize(pages.size(), PageWriteBatch::NOT_A_DUPLICATE);
+    batch->written.resize(pages.size(), 0);
+    batch->callback = std::move(callback);
+
+    // Pages with the content of a stored page only get an alias, like in CreatePageEntries.
+    // A page repeated within the batch becomes an alias of its first copy once that is written.
+    std::vector<size_t> newPages;
+    newPages.reserve(pages.size());
+    std::unordered_map<std::uint64_t, size_t> batchHashes;
+    for (size_t i = 0; i < pages.size(); ++i)
+    {
+        batch->sizes[i] = pages[i].size();
+        if (mDeduplication && !pages[i].empty() && pages[i].data())
+        {
+            const std::uint64_t hash =
+                ArchHash64(reinterpret_cast<const char*>(pages[i].data()), pages[i].size());
+            batch->hashes[i] = hash;
+            batch->hashed[i] = 1;
+
+            const auto first = batchHashes.find(hash);
+            if (first != batchHashes.end() && pages[first->second].size() == pages[i].size() &&
+                std::memcmp(pages[first->second].data(), pages[i].data(), pages[i].size()) == 0)
+            {
+                batch->duplicateOf[i] = first->second;
+                continue;
+            }
+            batch->pageEntries[i] = FindSharedPage(hash, pages[i].data(), pages[i].size());
+            if (batch->pageEntries[i])
+            {
+                continue;
+            }
+            batchHashes.emplace(hash, i);
+        }
+        newPages.push_back(i);
+    }
+
+    // Reserve the ranges as WritePageEntries does, as many consecutive pages per page file as fit.
+    size_t first = 0;
+    while (first < newPages.size())
+    {
+        size_t last      = first;
+        size_t groupSize = 0;
+        while (last < newPages.size() &&
+            groupSize + pages[newPages[last]].size() <= MAX_PAGE_FILE_SIZE)
+        {
+            groupSize += pages[newPages[last]].size();
+            ++last;
+        }
+        if (last == first)
+        {
+            // Larger than a page file, it cannot be stored.
+            ++first;
+            continue;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        std::ptrdiff_t offset = -1;
+        if (auto* pageEntry = AllocatePageRange(groupSize, offset))
+        {
+            for (size_t j = first; j < last; ++j)
+            {
+                const size_t i = newPages[j];
+                pageEntry->AddPage(offset, pages[i].size());
+                pageEntry->mActiveWriters.fetch_add(1, std::memory_order_relaxed);
+                batch->pageFiles[i] = pageEntry;
+                batch->offsets[i]   = offset;
+                offset += static_cast<std::ptrdiff_t>(pages[i].size());
+            }
+            pageEntry->mWriteGeneration.fetch_add(1, std::memory_order_relaxed);
+        }
+        first = last;
+    }
+
+    // One request per page; pages without data only reserve their range.
+    for (const size_t i : newPages)
+    {
+        HdPageFileEntry* pageEntry = batch->pageFiles[i];
+        if (!pageEntry)
+        {
+            continue;
+        }
+        if (pages[i].empty() || !pages[i].data())
+        {
+            batch->written[i] = 1;
+            pageEntry->mActiveWriters.fetch_sub(1, std::memory_order_release);
+            continue;
+        }
+
+        batch->remaining.fetch_add(1, std::memory_order_relaxed);
+        HdPageIORequest request;
+        request.op       = HdPageIORequest::Op::Write;
+        request.file     = pageEntry;
+        request.offset   = batch->offsets[i];
+        request.data     = const_cast<std::byte*>(pages[i].data());
+        request.size     = pages[i].size();
+        request.callback = [this, batch, i](bool success)
+        {
+            batch->written[i] = success ? 1 : 0;
+            batch->pageFiles[i]->mActiveWriters.fetch_sub(1, std::memory_order_release);
+            if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                CompletePageWrites(*batch);
+            }
+        };
+        GetIOEngine().Submit(std::move(request));
+    }
+
+    if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        CompletePageWrites(*batch);
+    }
+}
+
+void HdPageFileManager::CompletePageWrites(PageWriteBatch& batch)
+{
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        for (size_t i = 0; i < batch.pageFiles.size(); ++i)
+        {
+            HdPageFileEntry* pageEntry = batch.pageFiles[i];
+            if (!pageEntry)
+            {
+                continue;
+            }
+            if (!batch.written[i])
+            {
+                // Give the reserved range back.
+                pageEntry->RemovePage(batch.offsets[i], batch.sizes[i]);
+                pageEntry->AddFreeListEntry(batch.offsets[i], batch.sizes[i]);
+                continue;
+            }
+            if (batch.hashed[i])
+            {
+                batch.pageEntries[i] = SharePage(
+                    { pageEntry->PageFileId(), batch.offsets[i] }, batch.sizes[i], batch.hashes[i]);
+            }
+            else
+            {
+                batch.pageEntries[i] = std::make_unique<HdBufferPageEntry>(
+                    pageEntry->PageFileId(), batch.sizes[i], batch.offsets[i]);
+            }
+        }
+
+        for (size_t i = 0; i < batch.duplicateOf.size(); ++i)
+        {
+            const size_t original = batch.duplicateOf[i];
+            if (original == PageWriteBatch::NOT_A_DUPLICATE || !batch.pageEntries[original])
+            {
+                continue; // The page failed along with its first copy.
+            }
+            const auto alias = mPageAliases.find(batch.pageEntries[original]->Offset());
+            if (alias == mPageAliases.end())
+            {
+                continue;
+            }
+            ++mSharedPages[alias->second].refCount;
+            ++mDuplicateWrites;
+            mBytesNotWritten += batch.sizes[i];
+            batch.pageEntries[i] = AddPageAlias(alias->second, batch.sizes[i]);
+        }
+    }
+
+    if (batch.callback)
+    {
+        batch.callback(std::move(batch.pageEntries));
+    }
+}
+
+void HdPageFileManager::WaitForPendingIO()
+{
+    if (mIOEngineCreated.load(std::memory_order_acquire))
+    {
+        mIOEngine->WaitForIdle();
+    }
+}
+
+HdPageIOEngine& HdPageFileManager::GetIOEngine()
+{
+    std::call_once(mIOEngineOnce,
+        [this]()
+        {
+            mIOEngine = std::make_unique<HdPageIOEngine>(mIOConfig);
+            mIOEngineCreated.store(true, std::memory_order_release);
+        });
+    return *mIOEngine;
+}
+
+void HdPageFileManager::ReleaseLocation(size_t pageId, std::ptrdiff_t offset, size_t size)
+{
+    // Follow the forwards of a relocated page down to where it is stored, dropping them.
+    while (pageId < mPageFileEntries.size())
+    {
+        auto& entry  = *mPageFileEntries[pageId];
+        auto forward = entry.mForwards.find(offset);
+        if (forward == entry.mForwards.end())
+        {
+            if (entry.RemovePage(offset, size))
+            {
+                entry.AddFreeListEntry(offset, size);
+            }
+            return;
+        }
+        if (entry.mHeldRanges.erase(offset) > 0)
+        {
+            entry.AddFreeListEntry(offset, size);
+        }
+        pageId = forward->second.pageId;
+        offset = forward->second.offset;
+        entry.mForwards.erase(forward);
+    }
+}
+
+HdPageFileCompactionResult HdPageFileManager::Compact(size_t ioBudget, float maxLiveRatio)
+{
+    HdPageFileCompactionResult result;
+
+    bool expected = false;
+    if (!mCompacting.compare_exchange_strong(expected, true))
+    {
+        return result; // Another call is running.
+    }
+
+    // A page file is the largest range which can be relocated at once.
+    ioBudget = std::min(ioBudget, MAX_PAGE_FILE_SIZE);
+
+    std::vector<PageMove> moves;
+    HdPageFileEntry* source       = nullptr;
+    HdPageFileEntry* target       = nullptr;
+    std::ptrdiff_t targetOffset   = -1;
+    std::uint64_t writeGeneration = 0;
+
+    // 1. Pick the pages to move (at least one, then up to the budget) and reserve one
+    //    contiguous range for them in the current page file of the same tier.
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        source = SelectCompactionSource(maxLiveRatio);
+        if (source)
+        {
+            writeGeneration  = source->mWriteGeneration.load(std::memory_order_relaxed);
+            size_t totalSize = 0;
+            for (const auto& [offset, size] : source->mPages)
+            {
+                if (!moves.empty() && totalSize + size > ioBudget)
+                {
+                    break;
+                }
+                moves.push_back({ offset, -1, size });
+                totalSize += size;
+            }
+            target = ReservePageMoves(*source, moves, source->Tier(), targetOffset);
+        }
+    }
+
+    // 2. and 3. Copy, then publish the new locations.
+    if (target)
+    {
+        RelocatePages(*source, *target, targetOffset, moves, writeGeneration, result);
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        result.bytesReleased = ReleaseEmptyPageFiles();
+        result.pending       = SelectCompactionSource(maxLiveRatio) != nullptr;
+    }
+
+    mCompacting = false;
+    return result;
+}
+
+HdPageFileCompactionResult HdPageFileManager::MigrateColdPages(
+    size_t ioBudget, std::chrono::milliseconds minAge)
+{
+    HdPageFileCompactionResult result;
+    if (mStorageTiers.size() < 2)
+    {
+        return result;
+    }
+
+    bool expected = false;
+    if (!mMigrating.compare_exchange_strong(expected, true))
+    {
+        return result; // Another call is running.
+    }
+
+    ioBudget                     = std::min(ioBudget, MAX_PAGE_FILE_SIZE);
+    const std::int64_t coldStamp = AccessStamp() - static_cast<std::int64_t>(minAge.count());
+
+    std::vector<PageMove> moves;
+    HdPageFileEntry* source       = nullptr;
+    HdPageFileEntry* target       = nullptr;
+    std::ptrdiff_t targetOffset   = -1;
+    std::uint64_t writeGeneration = 0;
+
+    // 1. Pick the cold pages of the page file holding the most of them and reserve a range in a
+    //    slower tier. A current page file is sealed first: its tier allocates from a new page
+    //    file, so no new page takes the offset of a forward.
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        source = SelectMigrationSource(coldStamp);
+        if (source)
+        {
+            writeGeneration  = source->mWriteGeneration.load(std::memory_order_relaxed);
+            size_t totalSize = 0;
+            for (const auto& [offset, size] : source->mPages)
+            {
+                if (source->LastAccess(offset) > coldStamp)
+                {
+                    continue;
+                }
+                if (!moves.empty() && totalSize + size > ioBudget)
+                {
+                    break;
+                }
+                moves.push_back({ offset, -1, size });
+                totalSize += size;
+            }
+            target = ReservePageMoves(*source, moves, source->Tier() + 1, targetOffset);
+            if (target && IsCurrentPageFile(*source))
+            {
+                mStorageTiers[source->Tier()].currentPageId = NO_PAGE_FILE;
+            }
+        }
+    }
+
+    // 2. and 3. Copy, then publish the new locations.
+    if (target)
+    {
+        RelocatePages(*source, *target, targetOffset, moves, writeGeneration, result);
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        if (source)
+        {
+            mStorageTiers[source->Tier()].migratedBytes += result.bytesMoved;
+        }
+        result.bytesReleased = ReleaseEmptyPageFiles();
+        result.pending       = target && SelectMigrationSource(coldStamp) != nullptr;
+    }
+
+    mMigrating = false;
+    return result;
+}
+
+HdPageFileEntry* HdPageFileManager::ReservePageMoves(HdPageFileEntry& source,
+    std::vector<PageMove>& moves, size_t firstTier, std::ptrdiff_t& targetOffset)
+{
+    size_t totalSize = 0;
+    for (const auto& move : moves)
+    {
+        totalSize += move.size;
+    }
+
+    auto* target = moves.empty() ? nullptr : AllocatePageRange(totalSize, targetOffset, firstTier);
+    if (!target)
+    {
+        moves.clear();
+        return nullptr;
+    }
+
+    // The pages keep their age, a relocation is no access.
+    auto to = targetOffset;
+    for (auto& move : moves)
+    {
+        move.to = to;
+        target->AddPage(move.to, move.size);
+        if (target->mTrackAccess)
+        {
+            target->mPageAccess[move.to] = source.LastAccess(move.from);
+        }
+        to += static_cast<std::ptrdiff_t>(move.size);
+    }
+    // The source stays open while it is read, and no other relocation picks the target as its
+    // source before the new locations are published.
+    source.mActiveReaders.fetch_add(1, std::memory_order_relaxed);
+    target->mActiveWriters.fetch_add(1, std::memory_order_relaxed);
+    target->mWriteGeneration.fetch_add(1, std::memory_order_relaxed);
+    return target;
+}
+
+void HdPageFileManager::RelocatePages(HdPageFileEntry& source, HdPageFileEntry& target,
+    std::ptrdiff_t targetOffset, const std::vector<PageMove>& moves,
+    std::uint64_t writeGeneration, HdPageFileCompactionResult& result)
+{
+    size_t totalSize = 0;
+    for (const auto& move : moves)
+    {
+        totalSize += move.size;
+    }
+
+    // 2. Copy without the lock. Readers keep using the old location meanwhile.
+    std::vector<std::byte> staging(totalSize);
+    bool copied           = true;
+    size_t stagingOffset  = 0;
+    const size_t fileSize = source.PhysicalSize();
+    for (const auto& move : moves)
+    {
+        std::byte* destination = staging.data() + stagingOffset;
+        if (!source.ReadData(move.from, destination, move.size))
+        {
+            // Pages reserved without data may lie past the end of the file.
+            if (static_cast<size_t>(move.from) + move.size <= fileSize)
+            {
+                copied = false;
+                break;
+            }
+            std::memset(destination, 0, move.size);
+        }
+        stagingOffset += move.size;
+    }
+    copied = copied && target.WriteData(targetOffset, staging.data(), totalSize);
+    source.mActiveReaders.fetch_sub(1, std::memory_order_release);
+
+    // 3. Publish the new locations, unless a page was rewritten in place during the copy. Pages
+    //    released meanwhile are dropped from the target again.
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+    const bool sourceWritten =
+        source.mWriteGeneration.load(std::memory_order_acquire) != writeGeneration;
+    for (const auto& move : moves)
+    {
+        if (copied && !sourceWritten && source.RemovePage(move.from, move.size))
+        {
+            source.AddFreeListEntry(move.from, move.size);
+            source.mForwards[move.from] = HdPageLocation { target.PageFileId(), move.to };
+            result.bytesMoved += move.size;
+            ++result.pagesMoved;
+        }
+        else
+        {
+            target.RemovePage(move.to, move.size);
+            target.AddFreeListEntry(move.to, move.size);
+        }
+    }
+    target.mActiveWriters.fetch_sub(1, std::memory_order_release);
+}
+
+HdPageFileEntry* HdPageFileManager::GetCurrentPageFileEntry(size_t tier) const
+{
+    const size_t pageId = mStorageTiers[tier].currentPageId;
+    if (pageId >= mPageFileEntries.size())
+    {
+        return nullptr;
+    }
+    return mPageFileEntries[pageId].get();
+}
+
+bool HdPageFileManager::IsCurrentPageFile(const HdPageFileEntry& entry) const
+{
+    return mStorageTiers[entry.Tier()].currentPageId == entry.PageFileId();
+}
+
+HdPageFileEntry* HdPageFileManager::AllocatePageRange(
+    size_t size, std::ptrdiff_t& offset, size_t firstTier, size_t endTier)
+{
+    endTier = std::min(endTier, mStorageTiers.size());
+    for (size_t tier = firstTier; tier < endTier; ++tier)
+    {
+        auto* pageEntry = GetCurrentPageFileEntry(tier);
+        if (!pageEntry)
+        {
+            if (!CreatePageFile(tier))
+            {
+                return nullptr;
+            }
+            pageEntry = GetCurrentPageFileEntry(tier);
+        }
+
+        // A gap takes no more space; growing the file must fit in the tier's capacity.
+        offset = pageEntry->mFreeSpace.Allocate(size);
+        if (offset == -1)
+        {
+            const size_t capacity = mStorageTiers[tier].config.capacity;
+            if (capacity > 0 && TierUsedBytes(tier) + size > capacity)
+            {
+                continue;
+            }
+
+            offset = pageEntry->FindPageFileGap(size);
+            if (offset == -1)
+            {
+                // Current file is full, create new one
+                if (!CreatePageFile(tier))
+                {
+                    return nullptr;
+                }
+                pageEntry = GetCurrentPageFileEntry(tier);
+                offset    = pageEntry->FindPageFileGap(size);
+            }
+        }
+
+        if (offset != -1)
+        {
+            if (tier > firstTier)
+            {
+                mStorageTiers[tier].spilledBytes += size;
+            }
+            return pageEntry;
+        }
+    }
+    return nullptr;
+}
+
+size_t HdPageFileManager::TierUsedBytes(size_t tier) const
+{
+    size_t used = 0;
+    for (const auto& entry : mPageFileEntries)
+    {
+        if (entry->Tier() == tier)
+        {
+            used += entry->NextOffset();
+        }
+    }
+    return used;
+}
+
+HdPageFileEntry* HdPageFileManager::ResolvePage(
+    const HdBufferPageEntry& handle, std::ptrdiff_t& offset) const
+{
+    size_t pageId = handle.PageId();
+    offset        = handle.Offset();
+    if (pageId == SHARED_PAGE_ID)
+    {
+        const auto alias = mPageAliases.find(offset);
+        if (alias == mPageAliases.end())
+        {
+            return nullptr;
+        }
+        const auto sharedPage = mSharedPages.find(alias->second);
+        if (sharedPage == mSharedPages.end())
+        {
+            return nullptr;
+        }
+        pageId = sharedPage->second.location.pageId;
+        offset = sharedPage->second.location.offset;
+    }
+
+    // Resolved pages are about to be read or written, which keeps them in their tier.
+    auto* entry = ResolveLocation(pageId, offset);
+    if (entry)
+    {
+        entry->TouchPage(offset);
+    }
+    return entry;
+}
+
+HdPageFileEntry* HdPageFileManager::ResolveLocation(size_t pageId, std::ptrdiff_t& offset) const
+{
+    while (pageId < mPageFileEntries.size())
+    {
+        auto* entry        = mPageFileEntries[pageId].get();
+        const auto forward = entry->FindForward(offset);
+        if (!forward)
+        {
+            return entry;
+        }
+        pageId = forward->pageId;
+        offset = forward->offset;
+    }
+    return nullptr;
+}
+
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::FindSharedPage(
+    std::uint64_t hash, const void* data, size_t size)
+{
+    size_t sharedPageId = 0;
+    HdPageLocation location;
+    {
+        // The reference keeps the candidate alive (and unchanged) while it is compared.
+        std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+        const auto [first, last] = mSharedPageIndex.equal_range(hash);
+        auto candidate           = first;
+        while (candidate != last && mSharedPages[candidate->second].size != size)
+        {
+            ++candidate;
+        }
+        if (candidate == last)
+        {
+            return nullptr;
+        }
+        sharedPageId     = candidate->second;
+        auto& sharedPage = mSharedPages[sharedPageId];
+        ++sharedPage.refCount;
+        location = sharedPage.location;
+    }
+
+    const bool identical = ComparePage(location, data, size);
+
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+    if (!identical)
+    {
+        ReleaseSharedPage(sharedPageId); // Hash collision
+        return nullptr;
     }
+    ++mDuplicateWrites;
+    mBytesNotWritten += size;
+    return AddPageAlias(sharedPageId, size);
 }
 
-std::ptrdiff_t HdPageFileEntry::FindPageFileGap(size_t size)
+bool HdPageFileManager::ComparePage(
+    const HdPageLocation& location, const void* data, size_t size) const
 {
-    ConsolidateFreeList();
-
-    // Find a gap that fits the size
-    for (auto it = mFreeList.begin(); it != mFreeList.end(); ++it)
+    HdPageFileEntry* entry = nullptr;
+    std::ptrdiff_t offset  = location.offset;
     {
-        if (it->size < size)
+        std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+        entry = ResolveLocation(location.pageId, offset);
+        if (!entry)
         {
-            continue;
+            return false;
         }
+        entry->mActiveReaders.fetch_add(1, std::memory_order_relaxed);
+    }
 
-        std::ptrdiff_t offset = it->offset;
-
-        // If the gap is larger than needed, split it
-        if (it->size > size)
-        {
-            it->offset += size;
-            it->size -= size;
-        }
-        else
+    bool identical      = true;
+    const auto* content = static_cast<const std::byte*>(data);
+    const auto mapped   = entry->MappedData(offset, size);
+    if (!mapped.empty())
+    {
+        identical = std::memcmp(mapped.data(), content, size) == 0;
+    }
+    else
+    {
+        // Compare in chunks, so large pages need no page-sized buffer.
+        constexpr size_t chunkSize = static_cast<size_t>(64) * ONE_KiB;
+        std::vector<std::byte> chunk(std::min(size, chunkSize));
+        for (size_t done = 0; identical && done < size; done += chunk.size())
         {
-            // Use the entire gap
-            mFreeList.erase(it);
+            const size_t count = std::min(chunk.size(), size - done);
+            identical = entry->ReadData(offset + static_cast<std::ptrdiff_t>(done), chunk.data(),
+                            count) &&
+                std::memcmp(chunk.data(), content + done, count) == 0;
         }
-
-        return offset;
     }
 
-    // No suitable gap found, use end of file
-    std::ptrdiff_t offset = mNextOffset;
-    if (SetNextOffset(mNextOffset + size))
-    {
-        return offset;
-    }
-    return -1;
+    entry->mActiveReaders.fetch_sub(1, std::memory_order_release);
+    return identical;
 }
 
-bool HdPageFileEntry::SetNextOffset(std::ptrdiff_t offset)
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::SharePage(
+    const HdPageLocation& location, size_t size, std::uint64_t hash)
 {
-    if (static_cast<size_t>(offset) > mSizeLimit)
-    {
-        return false;
-    }
-    mNextOffset = offset;
-    return true;
+    const size_t sharedPageId = mNextSharedPageId++;
+    mSharedPages.emplace(sharedPageId, SharedPage { location, size, hash, 1, true });
+    mSharedPageIndex.emplace(hash, sharedPageId);
+    return AddPageAlias(sharedPageId, size);
 }
 
-void HdPageFileEntry::AddFreeListEntry(std::ptrdiff_t offset, size_t size)
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::AddPageAlias(size_t sharedPageId, size_t size)
 {
-    mFreeList.emplace_back(offset, size);
-    mFreeListConsolidated = false;
+    const std::ptrdiff_t aliasId = mNextAliasId++;
+    mPageAliases.emplace(aliasId, sharedPageId);
+    return std::make_unique<HdBufferPageEntry>(SHARED_PAGE_ID, size, aliasId);
 }
 
-void HdPageFileEntry::ConsolidateFreeList()
+void HdPageFileManager::ReleaseSharedPage(size_t sharedPageId)
 {
-    if (mFreeListConsolidated)
+    const auto sharedPage = mSharedPages.find(sharedPageId);
+    if (sharedPage == mSharedPages.end() || --sharedPage->second.refCount > 0)
     {
         return;
     }
+    UnindexSharedPage(sharedPageId, sharedPage->second);
+    ReleaseLocation(sharedPage->second.location.pageId, sharedPage->second.location.offset,
+        sharedPage->second.size);
+    mSharedPages.erase(sharedPage);
+}
 
-    if (mFreeList.empty())
+void HdPageFileManager::UnindexSharedPage(size_t sharedPageId, SharedPage& page)
+{
+    if (!page.indexed)
     {
-        mFreeListConsolidated = true;
         return;
     }
-
-    // Sort by offset
-    std::sort(mFreeList.begin(), mFreeList.end(),
-        [](const HdFreeListEntry& a, const HdFreeListEntry& b) { return a.offset < b.offset; });
-
-    // Merge adjacent entries
-    auto it = mFreeList.begin();
-    while (it != mFreeList.end() - 1)
+    const auto [first, last] = mSharedPageIndex.equal_range(page.hash);
+    for (auto it = first; it != last; ++it)
     {
-        auto next = it + 1;
-        if (it->offset + static_cast<std::ptrdiff_t>(it->size) == next->offset)
-        {
-            // Merge with next entry
-            it->size += next->size;
-            mFreeList.erase(next);
-        }
-        else
+        if (it->second == sharedPageId)
         {
-            ++it;
+            mSharedPageIndex.erase(it);
+            break;
         }
     }
+    page.indexed = false;
+}
+
+HdPageFileEntry* HdPageFileManager::DetachSharedPage(
+    const HdBufferPageEntry& handle, std::ptrdiff_t& offset)
+{
+    const auto alias = mPageAliases.find(handle.Offset());
+    if (alias == mPageAliases.end())
+    {
+        return nullptr;
+    }
+    auto& page = mSharedPages[alias->second];
+
+    if (page.refCount == 1)
+    {
+        // Sole owner: written in place, but the content no longer matches the hash.
+        UnindexSharedPage(alias->second, page);
+        offset = page.location.offset;
+        return ResolveLocation(page.location.pageId, offset);
+    }
 
-    // Remove zero-sized entries
-    mFreeList.erase(std::remove_if(mFreeList.begin(), mFreeList.end(),
-                        [](const HdFreeListEntry& entry) { return entry.size == 0; }),
-        mFreeList.end());
+    // Copy on write: the handle gets a page of its own, the other aliases keep the content.
+    auto* entry = AllocatePageRange(page.size, offset);
+    if (!entry)
+    {
+        return nullptr;
+    }
+    entry->AddPage(offset, page.size);
+    --page.refCount;
 
-    mFreeListConsolidated = true;
+    const size_t sharedPageId = mNextSharedPageId++;
+    mSharedPages.emplace(sharedPageId,
+        SharedPage { { entry->PageFileId(), offset }, page.size, 0, 1, false });
+    alias->second = sharedPageId;
+    return entry;
 }
 
-bool HdPageFileEntry::WriteData(std::ptrdiff_t offset, const void* data, size_t size)
+std::unique_ptr<HdBufferPageEntry> HdPageFileManager::FindPersistentPage(
+    const HdPersistentPageKey& key)
 {
-    std::lock_guard<std::mutex> lock(mFileMutex);
-    if (!mFile.is_open())
+    if (!mPersistent)
     {
-        return false;
+        return nullptr;
     }
 
-    // nullptr is allowed for buffers with scene state but no backing storage
-    if (data)
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+    auto page = mPersistentPages.find(PersistentPageName(key));
+    if (page == mPersistentPages.end() || page->second.contentHash != key.contentHash)
     {
-        mFile.clear();
-        mFile.seekp(offset);
-        if (!mFile)
-        {
-            return false;
-        }
-        mFile.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
-        mFile.flush();
+        return nullptr;
+    }
+    auto sharedPage = mSharedPages.find(page->second.sharedPageId);
+    if (sharedPage == mSharedPages.end())
+    {
+        return nullptr;
     }
-    return static_cast<bool>(mFile);
+    page->second.lastSession = mSession;
+    ++sharedPage->second.refCount;
+    return AddPageAlias(page->second.sharedPageId, sharedPage->second.size);
 }
 
-bool HdPageFileEntry::ReadData(std::ptrdiff_t offset, void* data, size_t size)
+bool HdPageFileManager::StorePersistentPage(
+    const HdPersistentPageKey& key, std::unique_ptr<HdBufferPageEntry>& pageEntry)
 {
-    std::lock_guard<std::mutex> lock(mFileMutex);
-    if ((!mFile.is_open()) || (size > 0 && !data))
+    if (!mPersistent || !pageEntry || !pageEntry->IsValid() || pageEntry->Size() == 0)
     {
         return false;
     }
 
-    if (data)
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+
+    // The cache holds a reference on the shared page, plain pages become shared pages first.
+    size_t sharedPageId = 0;
+    if (pageEntry->PageId() == SHARED_PAGE_ID)
     {
-        mFile.clear();
-        mFile.seekg(offset);
-        if (!mFile)
+        const auto alias = mPageAliases.find(pageEntry->Offset());
+        if (alias == mPageAliases.end())
         {
             return false;
         }
-        mFile.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        sharedPageId = alias->second;
     }
-    return mFile && mFile.gcount() == static_cast<std::streamsize>(size);
+    else
+    {
+        sharedPageId = mNextSharedPageId++;
+        mSharedPages.emplace(sharedPageId,
+            SharedPage { { pageEntry->PageId(), pageEntry->Offset() }, pageEntry->Size(), 0, 1,
+                false });
+        pageEntry = AddPageAlias(sharedPageId, pageEntry->Size());
+    }
+    ++mSharedPages[sharedPageId].refCount;
+
+    auto [page, inserted] = mPersistentPages.try_emplace(PersistentPageName(key));
+    if (!inserted)
+    {
+        ReleaseSharedPage(page->second.sharedPageId); // Replaced content
+    }
+    page->second = PersistentPage { key.contentHash, sharedPageId, mSession };
+    return true;
 }
 
-// HdPageFileManager Implementation
-HdPageFileManager::HdPageFileManager(std::filesystem::path pageFileDirectory) :
-    mPageFileDirectory(std::move(pageFileDirectory))
+void HdPageFileManager::ClearPersistentPages()
+{
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+    for (const auto& [name, page] : mPersistentPages)
+    {
+        ReleaseSharedPage(page.sharedPageId);
+    }
+    mPersistentPages.clear();
+}
+
+size_t HdPageFileManager::GetPersistentPageCount() const
 {
-    // Create initial page file
-    CreatePageFile();
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+    return mPersistentPages.size();
 }
 
-HdPageFileManager::~HdPageFileManager()
+std::string HdPageFileManager::PersistentPageName(const HdPersistentPageKey& key)
 {
-    mPageFileEntries.clear();
+    // The parts are separated by a character which cannot appear in a path.
+    std::string name;
+    name.reserve(key.stage.size() + key.primPath.size() + key.attribute.size() + 2);
+    name.append(key.stage).push_back('\0');
+    name.append(key.primPath).push_back('\0');
+    name.append(key.attribute);
+    return name;
+}
 
-    // Clean up temp directory
-    try
+bool HdPageFileManager::LoadPersistentIndex()
+{
+    const auto indexPath = mPageFileDirectory / PERSISTENT_INDEX_FILE_NAME;
+    std::vector<char> index;
     {
-        if (std::filesystem::exists(mPageFileDirectory))
+        std::ifstream file(indexPath, std::ios::binary);
+        if (!file)
         {
-            std::filesystem::remove_all(mPageFileDirectory);
+            return false;
         }
+        index.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Pages released during this session may be overwritten, so the index is only valid again
+    // once it is written back.
+    try
+    {
+        std::filesystem::remove(indexPath);
     }
     catch (const std::filesystem::filesystem_error&)
     {
-        // Ignore cleanup errors
+        return false;
     }
-}
 
-std::unique_ptr<HdBufferPageEntry> HdPageFileManager::CreatePageEntry(const void* data, size_t size)
-{
-    std::lock_guard<std::mutex> lock(mSyncMutex);
+    IndexReader reader(index);
+    char magic[sizeof(PERSISTENT_INDEX_MAGIC)] = {};
+    std::uint64_t session   = 0;
+    std::uint64_t fileCount = 0;
+    std::uint64_t pageCount = 0;
+    if (!reader.Read(magic, sizeof(magic)) ||
+        std::memcmp(magic, PERSISTENT_INDEX_MAGIC, sizeof(magic)) != 0 || !reader.Read(session) ||
+        !reader.Read(fileCount) || !reader.Read(pageCount) ||
+        fileCount > MAX_PERSISTENT_PAGE_FILES)
+    {
+        TF_WARN("Ignoring the invalid page index '%s'.\n", indexPath.string().c_str());
+        return false;
+    }
 
-    auto* pageEntry = GetCurrentPageFileEntry();
-    if (!pageEntry)
+    struct IndexedPage
     {
-        if (!CreatePageFile())
+        std::string name;
+        PersistentPage page;
+        HdPageLocation location;
+        size_t size = 0;
+    };
+    std::vector<IndexedPage> pages;
+    for (std::uint64_t i = 0; i < pageCount; ++i)
+    {
+        IndexedPage indexed;
+        std::uint64_t pageId = 0;
+        std::int64_t offset  = 0;
+        std::uint64_t size   = 0;
+        if (!reader.Read(indexed.name) || !reader.Read(indexed.page.contentHash) ||
+            !reader.Read(indexed.page.lastSession) || !reader.Read(pageId) ||
+            !reader.Read(offset) || !reader.Read(size) || pageId >= fileCount || offset < 0 ||
+            size == 0)
         {
-            return nullptr;
+            TF_WARN("Ignoring the invalid page index '%s'.\n", indexPath.string().c_str());
+            return false;
         }
-        pageEntry = GetCurrentPageFileEntry();
+        indexed.location = { static_cast<size_t>(pageId), static_cast<std::ptrdiff_t>(offset) };
+        indexed.size     = static_cast<size_t>(size);
+        pages.push_back(std::move(indexed));
     }
 
-    // Try to find a gap first
-    std::ptrdiff_t offset = pageEntry->FindPageFileGap(size);
-    if (offset == -1)
+    mSession = session + 1;
+    for (size_t pageId = 0; pageId < fileCount; ++pageId)
     {
-        // Current file is full, create new one
-        if (!CreatePageFile())
+        // Reattached in the tier holding the file, the first one if the file is gone.
+        size_t tier = 0;
+        while (tier < mStorageTiers.size() &&
+            !std::filesystem::exists(mStorageTiers[tier].config.directory /
+                TfStringPrintf("page_%zu.bin", pageId)))
         {
-            return nullptr;
+            ++tier;
+        }
+        if (!CreatePageFile(tier < mStorageTiers.size() ? tier : 0))
+        {
+            mPageFileEntries.clear();
+            return false;
         }
-        pageEntry = GetCurrentPageFileEntry();
-        offset    = pageEntry->FindPageFileGap(size);
     }
 
-    if (offset == -1)
+    // Register the pages which are still recent and inside their page file.
+    for (auto& indexed : pages)
     {
-        return nullptr;
+        auto& entry = *mPageFileEntries[indexed.location.pageId];
+        if (mSession - indexed.page.lastSession > PERSISTENT_PAGE_MAX_SESSIONS ||
+            indexed.location.offset + indexed.size > entry.PhysicalSize() ||
+            entry.mPages.count(indexed.location.offset) > 0)
+        {
+            continue;
+        }
+        entry.AddPage(indexed.location.offset, indexed.size);
+        indexed.page.sharedPageId = mNextSharedPageId++;
+        mSharedPages.emplace(indexed.page.sharedPageId,
+            SharedPage { indexed.location, indexed.size, 0, 1, false });
+        mPersistentPages.emplace(std::move(indexed.name), indexed.page);
     }
 
-    // Write data to file
-    if (!pageEntry->WriteData(offset, data, size))
+    // Everything else in the page files is free space. The tails are given back to the OS, and
+    // older page files without pages are removed.
+    for (auto& entry : mPageFileEntries)
     {
-        return nullptr;
-    }
+        if (entry->mPages.empty() && !IsCurrentPageFile(*entry))
+        {
+            entry->Close();
+            continue;
+        }
 
-    return std::make_unique<HdBufferPageEntry>(pageEntry->PageFileId(), size, offset);
-}
+        std::ptrdiff_t end = 0;
+        for (const auto& [offset, size] : entry->mPages)
+        {
+            end = std::max(end, offset + static_cast<std::ptrdiff_t>(size));
+        }
+        entry->SetNextOffset(end);
 
-std::unique_ptr<HdBufferPageEntry> HdPageFileManager::CreatePageEntry(TfSpan<const std::byte> data)
-{
-    return CreatePageEntry(data.data(), data.size());
+        std::ptrdiff_t cursor = 0;
+        for (const auto& [offset, size] : entry->mPages)
+        {
+            if (offset > cursor)
+            {
+                entry->AddFreeListEntry(cursor, static_cast<size_t>(offset - cursor));
+            }
+            cursor = std::max(cursor, offset + static_cast<std::ptrdiff_t>(size));
+        }
+        entry->Truncate();
+    }
+    return !mPageFileEntries.empty();
 }
 
-bool HdPageFileManager::LoadPage(const HdBufferPageEntry& handle, void* data)
+bool HdPageFileManager::SavePersistentIndex()
 {
-    std::lock_guard<std::mutex> lock(mSyncMutex);
+    std::unique_lock<std::shared_mutex> lock(mSyncMutex);
+
+    std::vector<char> index;
+    AppendToIndex(index, PERSISTENT_INDEX_MAGIC, sizeof(PERSISTENT_INDEX_MAGIC));
+    AppendToIndex(index, mSession);
+    AppendToIndex(index, static_cast<std::uint64_t>(mPageFileEntries.size()));
+    const size_t pageCountOffset = index.size();
+    AppendToIndex(index, std::uint64_t { 0 });
 
-    if (handle.PageId() >= mPageFileEntries.size())
+    // Pages are recorded where they are stored now, following the compaction forwards.
+    std::vector<std::ptrdiff_t> fileEnds(mPageFileEntries.size(), 0);
+    std::uint64_t pageCount = 0;
+    for (const auto& [name, page] : mPersistentPages)
     {
-        return false;
+        const auto sharedPage = mSharedPages.find(page.sharedPageId);
+        if (sharedPage == mSharedPages.end())
+        {
+            continue;
+        }
+        std::ptrdiff_t offset = sharedPage->second.location.offset;
+        auto* entry = ResolveLocation(sharedPage->second.location.pageId, offset);
+        if (!entry || entry->IsClosed())
+        {
+            continue;
+        }
+        AppendToIndex(index, name);
+        AppendToIndex(index, page.contentHash);
+        AppendToIndex(index, page.lastSession);
+        AppendToIndex(index, static_cast<std::uint64_t>(entry->PageFileId()));
+        AppendToIndex(index, static_cast<std::int64_t>(offset));
+        AppendToIndex(index, static_cast<std::uint64_t>(sharedPage->second.size));
+        ++pageCount;
+
+        const auto end = offset + static_cast<std::ptrdiff_t>(sharedPage->second.size);
+        fileEnds[entry->PageFileId()] = std::max(fileEnds[entry->PageFileId()], end);
+        entry->mKeepFile              = true;
     }
+    std::memcpy(index.data() + pageCountOffset, &pageCount, sizeof(pageCount));
 
-    auto& entry = mPageFileEntries[handle.PageId()];
-    return entry->ReadData(handle.Offset(), data, handle.Size());
-}
+    // Only the persistent pages are kept, the rest of the file tails is dropped.
+    for (auto& entry : mPageFileEntries)
+    {
+        if (entry->mKeepFile && entry->SetNextOffset(fileEnds[entry->PageFileId()]))
+        {
+            entry->Truncate();
+        }
+    }
 
-bool HdPageFileManager::LoadPage(const HdBufferPageEntry& handle, TfSpan<std::byte> dest)
-{
-    if (dest.size() < handle.Size())
+    // Written next to the index and renamed, so the index is never seen half written.
+    const auto indexPath = mPageFileDirectory / PERSISTENT_INDEX_FILE_NAME;
+    auto tempPath        = indexPath;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(index.data(), static_cast<std::streamsize>(index.size()));
+        if (!file)
+        {
+            TF_WARN("Failed to write the page index '%s'.\n", tempPath.string().c_str());
+            return false;
+        }
+    }
+    try
     {
+        std::filesystem::rename(tempPath, indexPath);
+    }
+    catch (const std::filesystem::filesystem_error&)
+    {
+        TF_WARN("Failed to write the page index '%s'.\n", indexPath.string().c_str());
         return false;
     }
-    return LoadPage(handle, dest.data());
+    return true;
 }
 
-bool HdPageFileManager::UpdatePage(const HdBufferPageEntry& handle, const void* data)
+void HdPageFileManager::RemovePageFiles()
 {
-    std::lock_guard<std::mutex> lock(mSyncMutex);
-
-    if (handle.PageId() >= mPageFileEntries.size())
+    // Page files left behind without a valid index hold nothing which can be reused.
+    for (const auto& tier : mStorageTiers)
     {
-        return false;
+        try
+        {
+            if (!std::filesystem::exists(tier.config.directory))
+            {
+                continue;
+            }
+            for (const auto& file : std::filesystem::directory_iterator(tier.config.directory))
+            {
+                const std::string name = file.path().filename().string();
+                if (file.is_regular_file() && name.rfind("page_", 0) == 0)
+                {
+                    std::filesystem::remove(file.path());
+                }
+            }
+        }
+        catch (const std::filesystem::filesystem_error&)
+        {
+            // Ignore cleanup errors
+        }
     }
-
-    auto& entry = mPageFileEntries[handle.PageId()];
-    return entry->WriteData(handle.Offset(), data, handle.Size());
 }
 
-bool HdPageFileManager::UpdatePage(const HdBufferPageEntry& handle, TfSpan<const std::byte> data)
+HdPageFileEntry* HdPageFileManager::SelectCompactionSource(float maxLiveRatio) const
 {
-    return UpdatePage(handle, static_cast<const void*>(data.data()));
+    // The sparsest page file, other than the current ones which are still allocated from.
+    HdPageFileEntry* source = nullptr;
+    double sourceLiveRatio  = static_cast<double>(maxLiveRatio);
+    for (const auto& entry : mPageFileEntries)
+    {
+        if (IsCurrentPageFile(*entry) || entry->IsClosed() || entry->mPages.empty() ||
+            entry->mActiveWriters.load(std::memory_order_acquire) > 0)
+        {
+            continue;
+        }
+
+        const double liveRatio = static_cast<double>(entry->LiveBytes()) /
+            static_cast<double>(std::max<std::ptrdiff_t>(entry->NextOffset(), 1));
+        if (liveRatio <= sourceLiveRatio)
+        {
+            source          = entry.get();
+            sourceLiveRatio = liveRatio;
+        }
+    }
+    return source;
 }
 
-void HdPageFileManager::ReleasePage(const HdBufferPageEntry& handle)
+HdPageFileEntry* HdPageFileManager::SelectMigrationSource(std::int64_t coldStamp) const
 {
-    std::lock_guard<std::mutex> lock(mSyncMutex);
-
-    if (handle.PageId() >= mPageFileEntries.size())
+    // The page file with the most cold bytes in a tier with a slower one below it. The current
+    // page file of a tier only qualifies once it is mostly cold, since migrating seals it.
+    HdPageFileEntry* source = nullptr;
+    size_t sourceColdBytes  = 0;
+    for (const auto& entry : mPageFileEntries)
     {
-        return;
-    }
+        if (!entry->mTrackAccess || entry->IsClosed() || entry->mPages.empty() ||
+            entry->mActiveWriters.load(std::memory_order_acquire) > 0)
+        {
+            continue;
+        }
 
-    auto& entry = mPageFileEntries[handle.PageId()];
-    entry->AddFreeListEntry(handle.Offset(), handle.Size());
+        size_t coldBytes = 0;
+        for (const auto& [offset, size] : entry->mPages)
+        {
+            if (entry->LastAccess(offset) <= coldStamp)
+            {
+                coldBytes += size;
+            }
+        }
+        if (IsCurrentPageFile(*entry) && coldBytes * 2 < entry->LiveBytes())
+        {
+            continue;
+        }
+        if (coldBytes > sourceColdBytes)
+        {
+            source          = entry.get();
+            sourceColdBytes = coldBytes;
+        }
+    }
+    return source;
 }
 
-HdPageFileEntry* HdPageFileManager::GetCurrentPageFileEntry() const
+size_t HdPageFileManager::ReleaseEmptyPageFiles()
 {
-    if (mPageFileEntries.empty())
+    size_t released = 0;
+    for (const auto& entry : mPageFileEntries)
     {
-        return nullptr;
+        if (entry->IsClosed())
+        {
+            continue;
+        }
+
+        // Files in use are left for the next compaction pass: a read or view of a page past
+        // the new end would hit EOF or fault, whatever the IO mode.
+        const bool idle = entry->mActiveReaders.load(std::memory_order_acquire) == 0 &&
+            entry->mActiveWriters.load(std::memory_order_acquire) == 0;
+        if (!idle)
+        {
+            continue;
+        }
+
+        // Unused once all pages moved out. Otherwise only the free tail is given back.
+        if (!IsCurrentPageFile(*entry) && entry->mPages.empty())
+        {
+            released += entry->Close();
+        }
+        else
+        {
+            released += entry->Truncate();
+        }
     }
-    return mPageFileEntries.back().get();
+    return released;
 }
 
-bool HdPageFileManager::CreatePageFile()
+bool HdPageFileManager::CreatePageFile(size_t tier)
 {
     // Create temp directory if it doesn't exist
+    const auto& directory = mStorageTiers[tier].config.directory;
     try
     {
-        std::filesystem::create_directories(mPageFileDirectory);
+        std::filesystem::create_directories(directory);
     }
     catch (const std::filesystem::filesystem_error&)
     {
-        TF_WARN("Failed to create page file directory: %s", mPageFileDirectory.string().c_str());
+        TF_WARN("Failed to create page file directory: %s", directory.string().c_str());
         return false;
     }
 
+    // Page file ids are unique over all tiers.
     auto pageId = mPageFileEntries.size();
-    std::string filename =
-        TfStringPrintf("%s/page_%zu.bin", mPageFileDirectory.string().c_str(), pageId);
+    std::string filename = TfStringPrintf("%s/page_%zu.bin", directory.string().c_str(), pageId);
 
-    auto pageEntry = std::make_unique<HdPageFileEntry>(filename, pageId);
+    auto pageEntry          = std::make_unique<HdPageFileEntry>(filename, pageId, mIOMode, tier);
+    pageEntry->mTrackAccess = tier + 1 < mStorageTiers.size();
     mPageFileEntries.push_back(std::move(pageEntry));
+    mStorageTiers[tier].currentPageId = pageId;
 
     return true;
 }
 
 size_t HdPageFileManager::GetTotalDiskUsage() const
 {
-    std::lock_guard<std::mutex> lock(mSyncMutex);
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
 
     size_t total = 0;
     for (const auto& entry : mPageFileEntries)
@@ -392,9 +2890,86 @@ size_t HdPageFileManager::GetTotalDiskUsage() const
     return total;
 }
 
+HdPageFileFragmentation HdPageFileManager::GetFragmentationStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+    return CollectFragmentationStats();
+}
+
+HdPageFileFragmentation HdPageFileManager::CollectFragmentationStats() const
+{
+    HdPageFileFragmentation stats;
+    for (const auto& entry : mPageFileEntries)
+    {
+        const auto& freeSpace = entry->FreeSpace();
+        stats.fileBytes += entry->NextOffset();
+        stats.freeBytes += freeSpace.FreeBytes();
+        stats.holeCount += freeSpace.HoleCount();
+        stats.largestHole = std::max(stats.largestHole, freeSpace.LargestHole());
+    }
+    return stats;
+}
+
+HdPageDedupStats HdPageFileManager::GetDeduplicationStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+    return CollectDeduplicationStats();
+}
+
+HdPageDedupStats HdPageFileManager::CollectDeduplicationStats() const
+{
+    HdPageDedupStats stats;
+    stats.sharedPages     = mSharedPages.size();
+    stats.handles         = mPageAliases.size();
+    stats.duplicateWrites = mDuplicateWrites;
+    stats.bytesNotWritten = mBytesNotWritten;
+    for (const auto& [aliasId, sharedPageId] : mPageAliases)
+    {
+        const auto page = mSharedPages.find(sharedPageId);
+        stats.logicalBytes += (page != mSharedPages.end()) ? page->second.size : 0;
+    }
+    for (const auto& [sharedPageId, page] : mSharedPages)
+    {
+        stats.physicalBytes += page.size;
+    }
+    return stats;
+}
+
+std::vector<HdPageTierStats> HdPageFileManager::GetStorageTierStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
+    return CollectTierStats();
+}
+
+std::vector<HdPageTierStats> HdPageFileManager::CollectTierStats() const
+{
+    std::vector<HdPageTierStats> stats(mStorageTiers.size());
+    for (size_t tier = 0; tier < mStorageTiers.size(); ++tier)
+    {
+        stats[tier].directory     = mStorageTiers[tier].config.directory;
+        stats[tier].capacity      = mStorageTiers[tier].config.capacity;
+        stats[tier].spilledBytes  = mStorageTiers[tier].spilledBytes;
+        stats[tier].migratedBytes = mStorageTiers[tier].migratedBytes;
+        stats[tier].promotedBytes = mStorageTiers[tier].promotedBytes;
+    }
+    for (const auto& entry : mPageFileEntries)
+    {
+        if (entry->IsClosed())
+        {
+            continue;
+        }
+        auto& tierStats = stats[entry->Tier()];
+        tierStats.usedBytes += entry->NextOffset();
+        tierStats.liveBytes += entry->LiveBytes();
+        tierStats.pageCount += entry->mPages.size();
+        ++tierStats.pageFileCount;
+    }
+    return stats;
+}
+
 void HdPageFileManager::PrintPagerStats() const
 {
-    std::lock_guard<std::mutex> lock(mSyncMutex);
+    std::shared_lock<std::shared_mutex> lock(mSyncMutex);
 
     size_t totalDiskUsage = 0;
     for (const auto& entry : mPageFileEntries)
@@ -413,17 +2988,62 @@ void HdPageFileManager::PrintPagerStats() const
         }
     }
 
+    const HdPageFileFragmentation fragmentation = CollectFragmentationStats();
+
     // clang-format off
     TF_STATUS(
         "\n=== Page Manager Statistics ===\n"
         "Page File Count: %zu\n"
+        "I/O Mode: %s\n"
         "Total Disk Usage: %s\n"
         "Max File Size: %s\n"
+        "Free Space: %s in %zu holes (largest %s)\n"
         "========================\n",
         mPageFileEntries.size(),
+        IOModeName(mIOMode),
         FormatBytes(totalDiskUsage).c_str(),
-        FormatBytes(MAX_PAGE_FILE_SIZE).c_str());
+        FormatBytes(MAX_PAGE_FILE_SIZE).c_str(),
+        FormatBytes(fragmentation.freeBytes).c_str(),
+        fragmentation.holeCount,
+        FormatBytes(fragmentation.largestHole).c_str());
     // clang-format on
+
+    if (mIOEngineCreated.load(std::memory_order_acquire))
+    {
+        const HdPageIOStats io = mIOEngine->GetStats();
+        TF_STATUS("Page I/O Engine: %s, queue depth %zu, %zu requests in %zu operations "
+                  "(%zu merged), %zu failed, %zu in flight at most\n",
+            mIOEngine->GetBackend() == HdPageIOBackend::IOUring ? "io_uring" : "thread pool",
+            mIOEngine->GetConfig().queueDepth, io.completed, io.operations, io.merged, io.failed,
+            io.maxInFlight);
+    }
+    if (mStorageTiers.size() > 1)
+    {
+        const std::vector<HdPageTierStats> tiers = CollectTierStats();
+        for (size_t tier = 0; tier < tiers.size(); ++tier)
+        {
+            TF_STATUS("Storage Tier %zu: %s / %s, %zu pages in %zu files, %s migrated out\n", tier,
+                FormatBytes(tiers[tier].usedBytes).c_str(),
+                tiers[tier].capacity == 0 ? "unlimited"
+                                          : FormatBytes(tiers[tier].capacity).c_str(),
+                tiers[tier].pageCount, tiers[tier].pageFileCount,
+                FormatBytes(tiers[tier].migratedBytes).c_str());
+        }
+    }
+    if (mPersistent)
+    {
+        TF_STATUS("Persistent Pages: %zu (session %llu)\n", mPersistentPages.size(),
+            static_cast<unsigned long long>(mSession));
+    }
+    if (mDeduplication)
+    {
+        const HdPageDedupStats dedup = CollectDeduplicationStats();
+        TF_STATUS("Page Deduplication: %zu handles on %zu pages, %s stored for %s (%.2fx), "
+                  "%zu duplicate writes skipped (%s)\n",
+            dedup.handles, dedup.sharedPages, FormatBytes(dedup.physicalBytes).c_str(),
+            FormatBytes(dedup.logicalBytes).c_str(), dedup.Ratio(), dedup.duplicateWrites,
+            FormatBytes(dedup.bytesNotWritten).c_str());
+    }
 }
 
 } // namespace HVT_NS
\ No newline at end of file
@@ -0,0 +1,602 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageIOEngine.h>
+
+#include <hvt/pageableBuffer/pageFileManager.h>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/span.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define HVT_PAGE_IO_URING 1
+#endif
+#endif
+#endif
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+
+struct HdPageIOEngine::IOBatch
+{
+    HdPageIORequest::Op op = HdPageIORequest::Op::Read;
+    HdPageFileEntry* file  = nullptr;
+    std::ptrdiff_t offset  = 0;
+    size_t size            = 0;
+    std::vector<HdPageIORequest> requests; ///< In file order, back to back from offset
+};
+
+#if defined(HVT_PAGE_IO_URING)
+
+// Minimal io_uring setup through the raw system calls (no liburing dependency). The rings are
+// only used by the engine's I/O thread.
+class HdPageIOEngine::NativeQueue
+{
+public:
+    ~NativeQueue()
+    {
+        if (mSqes)
+        {
+            ::munmap(mSqes, mSqesSize);
+        }
+        if (mCqRing && mCqRing != mSqRing)
+        {
+            ::munmap(mCqRing, mCqRingSize);
+        }
+        if (mSqRing)
+        {
+            ::munmap(mSqRing, mSqRingSize);
+        }
+        if (mRingFd >= 0)
+        {
+            ::close(mRingFd);
+        }
+    }
+
+    static std::unique_ptr<NativeQueue> Create(unsigned entries)
+    {
+        auto queue = std::make_unique<NativeQueue>();
+        return queue->Open(entries) ? std::move(queue) : nullptr;
+    }
+
+    unsigned Capacity() const { return mCapacity; }
+
+    // Prepares a vectored read or write; the vectors must stay valid until its completion.
+    void Push(bool write, int fileDescriptor, const iovec* vectors, unsigned count,
+        std::uint64_t offset, std::uint64_t userData)
+    {
+        const unsigned tail  = *mSqTail; // Only this thread moves the tail.
+        const unsigned index = tail & mSqMask;
+        io_uring_sqe& entry  = mSqes[index];
+        std::memset(&entry, 0, sizeof(entry));
+        entry.opcode    = write ? IORING_OP_WRITEV : IORING_OP_READV;
+        entry.fd        = fileDescriptor;
+        entry.addr      = reinterpret_cast<std::uint64_t>(vectors);
+        entry.len       = count;
+        entry.off       = offset;
+        entry.user_data = userData;
+        mSqArray[index] = index;
+        __atomic_store_n(mSqTail, tail + 1, __ATOMIC_RELEASE);
+        ++mUnsubmitted;
+    }
+
+    // Submits the prepared entries and waits for at least waitCount completions. Returns false
+    // on errors other than interruptions and a temporarily full completion ring.
+    bool Enter(unsigned waitCount)
+    {
+        const unsigned flags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+        const long submitted = ::syscall(
+            __NR_io_uring_enter, mRingFd, mUnsubmitted, waitCount, flags, nullptr, 0);
+        if (submitted < 0)
+        {
+            return errno == EINTR || errno == EAGAIN || errno == EBUSY;
+        }
+        mUnsubmitted -= static_cast<unsigned>(submitted);
+        return true;
+    }
+
+    // Calls onCompletion(userData, result) for each completed operation.
+    template <typename Callable>
+    void Reap(Callable&& onCompletion)
+    {
+        unsigned head       = *mCqHead;
+        const unsigned tail = __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe& completion = mCqes[head & mCqMask];
+            onCompletion(completion.user_data, completion.res);
+            ++head;
+        }
+        __atomic_store_n(mCqHead, head, __ATOMIC_RELEASE);
+    }
+
+private:
+    bool Open(unsigned entries)
+    {
+        io_uring_params params {};
+        mRingFd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (mRingFd < 0)
+        {
+            return false; // Not supported, or disabled (e.g. by a seccomp profile).
+        }
+
+        mSqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        mCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMapping)
+        {
+            mSqRingSize = mCqRingSize = std::max(mSqRingSize, mCqRingSize);
+        }
+
+        mSqRing   = Map(mSqRingSize, IORING_OFF_SQ_RING);
+        mCqRing   = singleMapping ? mSqRing : Map(mCqRingSize, IORING_OFF_CQ_RING);
+        mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        mSqes     = static_cast<io_uring_sqe*>(Map(mSqesSize, IORING_OFF_SQES));
+        if (!mSqRing || !mCqRing || !mSqes)
+        {
+            return false;
+        }
+
+        auto* sqRing = static_cast<char*>(mSqRing);
+        mSqTail      = reinterpret_cast<unsigned*>(sqRing + params.sq_off.tail);
+        mSqMask      = *reinterpret_cast<unsigned*>(sqRing + params.sq_off.ring_mask);
+        mSqArray     = reinterpret_cast<unsigned*>(sqRing + params.sq_off.array);
+        auto* cqRing = static_cast<char*>(mCqRing);
+        mCqHead      = reinterpret_cast<unsigned*>(cqRing + params.cq_off.head);
+        mCqTail      = reinterpret_cast<unsigned*>(cqRing + params.cq_off.tail);
+        mCqMask      = *reinterpret_cast<unsigned*>(cqRing + params.cq_off.ring_mask);
+        mCqes        = reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes);
+        mCapacity    = params.sq_entries;
+        return true;
+    }
+
+    void* Map(size_t size, std::uint64_t offset) const
+    {
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            mRingFd, static_cast<off_t>(offset));
+        return mapping == MAP_FAILED ? nullptr : mapping;
+    }
+
+    int mRingFd         = -1;
+    void* mSqRing       = nullptr;
+    void* mCqRing       = nullptr;
+    io_uring_sqe* mSqes = nullptr;
+    size_t mSqRingSize  = 0;
+    size_t mCqRingSize  = 0;
+    size_t mSqesSize    = 0;
+
+    // Ring fields shared with the kernel.
+    unsigned* mSqTail   = nullptr;
+    unsigned* mSqArray  = nullptr;
+    unsigned mSqMask    = 0;
+    unsigned* mCqHead   = nullptr;
+    unsigned* mCqTail   = nullptr;
+    unsigned mCqMask    = 0;
+    io_uring_cqe* mCqes = nullptr;
+
+    unsigned mCapacity    = 0;
+    unsigned mUnsubmitted = 0; ///< Prepared entries the kernel has not taken yet
+};
+
+#else
+
+class HdPageIOEngine::NativeQueue
+{
+};
+
+#endif
+
+HdPageIOEngine::HdPageIOEngine(const HdPageIOConfig& config) : mConfig(config)
+{
+    mConfig.queueDepth          = std::clamp<size_t>(mConfig.queueDepth, 1, 4096);
+    mConfig.submissionQueueSize = std::max<size_t>(mConfig.submissionQueueSize, 1);
+
+#if defined(HVT_PAGE_IO_URING)
+    if (mConfig.backend != HdPageIOBackend::ThreadPool)
+    {
+        mNativeQueue = NativeQueue::Create(static_cast<unsigned>(mConfig.queueDepth));
+        if (mNativeQueue)
+        {
+            // The kernel may round the ring size up, never more operations than requested.
+            mConfig.queueDepth = std::min<size_t>(mConfig.queueDepth, mNativeQueue->Capacity());
+            mBackend           = HdPageIOBackend::IOUring;
+            mThreads.emplace_back(&HdPageIOEngine::NativeLoop, this);
+            return;
+        }
+    }
+#endif
+
+    if (mConfig.backend == HdPageIOBackend::IOUring)
+    {
+        TF_WARN("HdPageIOEngine: io_uring is not available, falling back to the thread pool.\n");
+    }
+    mBackend = HdPageIOBackend::ThreadPool;
+
+    const size_t workerCount = std::min(mConfig.queueDepth, MAX_WORKER_THREADS);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        mThreads.emplace_back(&HdPageIOEngine::WorkerLoop, this);
+    }
+}
+
+HdPageIOEngine::~HdPageIOEngine()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mRequestAvailable.notify_all();
+    mSpaceAvailable.notify_all();
+
+    // The threads complete the queued requests before they exit.
+    for (auto& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+bool HdPageIOEngine::IsNativeBackendAvailable()
+{
+#if defined(HVT_PAGE_IO_URING)
+    return NativeQueue::Create(1) != nullptr;
+#else
+    return false;
+#endif
+}
+
+void HdPageIOEngine::Submit(HdPageIORequest request)
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (!mStopping && mQueue.size() >= mConfig.submissionQueueSize)
+        {
+            ++mStats.queueFullWaits;
+            mSpaceAvailable.wait(lock,
+                [this]() { return mStopping || mQueue.size() < mConfig.submissionQueueSize; });
+        }
+        if (!mStopping)
+        {
+            mQueue.push_back(std::move(request));
+            ++mPending;
+            ++mStats.submitted;
+            lock.unlock();
+            mRequestAvailable.notify_one();
+            return;
+        }
+    }
+
+    if (request.callback)
+    {
+        request.callback(false);
+    }
+}
+
+std::future<bool> HdPageIOEngine::Read(
+    HdPageFileEntry& file, std::ptrdiff_t offset, void* data, size_t size)
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future  = promise->get_future();
+
+    HdPageIORequest request;
+    request.op       = HdPageIORequest::Op::Read;
+    request.file     = &file;
+    request.offset   = offset;
+    request.data     = static_cast<std::byte*>(data);
+    request.size     = size;
+    request.callback = [promise](bool success) { promise->set_value(success); };
+    Submit(std::move(request));
+    return future;
+}
+
+std::future<bool> HdPageIOEngine::Write(
+    HdPageFileEntry& file, std::ptrdiff_t offset, const void* data, size_t size)
+{
+    auto promise = std::make_shared<std::promise<bool>>();
+    auto future  = promise->get_future();
+
+    HdPageIORequest request;
+    request.op       = HdPageIORequest::Op::Write;
+    request.file     = &file;
+    request.offset   = offset;
+    request.data     = static_cast<std::byte*>(const_cast<void*>(data));
+    request.size     = size;
+    request.callback = [promise](bool success) { promise->set_value(success); };
+    Submit(std::move(request));
+    return future;
+}
+
+void HdPageIOEngine::WaitForIdle()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mIdle.wait(lock, [this]() { return mPending == 0; });
+}
+
+size_t HdPageIOEngine::GetPendingRequests() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mPending;
+}
+
+HdPageIOStats HdPageIOEngine::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+void HdPageIOEngine::PopBatch(IOBatch& batch)
+{
+    batch.requests.clear();
+    batch.requests.push_back(std::move(mQueue.front()));
+    mQueue.pop_front();
+
+    const HdPageIORequest& first = batch.requests.front();
+    batch.op                     = first.op;
+    batch.file                   = first.file;
+    batch.offset                 = first.offset;
+    batch.size                   = first.size;
+
+    // Pull in the queued requests continuing the range at either end, until nothing adjacent
+    // is left. The queue is bounded, so the scans are short.
+    bool merged = true;
+    while (merged && batch.requests.size() < MAX_MERGED_REQUESTS)
+    {
+        merged = false;
+        for (auto it = mQueue.begin(); it != mQueue.end(); ++it)
+        {
+            if (it->op != batch.op || it->file != batch.file || it->size == 0 ||
+                batch.size + it->size > mConfig.maxMergeBytes)
+            {
+                continue;
+            }
+            const size_t size = it->size;
+            if (it->offset == batch.offset + static_cast<std::ptrdiff_t>(batch.size))
+            {
+                batch.requests.push_back(std::move(*it));
+            }
+            else if (it->offset + static_cast<std::ptrdiff_t>(size) == batch.offset)
+            {
+                batch.offset = it->offset;
+                batch.requests.insert(batch.requests.begin(), std::move(*it));
+            }
+            else
+            {
+                continue;
+            }
+            batch.size += size;
+            mQueue.erase(it);
+            ++mStats.merged;
+            merged = true;
+            break;
+        }
+    }
+
+    ++mInFlight;
+    ++mStats.operations;
+    mStats.maxInFlight = std::max(mStats.maxInFlight, mInFlight);
+}
+
+bool HdPageIOEngine::Execute(const IOBatch& batch)
+{
+    if (batch.op == HdPageIORequest::Op::Read)
+    {
+        std::vector<TfSpan<std::byte>> buffers;
+        buffers.reserve(batch.requests.size());
+        for (const auto& request : batch.requests)
+        {
+            buffers.emplace_back(request.data, request.size);
+        }
+        return batch.file->ReadDataScatter(batch.offset, buffers);
+    }
+
+    std::vector<TfSpan<const std::byte>> buffers;
+    buffers.reserve(batch.requests.size());
+    for (const auto& request : batch.requests)
+    {
+        buffers.emplace_back(request.data, request.size);
+    }
+    return batch.file->WriteDataGather(batch.offset, buffers);
+}
+
+void HdPageIOEngine::Complete(IOBatch& batch, bool success)
+{
+    for (auto& request : batch.requests)
+    {
+        if (request.callback)
+        {
+            request.callback(success);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPending -= batch.requests.size();
+        --mInFlight;
+        mStats.completed += batch.requests.size();
+        if (!success)
+        {
+            mStats.failed += batch.requests.size();
+        }
+    }
+    mIdle.notify_all();
+    batch.requests.clear();
+}
+
+void HdPageIOEngine::WorkerLoop()
+{
+    IOBatch batch;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mRequestAvailable.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+            if (mQueue.empty())
+            {
+                return; // Stopping, and everything is done.
+            }
+            PopBatch(batch);
+        }
+        mSpaceAvailable.notify_all();
+
+        const bool success = Execute(batch);
+        Complete(batch, success);
+    }
+}
+
+void HdPageIOEngine::FallBackToThreadPool()
+{
+    // The calling thread becomes one of the workers. None are added once the engine stops: the
+    // destructor joins the threads without the lock.
+    std::lock_guard<std::mutex> lock(mMutex);
+    mBackend = HdPageIOBackend::ThreadPool;
+    if (mStopping)
+    {
+        return;
+    }
+    const size_t workerCount = std::min(mConfig.queueDepth, MAX_WORKER_THREADS);
+    for (size_t i = 1; i < workerCount; ++i)
+    {
+        mThreads.emplace_back(&HdPageIOEngine::WorkerLoop, this);
+    }
+}
+
+void HdPageIOEngine::NativeLoop()
+{
+#if defined(HVT_PAGE_IO_URING)
+    // One slot per operation in flight; the slot index is the io_uring user data.
+    struct NativeSlot
+    {
+        IOBatch batch;
+        std::vector<iovec> vectors;
+    };
+    std::vector<NativeSlot> slots(mConfig.queueDepth);
+    std::vector<size_t> freeSlots(slots.size());
+    for (size_t i = 0; i < freeSlots.size(); ++i)
+    {
+        freeSlots[i] = slots.size() - 1 - i;
+    }
+
+    // Short transfers and transient errors are redone with positional I/O.
+    auto reap = [this, &slots, &freeSlots](std::uint64_t slotIndex, int result)
+    {
+        NativeSlot& slot    = slots[static_cast<size_t>(slotIndex)];
+        const bool complete = result >= 0 && static_cast<size_t>(result) == slot.batch.size;
+        const bool success  = complete || Execute(slot.batch);
+        Complete(slot.batch, success);
+        freeSlots.push_back(static_cast<size_t>(slotIndex));
+    };
+
+    std::vector<IOBatch> mappedBatches;
+    for (;;)
+    {
+        size_t pushed = 0;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            const bool idle = freeSlots.size() == slots.size();
+            if (idle)
+            {
+                mRequestAvailable.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+                if (mQueue.empty())
+                {
+                    return; // Stopping, and everything is done.
+                }
+            }
+
+            while (!mQueue.empty() && !freeSlots.empty())
+            {
+                IOBatch batch;
+                PopBatch(batch);
+                if (batch.file->IOMode() == HdPageFileIOMode::MemoryMapped)
+                {
+                    // Plain copies, run below on this thread.
+                    mappedBatches.push_back(std::move(batch));
+                    continue;
+                }
+
+                const size_t slotIndex = freeSlots.back();
+                freeSlots.pop_back();
+                NativeSlot& slot = slots[slotIndex];
+                slot.batch       = std::move(batch);
+                slot.vectors.clear();
+                for (const auto& request : slot.batch.requests)
+                {
+                    slot.vectors.push_back(iovec { request.data, request.size });
+                }
+                mNativeQueue->Push(slot.batch.op == HdPageIORequest::Op::Write,
+                    slot.batch.file->mFileDescriptor, slot.vectors.data(),
+                    static_cast<unsigned>(slot.vectors.size()),
+                    static_cast<std::uint64_t>(slot.batch.offset), slotIndex);
+                ++pushed;
+            }
+        }
+        mSpaceAvailable.notify_all();
+
+        for (auto& batch : mappedBatches)
+        {
+            const bool success = Execute(batch);
+            Complete(batch, success);
+        }
+        mappedBatches.clear();
+
+        // Only block for completions when nothing new was submitted.
+        const bool inFlight = freeSlots.size() < slots.size();
+        if (!inFlight)
+        {
+            continue;
+        }
+        if (mNativeQueue->Enter(pushed == 0 ? 1 : 0))
+        {
+            mNativeQueue->Reap(reap);
+            continue;
+        }
+
+        // The ring is unusable: the operations without a completion are redone with positional
+        // I/O, and the engine continues as a thread pool.
+        TF_WARN("HdPageIOEngine: io_uring_enter failed (%s), falling back to the thread pool.\n",
+            std::strerror(errno));
+        mNativeQueue->Reap(reap);
+        std::vector<bool> freeSlot(slots.size(), false);
+        for (size_t slotIndex : freeSlots)
+        {
+            freeSlot[slotIndex] = true;
+        }
+        for (size_t slotIndex = 0; slotIndex < slots.size(); ++slotIndex)
+        {
+            if (!freeSlot[slotIndex])
+            {
+                const bool success = Execute(slots[slotIndex].batch);
+                Complete(slots[slotIndex].batch, success);
+            }
+        }
+
+        FallBackToThreadPool();
+        WorkerLoop();
+        return;
+    }
+#endif
+}
+
+} // namespace HVT_NS
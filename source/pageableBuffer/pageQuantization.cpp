@@ -0,0 +1,249 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageQuantization.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace HVT_NS
+{
+
+namespace
+{
+
+constexpr float GRID_STEPS = 65535.0f;
+constexpr float SNORM_MAX  = 32767.0f;
+
+// Unaligned 16-bit accesses, which the compilers turn into plain (vector) loads and stores.
+uint16_t ReadU16(const uint8_t* p)
+{
+    uint16_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void WriteU16(uint8_t* p, uint16_t value)
+{
+    std::memcpy(p, &value, sizeof(value));
+}
+
+uint32_t FloatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float SignNotZero(float value)
+{
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+// Snorm in [-1, 1]; -32768 is clamped in the integers, float selects would not vectorize.
+float SnormToFloat(uint16_t bits)
+{
+    const int16_t value = std::max(static_cast<int16_t>(bits), static_cast<int16_t>(-32767));
+    return static_cast<float>(value) * (1.0f / SNORM_MAX);
+}
+
+// 1 / sqrt(value) to float precision, by Newton iterations: unlike std::sqrt, which may set
+// errno, it vectorizes without fast-math flags.
+float InverseSqrt(float value)
+{
+    float estimate = BitsFloat(0x5f3759dfu - (FloatBits(value) >> 1));
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        estimate *= 1.5f - 0.5f * value * estimate * estimate;
+    }
+    return estimate;
+}
+
+// Round to nearest even, for finite values within the half range.
+uint16_t FloatToHalf(float value)
+{
+    uint32_t bits       = FloatBits(value);
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    bits &= 0x7fffffffu;
+
+    // Below the smallest normal half: a multiple of 2^-24.
+    if (bits < 0x38800000u)
+    {
+        const float magnitude = BitsFloat(bits) * 16777216.0f;
+        return static_cast<uint16_t>(sign | static_cast<uint32_t>(std::nearbyint(magnitude)));
+    }
+
+    // Rebiases the exponent (127 to 15) and rounds the 13 dropped mantissa bits.
+    const uint32_t odd = (bits >> 13) & 1u;
+    bits += 0xc8000fffu + odd;
+    return static_cast<uint16_t>(sign | (bits >> 13));
+}
+
+} // anonymous namespace
+
+namespace HdPageQuantization
+{
+
+bool EncodePositions(
+    const float* xyz, size_t count, float origin[3], float step[3], uint8_t* out)
+{
+    float minimum[3] = { 0.0f, 0.0f, 0.0f };
+    float maximum[3] = { 0.0f, 0.0f, 0.0f };
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float value = xyz[i * 3 + axis];
+            if (!std::isfinite(value))
+            {
+                return false;
+            }
+            minimum[axis] = i == 0 ? value : std::min(minimum[axis], value);
+            maximum[axis] = i == 0 ? value : std::max(maximum[axis], value);
+        }
+    }
+
+    // The offsets are rounded in double, so that the decoding error is half a step.
+    double inverseStep[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        // An extent beyond FLT_MAX would decode as NaN.
+        const float extent = maximum[axis] - minimum[axis];
+        if (!std::isfinite(extent))
+        {
+            return false;
+        }
+        origin[axis]      = minimum[axis];
+        step[axis]        = extent / GRID_STEPS;
+        inverseStep[axis] = step[axis] > 0.0f ? 1.0 / static_cast<double>(step[axis]) : 0.0;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const double offset =
+                (static_cast<double>(xyz[i * 3 + axis]) - origin[axis]) * inverseStep[axis];
+            WriteU16(out + (i * 3 + axis) * sizeof(uint16_t),
+                static_cast<uint16_t>(std::min(std::lround(offset), 65535L)));
+        }
+    }
+    return true;
+}
+
+void DecodePositions(const uint8_t* in, size_t count, const float origin[3],
+    const float step[3], float* xyz)
+{
+    const float ox = origin[0], oy = origin[1], oz = origin[2];
+    const float sx = step[0], sy = step[1], sz = step[2];
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* q = in + i * 3 * sizeof(uint16_t);
+        xyz[i * 3 + 0]   = ox + static_cast<float>(ReadU16(q)) * sx;
+        xyz[i * 3 + 1]   = oy + static_cast<float>(ReadU16(q + 2)) * sy;
+        xyz[i * 3 + 2]   = oz + static_cast<float>(ReadU16(q + 4)) * sz;
+    }
+}
+
+bool EncodeOctahedral(const float* xyz, size_t count, uint8_t* out)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float x = xyz[i * 3 + 0];
+        const float y = xyz[i * 3 + 1];
+        const float z = xyz[i * 3 + 2];
+        if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z))
+        {
+            return false;
+        }
+
+        // Projects on the octahedron |x| + |y| + |z| = 1, the lower half folded over the upper.
+        const float norm = std::abs(x) + std::abs(y) + std::abs(z);
+        float u          = norm > 0.0f ? x / norm : 0.0f;
+        float v          = norm > 0.0f ? y / norm : 0.0f;
+        if (z < 0.0f)
+        {
+            const float foldedU = (1.0f - std::abs(v)) * SignNotZero(u);
+            const float foldedV = (1.0f - std::abs(u)) * SignNotZero(v);
+            u                   = foldedU;
+            v                   = foldedV;
+        }
+
+        uint8_t* q = out + i * 2 * sizeof(uint16_t);
+        WriteU16(q, static_cast<uint16_t>(static_cast<int16_t>(
+                        std::lround(std::clamp(u, -1.0f, 1.0f) * SNORM_MAX))));
+        WriteU16(q + 2, static_cast<uint16_t>(static_cast<int16_t>(
+                            std::lround(std::clamp(v, -1.0f, 1.0f) * SNORM_MAX))));
+    }
+    return true;
+}
+
+void DecodeOctahedral(const uint8_t* in, size_t count, float* xyz)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* q = in + i * 2 * sizeof(uint16_t);
+        float x          = SnormToFloat(ReadU16(q));
+        float y          = SnormToFloat(ReadU16(q + 2));
+
+        // Unfolds the lower half without branches: fold is max(-z, 0).
+        const float z    = 1.0f - std::abs(x) - std::abs(y);
+        const float fold = (std::abs(z) - z) * 0.5f;
+        x -= std::copysign(fold, x);
+        y -= std::copysign(fold, y);
+
+        const float inverseLength = InverseSqrt(x * x + y * y + z * z);
+        xyz[i * 3 + 0]            = x * inverseLength;
+        xyz[i * 3 + 1]            = y * inverseLength;
+        xyz[i * 3 + 2]            = z * inverseLength;
+    }
+}
+
+bool EncodeHalfs(const float* values, size_t count, uint8_t* out)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Also rejects NaN.
+        if (!(std::abs(values[i]) <= HALF_MAX))
+        {
+            return false;
+        }
+        WriteU16(out + i * sizeof(uint16_t), FloatToHalf(values[i]));
+    }
+    return true;
+}
+
+void DecodeHalfs(const uint8_t* in, size_t count, float* values)
+{
+    // The exponent and mantissa bits land in a float scaled by 2^-112, which the multiplication
+    // rebiases; it also normalizes the subnormal halves.
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t half   = ReadU16(in + i * sizeof(uint16_t));
+        const uint32_t sign   = (half & 0x8000u) << 16;
+        const float magnitude = BitsFloat((half & 0x7fffu) << 13) * 0x1p112f;
+        values[i]             = BitsFloat(FloatBits(magnitude) | sign);
+    }
+}
+
+} // namespace HdPageQuantization
+
+} // namespace HVT_NS
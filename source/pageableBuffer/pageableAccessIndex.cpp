@@ -0,0 +1,177 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableAccessIndex.h>
+
+#include <hvt/pageableBuffer/pageableBuffer.h>
+
+namespace HVT_NS
+{
+
+HdBufferAccessIndex::~HdBufferAccessIndex()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto& [frame, generation] : mGenerations)
+    {
+        for (HdPageableBufferCore* buffer = generation.head; buffer;)
+        {
+            HdPageableBufferCore* next = buffer->mAccessNext;
+            buffer->mAccessPrev        = nullptr;
+            buffer->mAccessNext        = nullptr;
+            buffer->mAccessIndex.store(nullptr);
+            buffer = next;
+        }
+    }
+}
+
+void HdBufferAccessIndex::Insert(const std::shared_ptr<HdPageableBufferCore>& buffer)
+{
+    if (!buffer)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    HdBufferAccessIndex* expected = nullptr;
+    if (!buffer->mAccessIndex.compare_exchange_strong(expected, this))
+    {
+        return;
+    }
+    buffer->mAccessHandle = buffer;
+    Link(*buffer);
+}
+
+void HdBufferAccessIndex::Remove(HdPageableBufferCore& buffer) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (buffer.mAccessIndex.load() != this)
+    {
+        return;
+    }
+    Unlink(buffer);
+    buffer.mAccessIndex.store(nullptr);
+}
+
+void HdBufferAccessIndex::Touch(HdPageableBufferCore& buffer, unsigned int frame) noexcept
+{
+    // Repeat accesses within a frame are the common case: they keep the buffer in place
+    // without taking the lock.
+    if (buffer.mFrameStamp.load(std::memory_order_relaxed) == frame)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (buffer.mAccessIndex.load() != this)
+    {
+        buffer.mFrameStamp.store(frame, std::memory_order_relaxed);
+        return;
+    }
+    if (buffer.mFrameStamp.load(std::memory_order_relaxed) == frame)
+    {
+        return; // Moved by a concurrent touch
+    }
+    Unlink(buffer);
+    buffer.mFrameStamp.store(frame, std::memory_order_relaxed);
+    Link(buffer);
+}
+
+std::vector<std::shared_ptr<HdPageableBufferCore>> HdBufferAccessIndex::SelectOldest(
+    size_t count) const
+{
+    std::vector<std::shared_ptr<HdPageableBufferCore>> selected;
+    selected.reserve(count);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto it = mGenerations.begin(); it != mGenerations.end() && selected.size() < count;
+         ++it)
+    {
+        for (HdPageableBufferCore* buffer = it->second.head; buffer && selected.size() < count;
+             buffer = buffer->mAccessNext)
+        {
+            // A buffer whose last reference is gone waits for the lock in its destructor.
+            if (auto locked = buffer->mAccessHandle.lock())
+            {
+                selected.push_back(std::move(locked));
+            }
+        }
+    }
+
+    return selected;
+}
+
+size_t HdBufferAccessIndex::Size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mSize;
+}
+
+size_t HdBufferAccessIndex::GetGenerationCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mGenerations.size();
+}
+
+void HdBufferAccessIndex::Link(HdPageableBufferCore& buffer)
+{
+    Generation& generation = mGenerations[buffer.mFrameStamp.load(std::memory_order_relaxed)];
+    buffer.mAccessPrev     = generation.tail;
+    buffer.mAccessNext     = nullptr;
+    if (generation.tail)
+    {
+        generation.tail->mAccessNext = &buffer;
+    }
+    else
+    {
+        generation.head = &buffer;
+    }
+    generation.tail = &buffer;
+    ++mSize;
+}
+
+void HdBufferAccessIndex::Unlink(HdPageableBufferCore& buffer) noexcept
+{
+    const auto it = mGenerations.find(buffer.mFrameStamp.load(std::memory_order_relaxed));
+    if (it == mGenerations.end())
+    {
+        return;
+    }
+
+    Generation& generation = it->second;
+    if (buffer.mAccessPrev)
+    {
+        buffer.mAccessPrev->mAccessNext = buffer.mAccessNext;
+    }
+    else
+    {
+        generation.head = buffer.mAccessNext;
+    }
+    if (buffer.mAccessNext)
+    {
+        buffer.mAccessNext->mAccessPrev = buffer.mAccessPrev;
+    }
+    else
+    {
+        generation.tail = buffer.mAccessPrev;
+    }
+    buffer.mAccessPrev = nullptr;
+    buffer.mAccessNext = nullptr;
+    --mSize;
+
+    if (!generation.head)
+    {
+        mGenerations.erase(it);
+    }
+}
+
+} // namespace HVT_NS
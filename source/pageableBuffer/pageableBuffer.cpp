@@ -14,8 +14,10 @@
 #include <hvt/pageableBuffer/pageableBuffer.h>
 
 #include <hvt/pageableBuffer/pageFileManager.h>
+#include <hvt/pageableBuffer/pageableAccessIndex.h>
 #include <hvt/pageableBuffer/pageableBufferManager.h>
 #include <hvt/pageableBuffer/pageableMemoryMonitor.h>
+#include <hvt/pageableBuffer/pageableTrace.h>
 
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/stringUtils.h>
@@ -44,6 +46,19 @@ HdPageableBufferCore::~HdPageableBufferCore()
     ReleaseSceneBuffer();
     ReleaseRendererBuffer();
 
+    if (HdBufferAccessIndex* accessIndex = mAccessIndex.load())
+    {
+        accessIndex->Remove(*this);
+    }
+    if (HdPagingTraceRecorder* traceRecorder = mTraceRecorder.load())
+    {
+        traceRecorder->RecordRemove(*this);
+    }
+    if (HdMemoryPool* pool = mMemoryPool.load())
+    {
+        pool->RemoveBuffer();
+    }
+
     // Notify HdPageableBufferManager of removing from the list.
     if (mDestructionCallback)
     {
@@ -51,6 +66,24 @@ HdPageableBufferCore::~HdPageableBufferCore()
     }
 }
 
+void HdPageableBufferCore::UpdateFrameStamp(unsigned int frame) noexcept
+{
+    mAccessCount.fetch_add(1, std::memory_order_relaxed);
+    if (HdBufferAccessIndex* accessIndex = mAccessIndex.load())
+    {
+        accessIndex->Touch(*this, frame);
+    }
+    else
+    {
+        mFrameStamp.store(frame, std::memory_order_relaxed);
+    }
+
+    if (HdPagingTraceRecorder* traceRecorder = mTraceRecorder.load())
+    {
+        traceRecorder->RecordAccess(*this);
+    }
+}
+
 // std::span-based memory access methods
 TfSpan<const std::byte> HdPageableBufferCore::GetSceneMemorySpan() const noexcept
 {
@@ -224,6 +257,90 @@ bool HdPageableBufferCore::SwapRendererToDisk(bool force, HdBufferState releaseB
     return true;
 }
 
+TfSpan<const std::byte> HdPageableBufferCore::PreparePageOut(HdBufferState source)
+{
+    if (!(static_cast<int>(mBufferState) & static_cast<int>(source)) || HasValidDiskBuffer())
+    {
+        return {}; // Nothing to swap, or the existing page must be updated in place.
+    }
+
+    // Same source preference as PageToDisk.
+    if (HasRendererBuffer())
+    {
+        return TfSpan<const std::byte>(GetRendererMemorySpan().data(), mSize);
+    }
+    return TfSpan<const std::byte>(GetSceneMemorySpan().data(), mSize);
+}
+
+bool HdPageableBufferCore::CompletePageOut(
+    std::unique_ptr<HdBufferPageEntry> pageEntry, HdBufferState releaseBuffer)
+{
+    if (!pageEntry)
+    {
+        return false;
+    }
+
+    if (HasValidDiskBuffer())
+    {
+        // Paged out by someone else in the meantime, keep the existing page.
+        mPageFileManager->ReleasePage(*pageEntry);
+    }
+    else
+    {
+        mPageEntry   = std::move(pageEntry);
+        mBufferState = static_cast<HdBufferState>(
+            static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::DiskBuffer));
+    }
+
+    // Remove other buffers.
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::RendererBuffer))
+    {
+        ReleaseRendererBuffer();
+    }
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::SceneBuffer))
+    {
+        ReleaseSceneBuffer();
+    }
+
+    return true;
+}
+
+const HdBufferPageEntry* HdPageableBufferCore::PreparePageIn()
+{
+    if (HasSceneBuffer() || !HasValidDiskBuffer())
+    {
+        return nullptr; // Already in scene memory, or nothing to read.
+    }
+    return mPageEntry.get();
+}
+
+bool HdPageableBufferCore::CompletePageIn(TfSpan<const std::byte> page, HdBufferState releaseBuffer)
+{
+    if (!HasSceneBuffer())
+    {
+        CreateSceneBuffer();
+
+        auto dstSpan = GetSceneMemorySpan();
+        if (dstSpan.size() < page.size())
+        {
+            ReleaseSceneBuffer();
+            return false;
+        }
+        std::copy(page.begin(), page.end(), dstSpan.begin());
+    }
+
+    // Remove other buffers.
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::RendererBuffer))
+    {
+        ReleaseRendererBuffer();
+    }
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::DiskBuffer))
+    {
+        ReleaseDiskPage();
+    }
+    return true;
+}
+
 bool HdPageableBufferCore::SwapToSceneMemory(bool force, HdBufferState releaseBuffer)
 {
     if (!PageToSceneMemory(force))
@@ -268,7 +385,16 @@ void HdPageableBufferCore::CreateSceneBuffer()
     if (HasSceneBuffer())
         return;
 
+    // Filled from the disk page unless the renderer memory holds the data.
+    if (HasDiskBuffer() && !HasRendererBuffer())
+    {
+        TracePaging(HdPagingTraceEvent::PageIn);
+    }
     mMemoryMonitor->AddSceneMemory(mSize);
+    if (HdMemoryPool* pool = mMemoryPool.load())
+    {
+        pool->AddSceneMemory(mSize);
+    }
     mBufferState = static_cast<HdBufferState>(
         static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::SceneBuffer));
 }
@@ -278,7 +404,15 @@ void HdPageableBufferCore::CreateRendererBuffer()
     if (HasRendererBuffer())
         return;
 
+    if (HasDiskBuffer() && !HasSceneBuffer())
+    {
+        TracePaging(HdPagingTraceEvent::PageIn);
+    }
     mMemoryMonitor->AddRendererMemory(mSize);
+    if (HdMemoryPool* pool = mMemoryPool.load())
+    {
+        pool->AddRendererMemory(mSize);
+    }
     mBufferState = static_cast<HdBufferState>(
         static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::RendererBuffer));
 }
@@ -287,7 +421,16 @@ void HdPageableBufferCore::ReleaseSceneBuffer() noexcept
 {
     if (HasSceneBuffer())
     {
+        // The data only remains on disk.
+        if (HasDiskBuffer() && !HasRendererBuffer())
+        {
+            TracePaging(HdPagingTraceEvent::PageOut);
+        }
         mMemoryMonitor->ReduceSceneMemory(mSize);
+        if (HdMemoryPool* pool = mMemoryPool.load())
+        {
+            pool->ReduceSceneMemory(mSize);
+        }
         mBufferState = static_cast<HdBufferState>(
             static_cast<int>(mBufferState) & ~static_cast<int>(HdBufferState::SceneBuffer));
     }
@@ -297,12 +440,51 @@ void HdPageableBufferCore::ReleaseRendererBuffer() noexcept
 {
     if (HasRendererBuffer())
     {
+        if (HasDiskBuffer() && !HasSceneBuffer())
+        {
+            TracePaging(HdPagingTraceEvent::PageOut);
+        }
         mMemoryMonitor->ReduceRendererMemory(mSize);
+        if (HdMemoryPool* pool = mMemoryPool.load())
+        {
+            pool->ReduceRendererMemory(mSize);
+        }
         mBufferState = static_cast<HdBufferState>(
             static_cast<int>(mBufferState) & ~static_cast<int>(HdBufferState::RendererBuffer));
     }
 }
 
+void HdPageableBufferCore::SetMemoryPool(HdMemoryPool* pool) noexcept
+{
+    HdMemoryPool* previous = mMemoryPool.exchange(pool);
+    if (previous == pool)
+    {
+        return;
+    }
+    const size_t sceneMemory    = HasSceneBuffer() ? mSize : 0;
+    const size_t rendererMemory = HasRendererBuffer() ? mSize : 0;
+    if (previous)
+    {
+        previous->ReduceSceneMemory(sceneMemory);
+        previous->ReduceRendererMemory(rendererMemory);
+        previous->RemoveBuffer();
+    }
+    if (pool)
+    {
+        pool->AddSceneMemory(sceneMemory);
+        pool->AddRendererMemory(rendererMemory);
+        pool->AddBuffer();
+    }
+}
+
+void HdPageableBufferCore::TracePaging(HdPagingTraceEvent event) const noexcept
+{
+    if (HdPagingTraceRecorder* traceRecorder = mTraceRecorder.load())
+    {
+        traceRecorder->RecordPaging(event, *this, mSize);
+    }
+}
+
 void HdPageableBufferCore::ReleaseDiskPage() noexcept
 {
     if (mPageEntry)
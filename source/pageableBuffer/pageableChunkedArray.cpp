@@ -0,0 +1,302 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableChunkedArray.h>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/stringUtils.h>
+#include <pxr/imaging/hd/retainedDataSource.h>
+
+#include <algorithm>
+#include <cstring>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+
+// HdPageableChunkedArrayDataSource Implementation ////////////////////////////
+//
+// Each chunk is an HdPageableValue holding a VtArray of the elements of the chunk, with its own
+// disk page: the chunks page in and out independently, with the streamed page-outs and the
+// in-place page-ins of the POD arrays. As the payload of a chunkable array is its storage, the
+// chunks are cut from the payload stream of the array and ranges are cut from the payloads of
+// the chunks, whatever the type of the elements.
+
+HdPageableChunkedArrayDataSource::Handle HdPageableChunkedArrayDataSource::New(
+    const VtValue& array, const SdfPath& primPath, const TfToken& attributeName,
+    const std::unique_ptr<HdPageFileManager>& pageFileManager,
+    const std::unique_ptr<HdMemoryMonitor>& memoryMonitor, DestructionCallback destructionCallback,
+    HdBufferUsage usage, size_t chunkSize, bool enableImplicitPaging)
+{
+    if (!CanChunk(array))
+    {
+        TF_WARN("HdPageableChunkedArrayDataSource: Unsupported type for chunking: %s",
+            array.GetTypeName().c_str());
+        return nullptr;
+    }
+
+    const HdValueType& type = *HdValueTypeRegistry::GetInstance().Find(array.GetTypeid());
+    return Handle(new HdPageableChunkedArrayDataSource(array, type, primPath, attributeName,
+        pageFileManager, memoryMonitor, destructionCallback, usage, chunkSize,
+        enableImplicitPaging));
+}
+
+bool HdPageableChunkedArrayDataSource::CanChunk(const VtValue& value)
+{
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().Find(value.GetTypeid());
+    return type && type->elementSize > 0;
+}
+
+HdPageableChunkedArrayDataSource::HdPageableChunkedArrayDataSource(const VtValue& array,
+    const HdValueType& type, const SdfPath& primPath, const TfToken& attributeName,
+    const std::unique_ptr<HdPageFileManager>& pageFileManager,
+    const std::unique_ptr<HdMemoryMonitor>& memoryMonitor, DestructionCallback destructionCallback,
+    HdBufferUsage usage, size_t chunkSize, bool enableImplicitPaging) :
+    HdPageableBufferBase<>(primPath, HdPageableValue::EstimateMemoryUsage(array), usage,
+        pageFileManager, memoryMonitor, destructionCallback),
+    mType(type),
+    mPrimPath(primPath),
+    mAttributeName(attributeName),
+    mEnableImplicitPaging(enableImplicitPaging)
+{
+    const size_t payloadSize = mType.payloadSize(array);
+    mElementCount            = payloadSize / mType.elementSize;
+    mElementsPerChunk        = std::max<size_t>(1, chunkSize / mType.elementSize);
+    const size_t chunkBytes  = mElementsPerChunk * mType.elementSize;
+    mChunks.reserve((mElementCount + mElementsPerChunk - 1) / mElementsPerChunk);
+
+    auto addChunk = [&](const uint8_t* payload, size_t size)
+    {
+        const VtValue value = mType.read(payload, size);
+        mChunks.push_back(std::make_shared<HdPageableValue>(SdfPath(GetChunkKey(mChunks.size())),
+            HdPageableValue::EstimateMemoryUsage(value), usage, pageFileManager, memoryMonitor,
+            HdPageableDataSourceUtils::kNoOpDestructionCallback, value, attributeName,
+            mEnableImplicitPaging));
+    };
+
+    // Whole chunks are read straight from the payload, the others are staged.
+    std::vector<uint8_t> staged;
+    mType.write(array,
+        [&](TfSpan<const std::byte> bytes)
+        {
+            const auto* data = reinterpret_cast<const uint8_t*>(bytes.data());
+            size_t remaining = bytes.size();
+            while (remaining > 0)
+            {
+                if (staged.empty() && remaining >= chunkBytes)
+                {
+                    addChunk(data, chunkBytes);
+                    data += chunkBytes;
+                    remaining -= chunkBytes;
+                    continue;
+                }
+                const size_t size = std::min(remaining, chunkBytes - staged.size());
+                staged.insert(staged.end(), data, data + size);
+                data += size;
+                remaining -= size;
+                if (staged.size() == chunkBytes)
+                {
+                    addChunk(staged.data(), staged.size());
+                    staged.clear();
+                }
+            }
+            return true;
+        });
+    if (!staged.empty())
+    {
+        addChunk(staged.data(), staged.size());
+    }
+}
+
+VtValue HdPageableChunkedArrayDataSource::GetValue(Time /*shutterOffset*/)
+{
+    return GetRange(0, mElementCount);
+}
+
+bool HdPageableChunkedArrayDataSource::GetContributingSampleTimesForInterval(
+    Time /*startTime*/, Time /*endTime*/, std::vector<Time>* /*outSampleTimes*/)
+{
+    return false;
+}
+
+VtValue HdPageableChunkedArrayDataSource::GetRange(size_t first, size_t count)
+{
+    first = std::min(first, mElementCount);
+    count = std::min(count, mElementCount - first);
+
+    const size_t begin = first * mType.elementSize;
+    const size_t end   = (first + count) * mType.elementSize;
+    std::vector<uint8_t> payload(end - begin);
+    const bool visited = ForEachChunk(first, count,
+        [&](const VtValue& chunk, size_t firstElement)
+        {
+            // Copies the bytes of the chunk within [begin, end) of the array payload.
+            size_t offset = firstElement * mType.elementSize;
+            return mType.write(chunk,
+                [&](TfSpan<const std::byte> bytes)
+                {
+                    const size_t from = std::max(begin, offset);
+                    const size_t to   = std::min(end, offset + bytes.size());
+                    if (from < to)
+                    {
+                        std::memcpy(payload.data() + (from - begin),
+                            bytes.data() + (from - offset), to - from);
+                    }
+                    offset += bytes.size();
+                    return true;
+                });
+        });
+    return visited ? mType.read(payload.data(), payload.size()) : VtValue();
+}
+
+bool HdPageableChunkedArrayDataSource::ForEachChunk(
+    size_t first, size_t count, const ChunkVisitor& visitor)
+{
+    ++mAccessCount;
+    if (first >= mElementCount || count == 0)
+    {
+        return true;
+    }
+
+    const size_t last = first + std::min(count, mElementCount - first) - 1;
+    for (size_t index = GetChunkIndex(first); index <= GetChunkIndex(last); ++index)
+    {
+        // The chunk is held by the value, even if its buffer pages out meanwhile.
+        const VtValue chunk = GetChunkValue(index);
+        if (chunk.IsEmpty() || !visitor(chunk, index * mElementsPerChunk))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+VtValue HdPageableChunkedArrayDataSource::GetChunk(size_t index)
+{
+    ++mAccessCount;
+    return index < mChunks.size() ? GetChunkValue(index) : VtValue();
+}
+
+VtValue HdPageableChunkedArrayDataSource::GetChunkIfResident(size_t index) const
+{
+    return index < mChunks.size() ? mChunks[index]->GetValueIfResident() : VtValue();
+}
+
+bool HdPageableChunkedArrayDataSource::IsChunkResident(size_t index) const
+{
+    return index < mChunks.size() && mChunks[index]->IsDataResident();
+}
+
+size_t HdPageableChunkedArrayDataSource::GetResidentChunkCount() const
+{
+    return static_cast<size_t>(std::count_if(mChunks.begin(), mChunks.end(),
+        [](const std::shared_ptr<HdPageableValue>& chunk) { return chunk->IsDataResident(); }));
+}
+
+std::vector<std::shared_ptr<HdPageableValue>> HdPageableChunkedArrayDataSource::GetChunkBuffers(
+    size_t first, size_t count) const
+{
+    std::vector<std::shared_ptr<HdPageableValue>> buffers;
+    if (first >= mElementCount || count == 0)
+    {
+        return buffers;
+    }
+
+    const size_t last = first + std::min(count, mElementCount - first) - 1;
+    buffers.assign(mChunks.begin() + static_cast<std::ptrdiff_t>(GetChunkIndex(first)),
+        mChunks.begin() + static_cast<std::ptrdiff_t>(GetChunkIndex(last) + 1));
+    return buffers;
+}
+
+bool HdPageableChunkedArrayDataSource::SwapSceneToDisk(bool force, HdBufferState releaseBuffer)
+{
+    bool swapped = true;
+    for (const auto& chunk : mChunks)
+    {
+        if (!chunk->IsDataResident())
+        {
+            continue;
+        }
+        if (chunk->SwapSceneToDisk(force, releaseBuffer))
+        {
+            ++mPageOutCount;
+        }
+        else
+        {
+            swapped = false;
+        }
+    }
+    return swapped;
+}
+
+bool HdPageableChunkedArrayDataSource::SwapToSceneMemory(bool force, HdBufferState releaseBuffer)
+{
+    bool swapped = true;
+    for (const auto& chunk : mChunks)
+    {
+        if (chunk->IsDataResident())
+        {
+            continue;
+        }
+        if (chunk->SwapToSceneMemory(force, releaseBuffer))
+        {
+            ++mPageInCount;
+        }
+        else
+        {
+            swapped = false;
+        }
+    }
+    return swapped;
+}
+
+std::string HdPageableChunkedArrayDataSource::GetChunkKey(size_t index) const
+{
+    return TfStringPrintf(
+        "%s_%s_chunk%zu", mPrimPath.GetText(), mAttributeName.GetText(), index);
+}
+
+VtValue HdPageableChunkedArrayDataSource::GetChunkValue(size_t index) const
+{
+    bool pagedIn        = false;
+    const VtValue value = mChunks[index]->GetValue(&pagedIn);
+    if (pagedIn)
+    {
+        ++mPageInCount;
+    }
+    return value;
+}
+
+// Misc Utility Functions /////////////////////////////////////////////////////
+
+namespace HdPageableDataSourceUtils
+{
+
+HdDataSourceBaseHandle CreateChunkedArray(const VtValue& value, const SdfPath& primPath,
+    const TfToken& name, const std::shared_ptr<HdPageableDataSourceManager>& memoryManager,
+    size_t chunkSize)
+{
+    if (!memoryManager || !HdPageableChunkedArrayDataSource::CanChunk(value))
+    {
+        return CreateFromValue(value, primPath, name, memoryManager);
+    }
+
+    return HdPageableChunkedArrayDataSource::New(value, primPath, name,
+        memoryManager->GetPageFileManager(), memoryManager->GetMemoryMonitor(),
+        HdPageableDataSourceUtils::kNoOpDestructionCallback, HdBufferUsage::Static, chunkSize);
+}
+
+} // namespace HdPageableDataSourceUtils
+
+} // namespace HVT_NS
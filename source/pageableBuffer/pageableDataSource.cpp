@@ -12,28 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <hvt/pageableBuffer/pageableDataSource.h>
+#include <hvt/pageableBuffer/pageableValueTypes.h>
 
-#include <pxr/base/gf/matrix4d.h>
-#include <pxr/base/gf/matrix4f.h>
-#include <pxr/base/gf/quatd.h>
-#include <pxr/base/gf/quatf.h>
-#include <pxr/base/gf/vec2d.h>
-#include <pxr/base/gf/vec2f.h>
-#include <pxr/base/gf/vec2i.h>
-#include <pxr/base/gf/vec3d.h>
-#include <pxr/base/gf/vec3f.h>
-#include <pxr/base/gf/vec3i.h>
-#include <pxr/base/gf/vec4d.h>
-#include <pxr/base/gf/vec4f.h>
-#include <pxr/base/gf/vec4i.h>
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/imaging/hd/retainedDataSource.h>
 #include <pxr/imaging/hd/tokens.h>
 
 #include <algorithm>
 #include <cstring>
-#include <set>
+#include <typeinfo>
+#include <unordered_set>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -43,9 +34,12 @@ namespace HVT_NS
 // Packed binary format helpers
 //
 // Individual VtValue serialization format (HdDefaultValueSerializer):
-//   [uint8 VtTypeTag] [raw POD payload bytes]
-//   POD types are memcpy'd directly; string/token arrays use a
+//   [uint8 tag] [payload], the payload of each type described in pageableValueTypes.cpp.
+//   POD types are memcpy'd directly; string/token/path arrays use a
 //   [size_t count] [size_t len, chars...]... variable-length encoding.
+//   HdCompressedValueSerializer prefixes it with a page codec header (see pageCodec.h).
+//   HdQuantizedValueSerializer prefixes it with an HdQuantizedRole, or stores the points,
+//   normals and UVs in a lossy format of their own.
 //
 // Container packed buffer layout (one disk page per container):
 //   [uint32 numElements]
@@ -65,125 +59,12 @@ namespace HVT_NS
 namespace
 {
 
-// Compact type tag
-// Wire format: [uint8 VtTypeTag] [payload]
-// - POD arrays: payload = raw memcpy of element data (zero padding, no alignment)
-// - String/Token arrays: payload = [size_t count] ([size_t len] [chars])...
-enum class VtTypeTag : uint8_t
-{
-    Unknown = 0,
-    FloatArray,
-    DoubleArray,
-    HalfArray,
-    IntArray,
-    UIntArray,
-    Int64Array,
-    UInt64Array,
-    Vec2fArray,
-    Vec2dArray,
-    Vec2iArray,
-    Vec3fArray,
-    Vec3dArray,
-    Vec3iArray,
-    Vec4fArray,
-    Vec4dArray,
-    Vec4iArray,
-    Matrix4fArray,
-    Matrix4dArray,
-    QuatfArray,
-    QuatdArray,
-    StringArray,
-    TokenArray,
-};
-
-constexpr size_t kTypeTagSize = sizeof(VtTypeTag);
-static_assert(kTypeTagSize == 1, "VtTypeTag must be exactly 1 byte to match the header layout");
-
-// Deserialize POD array directly from raw pointer (zero-copy from caller's buffer)
-template <typename T>
-VtArray<T> DeserializePodDirect(const uint8_t* data, size_t byteSize)
-{
-    const size_t count = byteSize / sizeof(T);
-    VtArray<T> array(count);
-    if (count > 0)
-    {
-        std::memcpy(array.data(), data, count * sizeof(T));
-    }
-    return array;
-}
-
-// Serialize POD array with 1-byte type tag header into a single allocation
-template <typename T>
-std::vector<uint8_t> SerializePodTagged(VtTypeTag tag, const VtArray<T>& array)
-{
-    const size_t byteSize = array.size() * sizeof(T);
-    std::vector<uint8_t> result(kTypeTagSize + byteSize);
-    result[0] = static_cast<uint8_t>(tag);
-    if (!array.empty())
-    {
-        std::memcpy(result.data() + kTypeTagSize, array.cdata(), byteSize);
-    }
-    return result;
-}
-
-// Deserialize a variable-length string-like array from raw payload.
-template <typename ArrayT, typename FromStringFn>
-VtValue DeserializeStringArrayDirect(
-    const uint8_t* payload, size_t payloadSize, FromStringFn&& fromString)
-{
-    if (payloadSize < sizeof(size_t))
-        return VtValue(ArrayT());
-
-    // Get the count of elements
-    size_t count = 0;
-    std::memcpy(&count, payload, sizeof(size_t));
+// Wire format: [uint8 tag] [payload], see HdValueTypeRegistry for the types and their payloads.
+constexpr size_t kTypeTagSize = sizeof(uint8_t);
 
-    // Get the elements of various lengths
-    ArrayT array(count);
-    size_t offset = sizeof(size_t);
-    for (size_t i = 0; i < count && offset + sizeof(size_t) <= payloadSize; ++i)
-    {
-        size_t len = 0;
-        std::memcpy(&len, payload + offset, sizeof(size_t));
-        offset += sizeof(size_t);
-        if (offset + len <= payloadSize)
-        {
-            array[i] =
-                fromString(std::string(reinterpret_cast<const char*>(payload + offset), len));
-            offset += len;
-        }
-    }
-    return VtValue(array);
-}
-
-// Serialize a variable-length string-like array with type tag header.
-template <typename ArrayT, typename ToStringFn>
-std::vector<uint8_t> SerializeStringArrayTagged(
-    VtTypeTag tag, const ArrayT& array, ToStringFn&& toString)
+TfSpan<const std::byte> AsBytes(const void* data, size_t size)
 {
-    size_t totalSize = kTypeTagSize + sizeof(size_t);
-    for (const auto& elem : array)
-        totalSize += sizeof(size_t) + toString(elem).size();
-
-    // Set the type tag and the count of elements
-    std::vector<uint8_t> result(totalSize);
-    result[0]    = static_cast<uint8_t>(tag);
-    size_t pos   = kTypeTagSize;
-    size_t count = array.size();
-    std::memcpy(result.data() + pos, &count, sizeof(size_t));
-    pos += sizeof(size_t);
-
-    // Set the elements of various lengths
-    for (const auto& elem : array)
-    {
-        const std::string& s = toString(elem);
-        size_t len           = s.size();
-        std::memcpy(result.data() + pos, &len, sizeof(size_t));
-        pos += sizeof(size_t);
-        std::memcpy(result.data() + pos, s.data(), len);
-        pos += len;
-    }
-    return result;
+    return TfSpan<const std::byte>(static_cast<const std::byte*>(data), size);
 }
 
 const HdDefaultValueSerializer& GetDefaultSerializer()
@@ -192,6 +73,13 @@ const HdDefaultValueSerializer& GetDefaultSerializer()
     return sDefault;
 }
 
+// True for the default serializer itself. Its subclasses may override Serialize and
+// Deserialize, so they do not take the paths bypassing them.
+bool IsDefaultSerializer(const IHdValueSerializer& serializer)
+{
+    return typeid(serializer) == typeid(HdDefaultValueSerializer);
+}
+
 /// Sequential binary writer for packed serialization buffers.
 class PackedBufferWriter
 {
@@ -259,12 +147,157 @@ private:
     size_t mPos          = 0;
 };
 
+// Size of the scalars of a serialized value: the byte shuffle stride of the page codec. Unknown
+// types are not shuffled.
+size_t GetScalarSize(const VtValue& value)
+{
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().Find(value.GetTypeid());
+    return type ? type->scalarSize : 1;
+}
+
+// Quantized page header: [uint8 HdQuantizedRole] [uint64 count]. The positions follow it with
+// their grid: [float origin[3]] [float step[3]].
+constexpr size_t kQuantizedHeaderSize = sizeof(uint8_t) + sizeof(uint64_t);
+constexpr size_t kPositionGridSize    = 6 * sizeof(float);
+
+static_assert(sizeof(GfVec3f) == 3 * sizeof(float) && sizeof(GfVec2f) == 2 * sizeof(float),
+    "The quantized arrays are encoded and decoded as contiguous floats");
+
+// Bytes per element of a quantized array, 0 if the role is not a quantized one.
+size_t GetQuantizedElementSize(HdQuantizedRole role)
+{
+    switch (role)
+    {
+    case HdQuantizedRole::Position:
+        return 3 * sizeof(uint16_t);
+    case HdQuantizedRole::Normal:
+    case HdQuantizedRole::TexCoord:
+        return 2 * sizeof(uint16_t);
+    default:
+        return 0;
+    }
+}
+
+size_t GetQuantizedHeaderSize(HdQuantizedRole role)
+{
+    return kQuantizedHeaderSize + (role == HdQuantizedRole::Position ? kPositionGridSize : 0);
+}
+
+// Quantized page of the value, empty if the value type does not match the role or if the value
+// is out of the range of the encoding.
+std::vector<uint8_t> Quantize(const VtValue& value, HdQuantizedRole role)
+{
+    const float* floats = nullptr;
+    size_t count        = 0;
+    if (role == HdQuantizedRole::TexCoord && value.IsHolding<VtVec2fArray>())
+    {
+        const auto& array = value.UncheckedGet<VtVec2fArray>();
+        floats            = reinterpret_cast<const float*>(array.cdata());
+        count             = array.size();
+    }
+    else if ((role == HdQuantizedRole::Position || role == HdQuantizedRole::Normal) &&
+        value.IsHolding<VtVec3fArray>())
+    {
+        const auto& array = value.UncheckedGet<VtVec3fArray>();
+        floats            = reinterpret_cast<const float*>(array.cdata());
+        count             = array.size();
+    }
+    else
+    {
+        return {};
+    }
+
+    const size_t headerSize = GetQuantizedHeaderSize(role);
+    std::vector<uint8_t> page(headerSize + count * GetQuantizedElementSize(role));
+    const uint64_t count64 = count;
+    page[0]                = static_cast<uint8_t>(role);
+    std::memcpy(page.data() + sizeof(uint8_t), &count64, sizeof(count64));
+
+    uint8_t* out = page.data() + headerSize;
+    bool encoded = false;
+    switch (role)
+    {
+    case HdQuantizedRole::Position:
+    {
+        float grid[6];
+        encoded = HdPageQuantization::EncodePositions(floats, count, grid, grid + 3, out);
+        std::memcpy(page.data() + kQuantizedHeaderSize, grid, sizeof(grid));
+        break;
+    }
+    case HdQuantizedRole::Normal:
+        encoded = HdPageQuantization::EncodeOctahedral(floats, count, out);
+        break;
+    default:
+        encoded = HdPageQuantization::EncodeHalfs(floats, count * 2, out);
+        break;
+    }
+    return encoded ? page : std::vector<uint8_t>();
+}
+
+// Decodes a quantized page straight into the storage of its array. Returns empty VtValue if the
+// page is corrupted.
+VtValue Dequantize(const uint8_t* data, size_t size)
+{
+    const auto role          = static_cast<HdQuantizedRole>(data[0]);
+    const size_t elementSize = GetQuantizedElementSize(role);
+    const size_t headerSize  = GetQuantizedHeaderSize(role);
+    if (elementSize == 0 || size < headerSize || (size - headerSize) % elementSize != 0)
+    {
+        return {};
+    }
+    uint64_t count64 = 0;
+    std::memcpy(&count64, data + sizeof(uint8_t), sizeof(count64));
+    if (count64 != (size - headerSize) / elementSize)
+    {
+        return {};
+    }
+
+    const size_t count = static_cast<size_t>(count64);
+    const uint8_t* in  = data + headerSize;
+    switch (role)
+    {
+    case HdQuantizedRole::Position:
+    {
+        float grid[6];
+        std::memcpy(grid, data + kQuantizedHeaderSize, sizeof(grid));
+        VtVec3fArray array;
+        array.resize(count,
+            [&](GfVec3f* first, GfVec3f* /*last*/)
+            {
+                HdPageQuantization::DecodePositions(
+                    in, count, grid, grid + 3, reinterpret_cast<float*>(first));
+            });
+        return VtValue(std::move(array));
+    }
+    case HdQuantizedRole::Normal:
+    {
+        VtVec3fArray array;
+        array.resize(count,
+            [&](GfVec3f* first, GfVec3f* /*last*/)
+            { HdPageQuantization::DecodeOctahedral(in, count, reinterpret_cast<float*>(first)); });
+        return VtValue(std::move(array));
+    }
+    default:
+    {
+        VtVec2fArray array;
+        array.resize(count,
+            [&](GfVec2f* first, GfVec2f* /*last*/)
+            { HdPageQuantization::DecodeHalfs(in, count * 2, reinterpret_cast<float*>(first)); });
+        return VtValue(std::move(array));
+    }
+    }
+}
+
 // Zero-copy path for HdDefaultValueSerializer (avoids intermediate vector alloc)
 VtValue DeserializeElement(
     const IHdValueSerializer& serializer, const uint8_t* data, size_t size, const TfToken& typeHint)
 {
     if (const auto* defaultSer = dynamic_cast<const HdDefaultValueSerializer*>(&serializer))
         return defaultSer->DeserializeFromSpan(data, size, typeHint);
+    if (const auto* compressedSer = dynamic_cast<const HdCompressedValueSerializer*>(&serializer))
+        return compressedSer->DeserializeFromSpan(data, size, typeHint);
+    if (const auto* quantizedSer = dynamic_cast<const HdQuantizedValueSerializer*>(&serializer))
+        return quantizedSer->DeserializeFromSpan(data, size, typeHint);
 
     // Fall back to a copy-based path
     std::vector<uint8_t> buf(data, data + size);
@@ -305,6 +338,138 @@ std::vector<uint8_t> LoadPackedFromDisk(
     return packed;
 }
 
+// Resident element of a packed page, with its serialized size.
+struct PackedElement
+{
+    const TfToken* name = nullptr; // Container elements only
+    TfToken typeHint;
+    VtValue value;
+    size_t size = 0;
+};
+
+// Adds a resident element. Returns false if its serialized size is only known once serialized.
+bool CollectPackedElement(const TfToken* name, const HdPageableValue& element,
+    const IHdValueSerializer& serializer, std::vector<PackedElement>& collected)
+{
+    VtValue v = element.GetValueIfResident();
+    if (v.IsEmpty())
+        return true;
+    const size_t size = serializer.GetSerializedSize(v);
+    if (size == 0)
+        return false;
+    collected.push_back({ name, element.GetDataType(), std::move(v), size });
+    return true;
+}
+
+// Writes a packed page straight from the element values, in the layout of
+// SerializeContainerPacked / SerializeVectorPacked: the directory, then each payload serialized
+// into the page file, so the packed blob is never assembled in memory.
+bool StreamPackedToDisk(const std::vector<PackedElement>& collected,
+    const IHdValueSerializer& serializer, std::unique_ptr<HdBufferPageEntry>& pageEntry,
+    std::unique_ptr<HdPageFileManager>& pageFileManager, HdBufferState& bufferState)
+{
+    PackedBufferWriter w;
+    w.WriteU32(static_cast<uint32_t>(collected.size()));
+    uint64_t payloadOff = 0;
+    for (const auto& e : collected)
+    {
+        if (e.name)
+            w.WriteString(e.name->GetString());
+        w.WriteString(e.typeHint.GetString());
+        w.WriteU64(payloadOff);
+        w.WriteU64(static_cast<uint64_t>(e.size));
+        payloadOff += e.size;
+    }
+    const std::vector<uint8_t> directory = w.Release();
+    const size_t size                    = directory.size() + payloadOff;
+
+    const HdPageWriter writer = [&](const HdPageSink& sink)
+    {
+        if (!sink(AsBytes(directory.data(), directory.size())))
+            return false;
+        for (const auto& e : collected)
+        {
+            // Each payload must match the size in the directory.
+            size_t written               = 0;
+            const HdPageSink elementSink = [&](TfSpan<const std::byte> chunk)
+            {
+                written += chunk.size();
+                return written <= e.size && sink(chunk);
+            };
+            if (!serializer.SerializeTo(e.value, elementSink) || written != e.size)
+                return false;
+        }
+        return true;
+    };
+
+    // Same page reuse rules as WritePackedToDisk.
+    if (pageEntry && pageEntry->IsValid() && pageEntry->Size() == size)
+        return pageFileManager->UpdatePage(*pageEntry, writer);
+    if (pageEntry)
+        pageFileManager->ReleasePage(*pageEntry);
+    pageEntry = pageFileManager->CreatePageEntry(size, writer);
+    if (!pageEntry)
+        return false;
+    bufferState = static_cast<HdBufferState>(
+        static_cast<int>(bufferState) | static_cast<int>(HdBufferState::DiskBuffer));
+    return true;
+}
+
+// Writes the packed page of a container: streamed when the serializer knows the sizes of the
+// elements, from the SerializeContainerPacked blob otherwise. Fails if no element is resident,
+// unless forced.
+bool WriteContainerToDisk(const std::map<TfToken, std::shared_ptr<HdPageableValue>>& elements,
+    bool force, const IHdValueSerializer& serializer,
+    std::unique_ptr<HdBufferPageEntry>& pageEntry,
+    std::unique_ptr<HdPageFileManager>& pageFileManager, HdBufferState& bufferState)
+{
+    std::vector<PackedElement> collected;
+    collected.reserve(elements.size());
+    bool streamed = true;
+    for (const auto& [token, elem] : elements)
+    {
+        if (!CollectPackedElement(&token, *elem, serializer, collected))
+        {
+            streamed = false;
+            break;
+        }
+    }
+    if (streamed && !collected.empty())
+        return StreamPackedToDisk(collected, serializer, pageEntry, pageFileManager, bufferState);
+    collected.clear();
+
+    auto packed = HdPageableDataSourceUtils::SerializeContainerPacked(elements, serializer);
+    if (packed.empty() && !force)
+        return false;
+    return WritePackedToDisk(packed, pageEntry, pageFileManager, bufferState);
+}
+
+// Vector counterpart of WriteContainerToDisk.
+bool WriteVectorToDisk(const std::vector<std::shared_ptr<HdPageableValue>>& elements, bool force,
+    const IHdValueSerializer& serializer, std::unique_ptr<HdBufferPageEntry>& pageEntry,
+    std::unique_ptr<HdPageFileManager>& pageFileManager, HdBufferState& bufferState)
+{
+    std::vector<PackedElement> collected;
+    collected.reserve(elements.size());
+    bool streamed = true;
+    for (const auto& elem : elements)
+    {
+        if (!CollectPackedElement(nullptr, *elem, serializer, collected))
+        {
+            streamed = false;
+            break;
+        }
+    }
+    if (streamed && !collected.empty())
+        return StreamPackedToDisk(collected, serializer, pageEntry, pageFileManager, bufferState);
+    collected.clear();
+
+    auto packed = HdPageableDataSourceUtils::SerializeVectorPacked(elements, serializer);
+    if (packed.empty() && !force)
+        return false;
+    return WritePackedToDisk(packed, pageEntry, pageFileManager, bufferState);
+}
+
 } // anonymous namespace
 
 // HdPageableDataSourceUtils Implementation ///////////////////////////////////
@@ -329,7 +494,8 @@ std::vector<uint8_t> HdPageableDataSourceUtils::SerializeContainerPacked(
     {
         VtValue v = elem->GetValueIfResident();
         if (!v.IsEmpty())
-            collected.push_back({ token, elem->GetDataType(), serializer.Serialize(v) });
+            collected.push_back({ token, elem->GetDataType(),
+                serializer.SerializeAttribute(v, elem->GetDataType()) });
     }
     if (collected.empty())
         return {};
@@ -442,7 +608,8 @@ std::vector<uint8_t> HdPageableDataSourceUtils::SerializeVectorPacked(
     {
         VtValue v = elem->GetValueIfResident();
         if (!v.IsEmpty())
-            collected.push_back({ elem->GetDataType(), serializer.Serialize(v) });
+            collected.push_back(
+                { elem->GetDataType(), serializer.SerializeAttribute(v, elem->GetDataType()) });
     }
     if (collected.empty())
         return {};
@@ -632,12 +799,9 @@ bool HdPageableDataSourceUtils::ContainerPageOut(const TfToken& name,
         return false;
 
     // If no valid disk copy exists yet, serialize and write to disk
-    if (!hasValidDiskBuffer)
-    {
-        auto packed = SerializeContainerPacked(elements, serializer);
-        if (packed.empty() || !WritePackedToDisk(packed, pageEntry, pageFileManager, bufferState))
-            return false;
-    }
+    if (!hasValidDiskBuffer &&
+        !WriteContainerToDisk(elements, false, serializer, pageEntry, pageFileManager, bufferState))
+        return false;
 
     // Clear the resident value and update the page out count
     it->second->ClearResidentValue();
@@ -656,12 +820,7 @@ bool HdPageableDataSourceUtils::ContainerSwapToDisk(
         return false;
 
     // Serialize the container and write to disk
-    auto packed = SerializeContainerPacked(elements, serializer);
-    if (packed.empty() && !force)
-        return false;
-
-    // Write the packed buffer to disk
-    if (!WritePackedToDisk(packed, pageEntry, pageFileManager, bufferState))
+    if (!WriteContainerToDisk(elements, force, serializer, pageEntry, pageFileManager, bufferState))
         return false;
 
     // Clear the resident values and update the buffer state
@@ -781,12 +940,9 @@ bool HdPageableDataSourceUtils::VectorPageOut(
         return false;
 
     // If no valid disk copy exists yet, serialize and write to disk
-    if (!hasValidDiskBuffer)
-    {
-        auto packed = SerializeVectorPacked(elements, serializer);
-        if (packed.empty() || !WritePackedToDisk(packed, pageEntry, pageFileManager, bufferState))
-            return false;
-    }
+    if (!hasValidDiskBuffer &&
+        !WriteVectorToDisk(elements, false, serializer, pageEntry, pageFileManager, bufferState))
+        return false;
     elements[index]->ClearResidentValue();
     ++pageOutCount;
     return true;
@@ -803,12 +959,7 @@ bool HdPageableDataSourceUtils::VectorSwapToDisk(
         return false;
 
     // Serialize the vector and write to disk
-    auto packed = SerializeVectorPacked(elements, serializer);
-    if (packed.empty() && !force)
-        return false;
-
-    // Write the packed buffer to disk
-    if (!WritePackedToDisk(packed, pageEntry, pageFileManager, bufferState))
+    if (!WriteVectorToDisk(elements, force, serializer, pageEntry, pageFileManager, bufferState))
         return false;
 
     // Clear the resident value and update the page out count
@@ -848,98 +999,51 @@ std::string HdPageableDataSourceUtils::SampledGetBufferKey(
     return TfStringPrintf("%s_%s_%g", primPath.GetText(), attributeName.GetText(), time);
 }
 
+// IHdValueSerializer Implementation //////////////////////////////////////////
+
+bool IHdValueSerializer::SerializeTo(const VtValue& value, const HdPageSink& sink) const
+{
+    const auto data = Serialize(value);
+    return !data.empty() && sink(AsBytes(data.data(), data.size()));
+}
+
 // HdDefaultValueSerializer Implementation ////////////////////////////////////
 
 bool HdDefaultValueSerializer::CanSerialize(const std::type_index& type) const
 {
-    static const std::set<std::type_index> supportedTypes = {
-        typeid(VtFloatArray),
-        typeid(VtDoubleArray),
-        typeid(VtIntArray),
-        typeid(VtUIntArray),
-        typeid(VtInt64Array),
-        typeid(VtUInt64Array),
-        typeid(VtHalfArray),
-        typeid(VtVec2fArray),
-        typeid(VtVec2dArray),
-        typeid(VtVec2iArray),
-        typeid(VtVec3fArray),
-        typeid(VtVec3dArray),
-        typeid(VtVec3iArray),
-        typeid(VtVec4fArray),
-        typeid(VtVec4dArray),
-        typeid(VtVec4iArray),
-        typeid(VtMatrix4fArray),
-        typeid(VtMatrix4dArray),
-        typeid(VtQuatfArray),
-        typeid(VtQuatdArray),
-        typeid(VtStringArray),
-        typeid(VtTokenArray),
-    };
-    return supportedTypes.find(type) != supportedTypes.end();
+    return HdValueTypeRegistry::GetInstance().Find(type) != nullptr;
 }
 
 std::vector<uint8_t> HdDefaultValueSerializer::Serialize(const VtValue& value) const
 {
-    // POD arrays: single allocation with 1-byte type tag prefix
-    if (value.IsHolding<VtFloatArray>())
-        return SerializePodTagged(VtTypeTag::FloatArray, value.UncheckedGet<VtFloatArray>());
-    if (value.IsHolding<VtDoubleArray>())
-        return SerializePodTagged(VtTypeTag::DoubleArray, value.UncheckedGet<VtDoubleArray>());
-    if (value.IsHolding<VtHalfArray>())
-        return SerializePodTagged(VtTypeTag::HalfArray, value.UncheckedGet<VtHalfArray>());
-    if (value.IsHolding<VtIntArray>())
-        return SerializePodTagged(VtTypeTag::IntArray, value.UncheckedGet<VtIntArray>());
-    if (value.IsHolding<VtUIntArray>())
-        return SerializePodTagged(VtTypeTag::UIntArray, value.UncheckedGet<VtUIntArray>());
-    if (value.IsHolding<VtInt64Array>())
-        return SerializePodTagged(VtTypeTag::Int64Array, value.UncheckedGet<VtInt64Array>());
-    if (value.IsHolding<VtUInt64Array>())
-        return SerializePodTagged(VtTypeTag::UInt64Array, value.UncheckedGet<VtUInt64Array>());
-    if (value.IsHolding<VtVec2fArray>())
-        return SerializePodTagged(VtTypeTag::Vec2fArray, value.UncheckedGet<VtVec2fArray>());
-    if (value.IsHolding<VtVec2dArray>())
-        return SerializePodTagged(VtTypeTag::Vec2dArray, value.UncheckedGet<VtVec2dArray>());
-    if (value.IsHolding<VtVec2iArray>())
-        return SerializePodTagged(VtTypeTag::Vec2iArray, value.UncheckedGet<VtVec2iArray>());
-    if (value.IsHolding<VtVec3fArray>())
-        return SerializePodTagged(VtTypeTag::Vec3fArray, value.UncheckedGet<VtVec3fArray>());
-    if (value.IsHolding<VtVec3dArray>())
-        return SerializePodTagged(VtTypeTag::Vec3dArray, value.UncheckedGet<VtVec3dArray>());
-    if (value.IsHolding<VtVec3iArray>())
-        return SerializePodTagged(VtTypeTag::Vec3iArray, value.UncheckedGet<VtVec3iArray>());
-    if (value.IsHolding<VtVec4fArray>())
-        return SerializePodTagged(VtTypeTag::Vec4fArray, value.UncheckedGet<VtVec4fArray>());
-    if (value.IsHolding<VtVec4dArray>())
-        return SerializePodTagged(VtTypeTag::Vec4dArray, value.UncheckedGet<VtVec4dArray>());
-    if (value.IsHolding<VtVec4iArray>())
-        return SerializePodTagged(VtTypeTag::Vec4iArray, value.UncheckedGet<VtVec4iArray>());
-    if (value.IsHolding<VtMatrix4fArray>())
-        return SerializePodTagged(VtTypeTag::Matrix4fArray, value.UncheckedGet<VtMatrix4fArray>());
-    if (value.IsHolding<VtMatrix4dArray>())
-        return SerializePodTagged(VtTypeTag::Matrix4dArray, value.UncheckedGet<VtMatrix4dArray>());
-    if (value.IsHolding<VtQuatfArray>())
-        return SerializePodTagged(VtTypeTag::QuatfArray, value.UncheckedGet<VtQuatfArray>());
-    if (value.IsHolding<VtQuatdArray>())
-        return SerializePodTagged(VtTypeTag::QuatdArray, value.UncheckedGet<VtQuatdArray>());
-
-    // Variable-length types
-    if (value.IsHolding<VtStringArray>())
-    {
-        return SerializeStringArrayTagged(VtTypeTag::StringArray,
-            value.UncheckedGet<VtStringArray>(),
-            [](const std::string& s) -> const std::string& { return s; });
-    }
-
-    if (value.IsHolding<VtTokenArray>())
-    {
-        return SerializeStringArrayTagged(VtTypeTag::TokenArray, value.UncheckedGet<VtTokenArray>(),
-            [](const TfToken& t) -> const std::string& { return t.GetString(); });
-    }
-
-    TF_WARN("HdDefaultValueSerializer: Unsupported type for serialization: %s",
-        value.GetTypeName().c_str());
-    return {};
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().Find(value.GetTypeid());
+    if (!type)
+    {
+        TF_WARN("HdDefaultValueSerializer: Unsupported type for serialization: %s",
+            value.GetTypeName().c_str());
+        return {};
+    }
+
+    // Single allocation with the 1-byte type tag prefix
+    std::vector<uint8_t> result(kTypeTagSize + type->payloadSize(value));
+    result[0]          = type->tag;
+    size_t pos         = kTypeTagSize;
+    const bool written = type->write(value,
+        [&result, &pos](TfSpan<const std::byte> chunk)
+        {
+            if (chunk.size() > result.size() - pos)
+                return false;
+            if (!chunk.empty())
+                std::memcpy(result.data() + pos, chunk.data(), chunk.size());
+            pos += chunk.size();
+            return true;
+        });
+    if (!written || pos != result.size())
+    {
+        TF_WARN("HdDefaultValueSerializer: Failed to serialize %s", value.GetTypeName().c_str());
+        return {};
+    }
+    return result;
 }
 
 VtValue HdDefaultValueSerializer::DeserializeFromSpan(
@@ -950,63 +1054,13 @@ VtValue HdDefaultValueSerializer::DeserializeFromSpan(
         return {};
     }
 
-    const auto tag           = static_cast<VtTypeTag>(data[0]);
-    const uint8_t* payload   = data + kTypeTagSize;
-    const size_t payloadSize = size - kTypeTagSize;
-
-    switch (tag)
-    {
-    case VtTypeTag::FloatArray:
-        return VtValue(DeserializePodDirect<float>(payload, payloadSize));
-    case VtTypeTag::DoubleArray:
-        return VtValue(DeserializePodDirect<double>(payload, payloadSize));
-    case VtTypeTag::HalfArray:
-        return VtValue(DeserializePodDirect<GfHalf>(payload, payloadSize));
-    case VtTypeTag::IntArray:
-        return VtValue(DeserializePodDirect<int>(payload, payloadSize));
-    case VtTypeTag::UIntArray:
-        return VtValue(DeserializePodDirect<unsigned int>(payload, payloadSize));
-    case VtTypeTag::Int64Array:
-        return VtValue(DeserializePodDirect<int64_t>(payload, payloadSize));
-    case VtTypeTag::UInt64Array:
-        return VtValue(DeserializePodDirect<uint64_t>(payload, payloadSize));
-    case VtTypeTag::Vec2fArray:
-        return VtValue(DeserializePodDirect<GfVec2f>(payload, payloadSize));
-    case VtTypeTag::Vec2dArray:
-        return VtValue(DeserializePodDirect<GfVec2d>(payload, payloadSize));
-    case VtTypeTag::Vec2iArray:
-        return VtValue(DeserializePodDirect<GfVec2i>(payload, payloadSize));
-    case VtTypeTag::Vec3fArray:
-        return VtValue(DeserializePodDirect<GfVec3f>(payload, payloadSize));
-    case VtTypeTag::Vec3dArray:
-        return VtValue(DeserializePodDirect<GfVec3d>(payload, payloadSize));
-    case VtTypeTag::Vec3iArray:
-        return VtValue(DeserializePodDirect<GfVec3i>(payload, payloadSize));
-    case VtTypeTag::Vec4fArray:
-        return VtValue(DeserializePodDirect<GfVec4f>(payload, payloadSize));
-    case VtTypeTag::Vec4dArray:
-        return VtValue(DeserializePodDirect<GfVec4d>(payload, payloadSize));
-    case VtTypeTag::Vec4iArray:
-        return VtValue(DeserializePodDirect<GfVec4i>(payload, payloadSize));
-    case VtTypeTag::Matrix4fArray:
-        return VtValue(DeserializePodDirect<GfMatrix4f>(payload, payloadSize));
-    case VtTypeTag::Matrix4dArray:
-        return VtValue(DeserializePodDirect<GfMatrix4d>(payload, payloadSize));
-    case VtTypeTag::QuatfArray:
-        return VtValue(DeserializePodDirect<GfQuatf>(payload, payloadSize));
-    case VtTypeTag::QuatdArray:
-        return VtValue(DeserializePodDirect<GfQuatd>(payload, payloadSize));
-
-    case VtTypeTag::StringArray:
-        return DeserializeStringArrayDirect<VtStringArray>(
-            payload, payloadSize, [](std::string s) -> std::string { return s; });
-    case VtTypeTag::TokenArray:
-        return DeserializeStringArrayDirect<VtTokenArray>(
-            payload, payloadSize, [](std::string s) { return TfToken(std::move(s)); });
-    default:
-        TF_WARN("HdDefaultValueSerializer: Unknown type tag %d", static_cast<int>(tag));
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().FindTag(data[0]);
+    if (!type)
+    {
+        TF_WARN("HdDefaultValueSerializer: Unknown type tag %d", static_cast<int>(data[0]));
         return {};
     }
+    return type->read(data + kTypeTagSize, size - kTypeTagSize);
 }
 
 VtValue HdDefaultValueSerializer::Deserialize(
@@ -1015,84 +1069,40 @@ VtValue HdDefaultValueSerializer::Deserialize(
     return DeserializeFromSpan(data.data(), data.size(), typeHint);
 }
 
-size_t HdDefaultValueSerializer::EstimateSize(const VtValue& value) const
+VtValue HdDefaultValueSerializer::DeserializeFromPage(HdPageFileManager& pageFileManager,
+    const HdBufferPageEntry& pageEntry, const TfToken& typeHint) const
 {
-    // Float arrays
-    if (value.IsHolding<VtFloatArray>())
-        return value.UncheckedGet<VtFloatArray>().size() * sizeof(float);
-    if (value.IsHolding<VtDoubleArray>())
-        return value.UncheckedGet<VtDoubleArray>().size() * sizeof(double);
-    if (value.IsHolding<VtHalfArray>())
-        return value.UncheckedGet<VtHalfArray>().size() * sizeof(GfHalf);
-
-    // Integer arrays
-    if (value.IsHolding<VtIntArray>())
-        return value.UncheckedGet<VtIntArray>().size() * sizeof(int);
-    if (value.IsHolding<VtUIntArray>())
-        return value.UncheckedGet<VtUIntArray>().size() * sizeof(unsigned int);
-    if (value.IsHolding<VtInt64Array>())
-        return value.UncheckedGet<VtInt64Array>().size() * sizeof(int64_t);
-    if (value.IsHolding<VtUInt64Array>())
-        return value.UncheckedGet<VtUInt64Array>().size() * sizeof(uint64_t);
-
-    // Vec2 arrays
-    if (value.IsHolding<VtVec2fArray>())
-        return value.UncheckedGet<VtVec2fArray>().size() * sizeof(GfVec2f);
-    if (value.IsHolding<VtVec2dArray>())
-        return value.UncheckedGet<VtVec2dArray>().size() * sizeof(GfVec2d);
-    if (value.IsHolding<VtVec2iArray>())
-        return value.UncheckedGet<VtVec2iArray>().size() * sizeof(GfVec2i);
-
-    // Vec3 arrays
-    if (value.IsHolding<VtVec3fArray>())
-        return value.UncheckedGet<VtVec3fArray>().size() * sizeof(GfVec3f);
-    if (value.IsHolding<VtVec3dArray>())
-        return value.UncheckedGet<VtVec3dArray>().size() * sizeof(GfVec3d);
-    if (value.IsHolding<VtVec3iArray>())
-        return value.UncheckedGet<VtVec3iArray>().size() * sizeof(GfVec3i);
-
-    // Vec4 arrays
-    if (value.IsHolding<VtVec4fArray>())
-        return value.UncheckedGet<VtVec4fArray>().size() * sizeof(GfVec4f);
-    if (value.IsHolding<VtVec4dArray>())
-        return value.UncheckedGet<VtVec4dArray>().size() * sizeof(GfVec4d);
-    if (value.IsHolding<VtVec4iArray>())
-        return value.UncheckedGet<VtVec4iArray>().size() * sizeof(GfVec4i);
-
-    // Matrix arrays
-    if (value.IsHolding<VtMatrix4fArray>())
-        return value.UncheckedGet<VtMatrix4fArray>().size() * sizeof(GfMatrix4f);
-    if (value.IsHolding<VtMatrix4dArray>())
-        return value.UncheckedGet<VtMatrix4dArray>().size() * sizeof(GfMatrix4d);
-
-    // Quaternion arrays
-    if (value.IsHolding<VtQuatfArray>())
-        return value.UncheckedGet<VtQuatfArray>().size() * sizeof(GfQuatf);
-    if (value.IsHolding<VtQuatdArray>())
-        return value.UncheckedGet<VtQuatdArray>().size() * sizeof(GfQuatd);
-
-    // String arrays
-    if (value.IsHolding<VtStringArray>())
-    {
-        const auto& array = value.UncheckedGet<VtStringArray>();
-        size_t size       = sizeof(size_t); // count header
-        for (const auto& str : array)
-        {
-            size += sizeof(size_t) + str.size();
-        }
-        return size;
+    uint8_t tag = 0;
+    if (pageEntry.Size() < kTypeTagSize ||
+        !pageFileManager.LoadPageRange(
+            pageEntry, 0, TfSpan<std::byte>(reinterpret_cast<std::byte*>(&tag), kTypeTagSize)))
+    {
+        return {};
     }
 
-    // Token arrays
-    if (value.IsHolding<VtTokenArray>())
+    // POD arrays are read into the storage of the array.
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().FindTag(tag);
+    if (type && type->readFromPage)
     {
-        const auto& array = value.UncheckedGet<VtTokenArray>();
-        size_t size       = sizeof(size_t); // count header
-        for (const auto& token : array)
-        {
-            size += sizeof(size_t) + token.GetString().size();
-        }
-        return size;
+        return type->readFromPage(
+            pageFileManager, pageEntry, kTypeTagSize, pageEntry.Size() - kTypeTagSize);
+    }
+
+    // The other types are parsed from a staging page.
+    std::vector<uint8_t> page(pageEntry.Size());
+    if (!pageFileManager.LoadPage(pageEntry, page.data()))
+    {
+        return {};
+    }
+    return DeserializeFromSpan(page.data(), page.size(), typeHint);
+}
+
+size_t HdDefaultValueSerializer::EstimateSize(const VtValue& value) const
+{
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().Find(value.GetTypeid());
+    if (type)
+    {
+        return type->memoryUsage(value);
     }
 
     TF_WARN("HdDefaultValueSerializer: Unknown type for size estimation: %s",
@@ -1100,77 +1110,289 @@ size_t HdDefaultValueSerializer::EstimateSize(const VtValue& value) const
     return 1024; // Default estimate
 }
 
-// HdPageableValue Implementation /////////////////////////////////////////////
-//
-// HdPageableValue stores a single VtValue that can be paged to/from disk.
-// Unlike container/vector data sources which pack multiple elements into one
-// disk page, HdPageableValue owns its own individual HdBufferPageEntry.
-//
-// Disk format: the raw output of IHdValueSerializer::Serialize() — typically
-// [uint8 VtTypeTag][payload] for the default serializer.
-//
-// Serialized cache (mSerializedCache): lazily populated on first disk write
-// or span access, cleared when the source value changes. This avoids repeated
-// serialization when the same value is written multiple times.
-
-HdPageableValue::HdPageableValue(const SdfPath& path, size_t estimatedSize, HdBufferUsage usage,
-    const std::unique_ptr<HdPageFileManager>& pageFileManager,
-    const std::unique_ptr<HdMemoryMonitor>& memoryMonitor, DestructionCallback destructionCallback,
-    const VtValue& data, const TfToken& dataType, bool enableImplicitPaging,
-    const IHdValueSerializer* serializer) :
-    HdPageableBufferBase<>(
-        path, estimatedSize, usage, pageFileManager, memoryMonitor, destructionCallback),
-    mSourceValue(data),
-    mDataType(dataType),
-    mSerializer(serializer),
-    mEnableImplicitPaging(enableImplicitPaging)
+size_t HdDefaultValueSerializer::GetSerializedSize(const VtValue& value) const
 {
-    HdPageableBufferBase<>::CreateSceneBuffer();
-    mCurrentStatus = HdPagingStatus::Resident;
+    if (!IsDefaultSerializer(*this))
+    {
+        return IHdValueSerializer::GetSerializedSize(value);
+    }
+
+    // A dictionary holding a value which is not serializable has no payload size.
+    const HdValueType* type  = HdValueTypeRegistry::GetInstance().Find(value.GetTypeid());
+    const size_t payloadSize = type ? type->payloadSize(value) : 0;
+    return payloadSize > 0 ? kTypeTagSize + payloadSize : 0;
 }
 
-VtValue HdPageableValue::GetValue(bool* outPagedIn)
+bool HdDefaultValueSerializer::SerializeTo(const VtValue& value, const HdPageSink& sink) const
 {
-    if (outPagedIn)
+    if (!IsDefaultSerializer(*this))
     {
-        *outPagedIn = false;
+        return IHdValueSerializer::SerializeTo(value, sink);
     }
 
-    ++mAccessCount;
-
-    // Fast path: data is resident
-    if (IsDataResident())
+    // The type tag, then the payload written from the value: the storage of POD arrays as is
+    const HdValueType* type = HdValueTypeRegistry::GetInstance().Find(value.GetTypeid());
+    if (!type)
     {
-        std::shared_lock<std::shared_mutex> readLock(mDataMutex);
-        return mSourceValue;
+        return IHdValueSerializer::SerializeTo(value, sink);
     }
+    return sink(AsBytes(&type->tag, kTypeTagSize)) && type->write(value, sink);
+}
 
-    if (!mEnableImplicitPaging)
+// HdCompressedValueSerializer Implementation /////////////////////////////////
+//
+// Disk format: [uint8 HdPageCodec] followed by the codec data, see HdPageCodecs. The wrapped
+// serializer output is shuffled by the scalar size of the value (4 for float and GfVec3f
+// arrays, 8 for double arrays, ...) before compression.
+
+HdCompressedValueSerializer::HdCompressedValueSerializer(
+    std::shared_ptr<IHdValueSerializer> serializer, HdPageCodec codec) :
+    mSerializer(std::move(serializer)), mCodec(codec)
+{
+}
+
+bool HdCompressedValueSerializer::CanSerialize(const std::type_index& type) const
+{
+    return mSerializer->CanSerialize(type);
+}
+
+std::vector<uint8_t> HdCompressedValueSerializer::Serialize(const VtValue& value) const
+{
+    const auto data = mSerializer->Serialize(value);
+    if (data.empty())
     {
         return {};
     }
+    return HdPageCodecs::Encode(mCodec, data.data(), data.size(), GetScalarSize(value));
+}
 
-    // Slow path: page in from disk under exclusive lock.
-    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
-
-    // Another thread may have paged in while we waited for the lock.
-    if (HasSceneBuffer())
+std::vector<uint8_t> HdCompressedValueSerializer::SerializeAttribute(
+    const VtValue& value, const TfToken& typeHint) const
+{
+    const auto data = mSerializer->SerializeAttribute(value, typeHint);
+    if (data.empty())
     {
-        return mSourceValue;
+        return {};
     }
+    return HdPageCodecs::Encode(mCodec, data.data(), data.size(), GetScalarSize(value));
+}
 
-    mCurrentStatus = HdPagingStatus::Loading;
+VtValue HdCompressedValueSerializer::Deserialize(
+    const std::vector<uint8_t>& data, const TfToken& typeHint) const
+{
+    return DeserializeFromSpan(data.data(), data.size(), typeHint);
+}
+
+VtValue HdCompressedValueSerializer::DeserializeFromSpan(
+    const uint8_t* data, size_t size, const TfToken& typeHint) const
+{
+    std::vector<uint8_t> scratch;
+    const uint8_t* decoded = nullptr;
+    size_t decodedSize     = 0;
+    if (!HdPageCodecs::Decode(data, size, scratch, decoded, decodedSize))
+    {
+        TF_WARN("HdCompressedValueSerializer: Corrupted page (codec %d, %zu bytes)",
+            static_cast<int>(HdPageCodecs::GetCodec(data, size)), size);
+        return {};
+    }
+    return DeserializeElement(*mSerializer, decoded, decodedSize, typeHint);
+}
+
+size_t HdCompressedValueSerializer::EstimateSize(const VtValue& value) const
+{
+    return mSerializer->EstimateSize(value);
+}
+
+// HdQuantizedValueSerializer Implementation //////////////////////////////////
+//
+// Disk format: [uint8 HdQuantizedRole] followed by
+//   None:     the wrapped serializer output
+//   Position: [uint64 count] [float origin[3]] [float step[3]] [uint16 offsets, 3 per point]
+//   Normal:   [uint64 count] [int16 octahedral snorm, 2 per normal]
+//   TexCoord: [uint64 count] [half, 2 per coordinate]
+// The kernels are in HdPageQuantization.
+
+HdQuantizedValueSerializer::HdQuantizedValueSerializer(
+    std::shared_ptr<IHdValueSerializer> serializer, RoleMap roles) :
+    mSerializer(std::move(serializer)), mRoles(std::move(roles))
+{
+}
+
+HdQuantizedValueSerializer::RoleMap HdQuantizedValueSerializer::GetDefaultRoles()
+{
+    return {
+        { HdTokens->points, HdQuantizedRole::Position },
+        { HdTokens->normals, HdQuantizedRole::Normal },
+        { TfToken("primvars:normals"), HdQuantizedRole::Normal },
+        { TfToken("st"), HdQuantizedRole::TexCoord },
+        { TfToken("uv"), HdQuantizedRole::TexCoord },
+        { TfToken("primvars:st"), HdQuantizedRole::TexCoord },
+        { TfToken("primvars:uv"), HdQuantizedRole::TexCoord },
+    };
+}
+
+bool HdQuantizedValueSerializer::CanSerialize(const std::type_index& type) const
+{
+    return mSerializer->CanSerialize(type);
+}
+
+std::vector<uint8_t> HdQuantizedValueSerializer::Serialize(const VtValue& value) const
+{
+    return SerializeAttribute(value, TfToken());
+}
+
+std::vector<uint8_t> HdQuantizedValueSerializer::SerializeAttribute(
+    const VtValue& value, const TfToken& typeHint) const
+{
+    const HdQuantizedRole role = GetRole(typeHint);
+    if (role != HdQuantizedRole::None)
+    {
+        auto page = Quantize(value, role);
+        if (!page.empty())
+        {
+            return page;
+        }
+    }
+
+    auto data = mSerializer->SerializeAttribute(value, typeHint);
+    if (data.empty())
+    {
+        return {};
+    }
+    data.insert(data.begin(), static_cast<uint8_t>(HdQuantizedRole::None));
+    return data;
+}
+
+VtValue HdQuantizedValueSerializer::Deserialize(
+    const std::vector<uint8_t>& data, const TfToken& typeHint) const
+{
+    return DeserializeFromSpan(data.data(), data.size(), typeHint);
+}
+
+VtValue HdQuantizedValueSerializer::DeserializeFromSpan(
+    const uint8_t* data, size_t size, const TfToken& typeHint) const
+{
+    if (size == 0)
+    {
+        return {};
+    }
+    if (static_cast<HdQuantizedRole>(data[0]) == HdQuantizedRole::None)
+    {
+        return DeserializeElement(*mSerializer, data + 1, size - 1, typeHint);
+    }
+
+    VtValue value = Dequantize(data, size);
+    if (value.IsEmpty())
+    {
+        TF_WARN("HdQuantizedValueSerializer: Corrupted page (role %d, %zu bytes)",
+            static_cast<int>(data[0]), size);
+    }
+    return value;
+}
+
+size_t HdQuantizedValueSerializer::EstimateSize(const VtValue& value) const
+{
+    return mSerializer->EstimateSize(value);
+}
+
+HdQuantizedRole HdQuantizedValueSerializer::GetRole(const TfToken& typeHint) const
+{
+    const auto it = mRoles.find(typeHint);
+    return it != mRoles.end() ? it->second : HdQuantizedRole::None;
+}
+
+// HdPageableValue Implementation /////////////////////////////////////////////
+//
+// HdPageableValue stores a single VtValue that can be paged to/from disk.
+// Unlike container/vector data sources which pack multiple elements into one
+// disk page, HdPageableValue owns its own individual HdBufferPageEntry.
+//
+// Disk format: the raw output of IHdValueSerializer::Serialize() — typically
+// [uint8 tag][payload] for the default serializer.
+//
+// Serialized cache (mSerializedCache): lazily populated by the span access and
+// by the page-outs of values smaller than HdPageFileManager::STREAM_CHUNK_SIZE,
+// released when the source value changes or is paged out. Larger values are
+// streamed into the page file from the value (IHdValueSerializer::SerializeTo),
+// so a page-out does not hold a second copy of them.
+
+HdPageableValue::HdPageableValue(const SdfPath& path, size_t estimatedSize, HdBufferUsage usage,
+    const std::unique_ptr<HdPageFileManager>& pageFileManager,
+    const std::unique_ptr<HdMemoryMonitor>& memoryMonitor, DestructionCallback destructionCallback,
+    const VtValue& data, const TfToken& dataType, bool enableImplicitPaging,
+    const IHdValueSerializer* serializer) :
+    HdPageableBufferBase<>(
+        path, estimatedSize, usage, pageFileManager, memoryMonitor, destructionCallback),
+    mSourceValue(data),
+    mDataType(dataType),
+    mSerializer(serializer),
+    mEnableImplicitPaging(enableImplicitPaging)
+{
+    HdPageableBufferBase<>::CreateSceneBuffer();
+    mCurrentStatus = HdPagingStatus::Resident;
+}
+
+VtValue HdPageableValue::GetValue(bool* outPagedIn)
+{
+    if (outPagedIn)
+    {
+        *outPagedIn = false;
+    }
+
+    ++mAccessCount;
+
+    // Fast path: data is resident
+    if (IsDataResident())
+    {
+        if (TakePrefetched())
+        {
+            mMemoryMonitor->GetPrefetchHistory().RecordHit(Key());
+        }
+        std::shared_lock<std::shared_mutex> readLock(mDataMutex);
+        return mSourceValue;
+    }
+
+    if (!mEnableImplicitPaging)
+    {
+        return {};
+    }
+
+    // Slow path: page in from disk under exclusive lock.
+    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+
+    // Another thread, or a prefetch, may have paged in while we waited for the lock.
+    if (HasSceneBuffer())
+    {
+        if (TakePrefetched())
+        {
+            mMemoryMonitor->GetPrefetchHistory().RecordHit(Key());
+        }
+        return mSourceValue;
+    }
+
+    // Beyond the I/O budget of the frame, the page-in is queued for the next frames and the
+    // caller gets an empty value meanwhile. The value stays paged out until then.
+    HdFrameIOBudget& budget = mMemoryMonitor->GetFrameIOBudget();
+    if (HasValidDiskBuffer() && !budget.TryAcquire(Size()))
+    {
+        budget.DeferPageIn(Key(), Size());
+        return {};
+    }
+
+    mCurrentStatus = HdPagingStatus::Loading;
 
     // Load from disk directly into mSourceValue.
     // NOTE: DataSource doesn't have knowledge of VRAM and is packed when storing,
     // so we bypass the base PageToSceneMemory.
     if (HasValidDiskBuffer())
     {
-        std::vector<uint8_t> buffer(mPageEntry->Size());
-        if (mPageFileManager->LoadPage(*mPageEntry, buffer.data()))
+        const auto start  = std::chrono::steady_clock::now();
+        const bool loaded = LoadSourceValueFromDisk();
+        budget.Charge(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start));
+        if (loaded)
         {
-            mSourceValue = DeserializeVtValue(buffer);
-            mSerializedCache.clear();
+            std::vector<uint8_t>().swap(mSerializedCache);
             HdPageableBufferBase<>::CreateSceneBuffer();
             ++mPageInCount;
             mCurrentStatus = HdPagingStatus::Resident;
@@ -1178,7 +1400,13 @@ VtValue HdPageableValue::GetValue(bool* outPagedIn)
             {
                 *outPagedIn = true;
             }
-            return mSourceValue;
+
+            // Outside the lock: the neighbours of the buffer may be prefetched.
+            VtValue value = mSourceValue;
+            writeLock.unlock();
+            (void)TakePrefetched();
+            mMemoryMonitor->GetPrefetchHistory().RecordDemandPageIn(Key());
+            return value;
         }
     }
 
@@ -1214,17 +1442,16 @@ HdPagingStatus HdPageableValue::GetStatus() const
 bool HdPageableValue::SwapToSceneMemory(bool /*force*/, HdBufferState releaseBuffer)
 {
     std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+    mPendingPageOutValid = false;
 
     mCurrentStatus = HdPagingStatus::Loading;
 
     // Bypass the base SwapToSceneMemory to load from disk directly.
     if (HasValidDiskBuffer())
     {
-        std::vector<uint8_t> buffer(mPageEntry->Size());
-        if (mPageFileManager->LoadPage(*mPageEntry, buffer.data()))
+        if (LoadSourceValueFromDisk())
         {
-            mSourceValue = DeserializeVtValue(buffer);
-            mSerializedCache.clear();
+            std::vector<uint8_t>().swap(mSerializedCache);
             HdPageableBufferBase<>::CreateSceneBuffer();
 
             // Remove other buffers and update status
@@ -1246,6 +1473,7 @@ bool HdPageableValue::SwapToSceneMemory(bool /*force*/, HdBufferState releaseBuf
 bool HdPageableValue::SwapSceneToDisk(bool force, HdBufferState releaseBuffer)
 {
     std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+    mPendingPageOutValid = false;
 
     if (mSourceValue.IsEmpty() && !force)
     {
@@ -1254,34 +1482,104 @@ bool HdPageableValue::SwapSceneToDisk(bool force, HdBufferState releaseBuffer)
 
     mCurrentStatus = HdPagingStatus::Saving;
 
-    UpdateSerializedCache();
-
-    if (mSerializedCache.empty())
+    // A disk page holding the current value (paged out before, or reused from the persistent
+    // page cache) is not written again.
+    if ((!mDiskPageCurrent || !HasValidDiskBuffer()) && !WriteDiskPage())
     {
         mCurrentStatus = HdPagingStatus::Invalid;
         return false;
     }
 
-    // Try in-place update if page entry already exists with matching size;
-    // otherwise release the old slot and allocate a new one.
-    bool written = false;
-    if (mPageEntry && mPageEntry->IsValid() && mPageEntry->Size() == mSerializedCache.size())
+    // Release other buffers and update status
+    mBufferState = static_cast<HdBufferState>(
+        static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::DiskBuffer));
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::SceneBuffer))
+        ReleaseSceneBuffer();
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::RendererBuffer))
+        ReleaseRendererBuffer();
+
+    mSourceValue = VtValue();
+    std::vector<uint8_t>().swap(mSerializedCache);
+    ++mPageOutCount;
+    mCurrentStatus = HdPagingStatus::PagedOut;
+    return true;
+}
+
+bool HdPageableValue::PageToDisk(bool /*force*/)
+{
+    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+    if (mSourceValue.IsEmpty())
     {
-        written = mPageFileManager->UpdatePage(*mPageEntry, mSerializedCache.data());
+        return HasValidDiskBuffer();
     }
-    if (!written)
+    if ((!mDiskPageCurrent || !HasValidDiskBuffer()) && !WriteDiskPage())
     {
-        if (mPageEntry)
-            mPageFileManager->ReleasePage(*mPageEntry);
-        mPageEntry =
-            mPageFileManager->CreatePageEntry(mSerializedCache.data(), mSerializedCache.size());
-        if (!mPageEntry)
-        {
-            mCurrentStatus = HdPagingStatus::Invalid;
-            return false;
-        }
+        return false;
+    }
+    mBufferState = static_cast<HdBufferState>(
+        static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::DiskBuffer));
+
+    // A static value does not change anymore: its disk page is kept, its serialized copy is not.
+    if (Usage() == HdBufferUsage::Static)
+    {
+        std::vector<uint8_t>().swap(mSerializedCache);
+    }
+    return true;
+}
+
+TfSpan<const std::byte> HdPageableValue::PreparePageOut(HdBufferState /*source*/)
+{
+    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+
+    // Existing pages are updated in place by SwapSceneToDisk, and a pending buffer may still be
+    // read by an in-flight write. Large values are streamed by SwapSceneToDisk instead of being
+    // serialized for the I/O engine.
+    if (mSourceValue.IsEmpty() || HasValidDiskBuffer() || !mPendingPageOut.empty() ||
+        GetStreamedPageSize() > 0)
+    {
+        return {};
+    }
+
+    UpdateSerializedCache();
+    if (mSerializedCache.empty())
+    {
+        return {};
     }
 
+    mCurrentStatus       = HdPagingStatus::Saving;
+    mPendingPageOut      = std::move(mSerializedCache);
+    mPendingPageOutValid = true;
+    mSerializedCache.clear();
+    return TfSpan<const std::byte>(
+        reinterpret_cast<const std::byte*>(mPendingPageOut.data()), mPendingPageOut.size());
+}
+
+bool HdPageableValue::CompletePageOut(
+    std::unique_ptr<HdBufferPageEntry> pageEntry, HdBufferState releaseBuffer)
+{
+    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+
+    const bool valid     = mPendingPageOutValid;
+    mPendingPageOutValid = false;
+    std::vector<uint8_t> page;
+    page.swap(mPendingPageOut);
+
+    if (!pageEntry || !valid)
+    {
+        // The value changed while the page was written, the page is stale.
+        if (pageEntry)
+            mPageFileManager->ReleasePage(*pageEntry);
+        if (valid)
+            mCurrentStatus = HdPagingStatus::Resident;
+        return false;
+    }
+
+    if (mPageEntry)
+        mPageFileManager->ReleasePage(*mPageEntry);
+    mPageEntry = std::move(pageEntry);
+    StorePersistentPage(page);
+    mDiskPageCurrent = true;
+
     // Release other buffers and update status
     mBufferState = static_cast<HdBufferState>(
         static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::DiskBuffer));
@@ -1291,12 +1589,52 @@ bool HdPageableValue::SwapSceneToDisk(bool force, HdBufferState releaseBuffer)
         ReleaseRendererBuffer();
 
     mSourceValue = VtValue();
-    mSerializedCache.clear();
     ++mPageOutCount;
     mCurrentStatus = HdPagingStatus::PagedOut;
     return true;
 }
 
+const HdBufferPageEntry* HdPageableValue::PreparePageIn()
+{
+    std::shared_lock<std::shared_mutex> readLock(mDataMutex);
+    if (HasSceneBuffer() || !HasValidDiskBuffer() ||
+        mPageFileManager->GetIOMode() == HdPageFileIOMode::MemoryMapped || ReadsPageInPlace())
+    {
+        return nullptr;
+    }
+    return mPageEntry.get();
+}
+
+bool HdPageableValue::CompletePageIn(TfSpan<const std::byte> page, HdBufferState releaseBuffer)
+{
+    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+    mPendingPageOutValid = false;
+
+    // The value may have been paged in by someone else while the page was read.
+    if (!HasSceneBuffer())
+    {
+        if (page.empty())
+        {
+            return false;
+        }
+        const auto* s = mSerializer ? mSerializer : &GetDefaultSerializer();
+        mSourceValue  = DeserializeElement(
+            *s, reinterpret_cast<const uint8_t*>(page.data()), page.size(), mDataType);
+        std::vector<uint8_t>().swap(mSerializedCache);
+        HdPageableBufferBase<>::CreateSceneBuffer();
+        ++mPageInCount;
+    }
+
+    // Remove other buffers and update status
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::RendererBuffer))
+        ReleaseRendererBuffer();
+    if (static_cast<int>(releaseBuffer) & static_cast<int>(HdBufferState::DiskBuffer))
+        ReleaseDiskPage();
+
+    mCurrentStatus = HdPagingStatus::Resident;
+    return true;
+}
+
 TfSpan<const std::byte> HdPageableValue::GetSceneMemorySpan() const noexcept
 {
     UpdateSerializedCache();
@@ -1306,6 +1644,7 @@ TfSpan<const std::byte> HdPageableValue::GetSceneMemorySpan() const noexcept
 
 TfSpan<std::byte> HdPageableValue::GetSceneMemorySpan() noexcept
 {
+    mDiskPageCurrent = false; // The bytes may be modified through the span.
     UpdateSerializedCache();
     return TfSpan<std::byte>(
         reinterpret_cast<std::byte*>(mSerializedCache.data()), mSerializedCache.size());
@@ -1322,7 +1661,7 @@ void HdPageableValue::UpdateSerializedCache() const
 std::vector<uint8_t> HdPageableValue::SerializeVtValue(const VtValue& value) const noexcept
 {
     const auto* s = mSerializer ? mSerializer : &GetDefaultSerializer();
-    return s->Serialize(value);
+    return s->SerializeAttribute(value, mDataType);
 }
 
 VtValue HdPageableValue::DeserializeVtValue(const std::vector<uint8_t>& data) noexcept
@@ -1331,11 +1670,115 @@ VtValue HdPageableValue::DeserializeVtValue(const std::vector<uint8_t>& data) no
     return s->Deserialize(data, mDataType);
 }
 
+bool HdPageableValue::LoadSourceValueFromDisk()
+{
+    // Memory-mapped page files are deserialized in place, without a staging buffer.
+    const auto view = mPageFileManager->LoadPage(*mPageEntry);
+    if (!view.empty())
+    {
+        const auto* s = mSerializer ? mSerializer : &GetDefaultSerializer();
+        mSourceValue  = DeserializeElement(
+            *s, reinterpret_cast<const uint8_t*>(view.data()), view.size(), mDataType);
+        return true;
+    }
+
+    // The default serializer reads POD arrays straight into their storage.
+    if (ReadsPageInPlace())
+    {
+        mSourceValue = GetDefaultSerializer().DeserializeFromPage(
+            *mPageFileManager, *mPageEntry, mDataType);
+        return !mSourceValue.IsEmpty();
+    }
+
+    std::vector<uint8_t> buffer(mPageEntry->Size());
+    if (!mPageFileManager->LoadPage(*mPageEntry, buffer.data()))
+    {
+        return false;
+    }
+    mSourceValue = DeserializeVtValue(buffer);
+    return true;
+}
+
+bool HdPageableValue::WriteDiskPage()
+{
+    // Large values are streamed into the page file straight from the value.
+    const size_t streamedSize = GetStreamedPageSize();
+    if (streamedSize > 0)
+    {
+        const auto* s             = mSerializer ? mSerializer : &GetDefaultSerializer();
+        const HdPageWriter writer = [this, s](const HdPageSink& sink)
+        { return s->SerializeTo(mSourceValue, sink); };
+
+        bool written = mPageEntry && mPageEntry->IsValid() && mPageEntry->Size() == streamedSize &&
+            mPageFileManager->UpdatePage(*mPageEntry, writer);
+        if (!written)
+        {
+            if (mPageEntry)
+                mPageFileManager->ReleasePage(*mPageEntry);
+            mPageEntry = mPageFileManager->CreatePageEntry(streamedSize, writer);
+            if (!mPageEntry)
+            {
+                return false;
+            }
+        }
+        mDiskPageCurrent = true;
+        return true;
+    }
+
+    UpdateSerializedCache();
+    if (mSerializedCache.empty())
+    {
+        return false;
+    }
+
+    // Try in-place update if page entry already exists with matching size;
+    // otherwise release the old slot and allocate a new one.
+    bool written = false;
+    if (mPageEntry && mPageEntry->IsValid() && mPageEntry->Size() == mSerializedCache.size())
+    {
+        written = mPageFileManager->UpdatePage(*mPageEntry, mSerializedCache.data());
+    }
+    if (!written)
+    {
+        if (mPageEntry)
+            mPageFileManager->ReleasePage(*mPageEntry);
+        mPageEntry =
+            mPageFileManager->CreatePageEntry(mSerializedCache.data(), mSerializedCache.size());
+        if (!mPageEntry)
+        {
+            return false;
+        }
+    }
+    StorePersistentPage(mSerializedCache);
+    mDiskPageCurrent = true;
+    return true;
+}
+
+size_t HdPageableValue::GetStreamedPageSize() const
+{
+    // Persistent pages are keyed by the hash of their bytes, and a serialized copy made for the
+    // span access is written as is.
+    if (mPersistent || !mSerializedCache.empty() || mSourceValue.IsEmpty())
+    {
+        return 0;
+    }
+    const auto* s     = mSerializer ? mSerializer : &GetDefaultSerializer();
+    const size_t size = s->GetSerializedSize(mSourceValue);
+    return size >= HdPageFileManager::STREAM_CHUNK_SIZE ? size : 0;
+}
+
+bool HdPageableValue::ReadsPageInPlace() const noexcept
+{
+    return !mSerializer || IsDefaultSerializer(*mSerializer);
+}
+
 void HdPageableValue::SetResidentValue(const VtValue& value)
 {
     std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
     mSourceValue = value;
-    mSerializedCache.clear();
+    std::vector<uint8_t>().swap(mSerializedCache);
+    mPendingPageOutValid = false;
+    mDiskPageCurrent     = false;
     if (!HasSceneBuffer())
     {
         HdPageableBufferBase<>::CreateSceneBuffer();
@@ -1344,11 +1787,68 @@ void HdPageableValue::SetResidentValue(const VtValue& value)
     SetSize(EstimateMemoryUsage(value));
 }
 
+bool HdPageableValue::AttachPersistentPage(const std::string& stageIdentity)
+{
+    std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
+    if (!mPageFileManager->IsPersistent() || mSourceValue.IsEmpty())
+    {
+        return false;
+    }
+    mPersistent      = true;
+    mPersistentStage = stageIdentity;
+    if (HasValidDiskBuffer())
+    {
+        return false;
+    }
+
+    // The page is looked up by the hash of its bytes, which also covers serializer and codec
+    // changes between sessions. The bytes are dropped right away, like after a page-out.
+    UpdateSerializedCache();
+    const auto key   = MakePersistentPageKey(mSerializedCache);
+    auto pageEntry   = mPageFileManager->FindPersistentPage(key);
+    const bool found = pageEntry && pageEntry->Size() == mSerializedCache.size();
+    std::vector<uint8_t>().swap(mSerializedCache);
+    if (!found)
+    {
+        if (pageEntry)
+            mPageFileManager->ReleasePage(*pageEntry);
+        return false;
+    }
+
+    mPageEntry       = std::move(pageEntry);
+    mDiskPageCurrent = true;
+    mBufferState     = static_cast<HdBufferState>(
+        static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::DiskBuffer));
+    return true;
+}
+
+HdPersistentPageKey HdPageableValue::MakePersistentPageKey(const std::vector<uint8_t>& page) const
+{
+    HdPersistentPageKey key;
+    key.stage    = mPersistentStage;
+    key.primPath = Key().GetPrimPath().GetString();
+    if (Key().IsPropertyPath())
+    {
+        key.attribute = Key().GetName();
+    }
+    key.contentHash = ArchHash64(reinterpret_cast<const char*>(page.data()), page.size());
+    return key;
+}
+
+void HdPageableValue::StorePersistentPage(const std::vector<uint8_t>& page)
+{
+    if (mPersistent && mPageEntry && !page.empty())
+    {
+        mPageFileManager->StorePersistentPage(MakePersistentPageKey(page), mPageEntry);
+    }
+}
+
 void HdPageableValue::ClearResidentValue()
 {
     std::unique_lock<std::shared_mutex> writeLock(mDataMutex);
     mSourceValue = VtValue();
-    mSerializedCache.clear();
+    std::vector<uint8_t>().swap(mSerializedCache);
+    mPendingPageOutValid = false;
     if (HasSceneBuffer())
     {
         HdPageableBufferBase<>::ReleaseSceneBuffer();
@@ -1702,6 +2202,21 @@ std::vector<HdPageableSampledDataSource::Time> HdPageableSampledDataSource::GetA
     return HdPageableDataSourceUtils::SampledGetAllTimes(mSamples, mSamplesMutex);
 }
 
+std::vector<std::shared_ptr<HdPageableValue>> HdPageableSampledDataSource::GetSampleBuffers(
+    Time time, size_t sampleCount) const
+{
+    std::shared_lock<std::shared_mutex> readLock(mSamplesMutex);
+    auto it = std::lower_bound(mSamples.begin(), mSamples.end(), time,
+        [](const MemorySample& sample, Time t) { return sample.time < t; });
+
+    std::vector<std::shared_ptr<HdPageableValue>> buffers;
+    for (; it != mSamples.end() && buffers.size() < sampleCount; ++it)
+    {
+        buffers.push_back(it->buffer);
+    }
+    return buffers;
+}
+
 std::string HdPageableSampledDataSource::GetBufferKey(Time time) const
 {
     return HdPageableDataSourceUtils::SampledGetBufferKey(time, mPrimPath, mAttributeName);
@@ -1773,19 +2288,41 @@ HdPageableDataSourceManager::HdPageableDataSourceManager() : HdPageableDataSourc
 
 HdPageableDataSourceManager::HdPageableDataSourceManager(const Config& config)
 {
-    DefaultBufferManager::InitializeDesc desc;
+    RuntimeBufferManager::InitializeDesc desc;
     desc.pageFileDirectory   = config.pageFileDirectory;
     desc.sceneMemoryLimit    = config.sceneMemoryLimit;
     desc.rendererMemoryLimit = config.rendererMemoryLimit;
     desc.ageLimit            = config.ageLimit;
     desc.numThreads          = config.numThreads;
-
-    mBufferManager            = std::make_unique<DefaultBufferManager>(desc);
+    desc.pageFileIOMode      = config.pageFileIOMode;
+    desc.pageDeduplication   = config.pageDeduplication;
+    desc.persistentPageCache = config.persistentPageCache;
+    desc.pageIO              = config.pageIO;
+    desc.storageTiers        = config.storageTiers;
+    desc.tracePath           = config.tracePath;
+    desc.systemMemoryProbe   = config.systemMemoryProbe;
+    desc.systemMemoryBudget  = config.systemMemoryBudget;
+    desc.frameIOBudget       = config.frameIOBudget;
+
+    mBufferManager            = std::make_unique<RuntimeBufferManager>(desc);
     mFreeCrawlPercentage      = config.freeCrawlPercentage;
     mFreeCrawlInterval        = config.freeCrawlIntervalMs;
+    mCompactionBudget         = config.compactionBudget;
+    mMigrationBudget          = config.migrationBudget;
+    mColdPageAge              = config.coldPageAge;
+    mPressureControl          = config.pressureControl;
     mBackgroundCleanupEnabled = config.enableBackgroundCleanup;
+    mPageCodec                = config.pageCodec;
+    mStageIdentity            = config.stageIdentity;
+    mPressureController.SetConfig(config.pressureController);
+    GetMemoryMonitor()->GetPrefetchHistory().SetConfig(config.prefetch);
 
     InitializeDefaults();
+    if (config.quantizedPages)
+    {
+        SetSerializer(std::make_shared<HdQuantizedValueSerializer>(
+            std::make_shared<HdDefaultValueSerializer>()));
+    }
 
     if (mBackgroundCleanupEnabled)
     {
@@ -1796,14 +2333,14 @@ HdPageableDataSourceManager::HdPageableDataSourceManager(const Config& config)
 HdPageableDataSourceManager::HdPageableDataSourceManager(
     std::filesystem::path pageFileDirectory, size_t sceneMemoryLimit, size_t rendererMemoryLimit)
 {
-    DefaultBufferManager::InitializeDesc desc;
+    RuntimeBufferManager::InitializeDesc desc;
     desc.pageFileDirectory   = pageFileDirectory;
     desc.sceneMemoryLimit    = sceneMemoryLimit;
     desc.rendererMemoryLimit = rendererMemoryLimit;
     desc.ageLimit            = 20;
     desc.numThreads          = 2;
 
-    mBufferManager = std::make_unique<DefaultBufferManager>(desc);
+    mBufferManager = std::make_unique<RuntimeBufferManager>(desc);
 
     InitializeDefaults();
 
@@ -1812,11 +2349,20 @@ HdPageableDataSourceManager::HdPageableDataSourceManager(
 
 void HdPageableDataSourceManager::InitializeDefaults()
 {
-    mSerializer = std::make_shared<HdDefaultValueSerializer>();
+    SetSerializer(std::make_shared<HdDefaultValueSerializer>());
+
+    // The neighbours of a demand page-in are prefetched in the background only, the access
+    // does not wait for them.
+    if (mBufferManager->IsAsyncEnabled())
+    {
+        GetMemoryMonitor()->GetPrefetchHistory().SetNeighbourCallback(
+            [this](const std::vector<SdfPath>& keys) { PrefetchNeighbours(keys); });
+    }
 }
 
 HdPageableDataSourceManager::~HdPageableDataSourceManager()
 {
+    GetMemoryMonitor()->GetPrefetchHistory().SetNeighbourCallback(nullptr);
     mBackgroundCleanupEnabled = false;
     if (mCleanupThread.joinable())
     {
@@ -1846,6 +2392,10 @@ std::shared_ptr<HdPageableBufferCore> HdPageableDataSourceManager::GetOrCreateBu
     auto buffer = std::make_shared<HdPageableValue>(primPath, estimatedSize, HdBufferUsage::Static,
         pageFileManager, memoryMonitor, destructionCallback, data, dataType, true,
         mSerializer.get());
+    if (pageFileManager->IsPersistent())
+    {
+        buffer->AttachPersistentPage(mStageIdentity);
+    }
 
     mBufferManager->AddBuffer(primPath, buffer);
 
@@ -1855,6 +2405,151 @@ std::shared_ptr<HdPageableBufferCore> HdPageableDataSourceManager::GetOrCreateBu
 void HdPageableDataSourceManager::SetSerializer(std::shared_ptr<IHdValueSerializer> serializer)
 {
     mSerializer = std::move(serializer);
+    if (mSerializer && mPageCodec != HdPageCodec::Raw &&
+        !std::dynamic_pointer_cast<HdCompressedValueSerializer>(mSerializer))
+    {
+        mSerializer = std::make_shared<HdCompressedValueSerializer>(mSerializer, mPageCodec);
+    }
+}
+
+void HdPageableDataSourceManager::AdvanceFrame(unsigned int advanceCount)
+{
+    GetMemoryMonitor()->GetPrefetchHistory().EndFrame();
+    mBufferManager->AdvanceFrame(advanceCount);
+    ResumeDeferredPageIns();
+}
+
+void HdPageableDataSourceManager::ResumeDeferredPageIns()
+{
+    HdFrameIOBudget& budget   = GetMemoryMonitor()->GetFrameIOBudget();
+    std::vector<SdfPath> keys = budget.TakeDeferredPageIns();
+
+    size_t next = 0;
+    for (; next < keys.size(); ++next)
+    {
+        auto buffer = mBufferManager->FindBuffer(keys[next]);
+        if (!buffer || buffer->HasSceneBuffer() || !buffer->HasValidDiskBuffer())
+        {
+            continue;
+        }
+        if (!budget.TryAcquire(buffer->Size()))
+        {
+            break;
+        }
+        budget.RecordResumedPageIn();
+
+        // The disk page is kept, as by an implicit page-in. The frame does not wait for the
+        // asynchronous read; without async threads the page-in runs here.
+        auto pageIn = mBufferManager->SwapToSceneMemoryAsync(buffer, false, HdBufferState::Unknown);
+        if (!pageIn.valid())
+        {
+            const auto start = std::chrono::steady_clock::now();
+            (void)buffer->SwapToSceneMemory(false, HdBufferState::Unknown);
+            budget.Charge(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start));
+        }
+    }
+    budget.RequeuePageIns(std::vector<SdfPath>(keys.begin() + next, keys.end()));
+}
+
+size_t HdPageableDataSourceManager::Prefetch(const SdfPathVector& primPaths)
+{
+    const std::unordered_set<SdfPath, SdfPath::Hash> prefixes(primPaths.begin(), primPaths.end());
+    if (prefixes.empty())
+    {
+        return 0;
+    }
+
+    // One pass over the buffers, each looking for a hinted prim among its prefixes.
+    const auto buffers = mBufferManager->FindBuffers(
+        [&prefixes](const SdfPath& key)
+        {
+            for (SdfPath path = key; !path.IsEmpty(); path = path.GetParentPath())
+            {
+                if (prefixes.count(path) > 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        });
+
+    GetMemoryMonitor()->GetPrefetchHistory().RecordRequested(buffers.size());
+    size_t issued = 0;
+    for (const auto& [key, buffer] : buffers)
+    {
+        issued += PrefetchBuffer(key, buffer, false) ? 1 : 0;
+    }
+    return issued;
+}
+
+size_t HdPageableDataSourceManager::Prefetch(
+    const GfFrustum& frustum, const std::vector<std::pair<SdfPath, GfBBox3d>>& primBounds)
+{
+    SdfPathVector primPaths;
+    for (const auto& [primPath, bounds] : primBounds)
+    {
+        if (frustum.Intersects(bounds))
+        {
+            primPaths.push_back(primPath);
+        }
+    }
+    return Prefetch(primPaths);
+}
+
+size_t HdPageableDataSourceManager::PrefetchTimeSamples(
+    const HdPageableSampledDataSource& source, HdSampledDataSource::Time time, size_t sampleCount)
+{
+    const auto buffers = source.GetSampleBuffers(time, sampleCount);
+
+    GetMemoryMonitor()->GetPrefetchHistory().RecordRequested(buffers.size());
+    size_t issued = 0;
+    for (const auto& buffer : buffers)
+    {
+        issued += PrefetchBuffer(buffer->Key(), buffer, false) ? 1 : 0;
+    }
+    return issued;
+}
+
+bool HdPageableDataSourceManager::PrefetchBuffer(
+    const SdfPath& key, const std::shared_ptr<HdPageableBufferCore>& buffer, bool learned)
+{
+    if (!buffer || buffer->HasSceneBuffer() || !buffer->HasValidDiskBuffer())
+    {
+        return false;
+    }
+
+    HdFrameIOBudget& budget    = GetMemoryMonitor()->GetFrameIOBudget();
+    HdPrefetchHistory& history = GetMemoryMonitor()->GetPrefetchHistory();
+    if (!budget.TryAcquire(buffer->Size()))
+    {
+        history.RecordDropped();
+        return false;
+    }
+    buffer->SetPrefetched(true);
+    history.RecordPrefetch(key, learned);
+
+    // The disk page is kept, as by an implicit page-in.
+    HdPagingTaskOptions options;
+    options.priority = HdPagingPriority::Prefetch;
+    auto pageIn = mBufferManager->SwapToSceneMemoryAsync(
+        buffer, false, HdBufferState::Unknown, options);
+    if (!pageIn.valid())
+    {
+        const auto start = std::chrono::steady_clock::now();
+        (void)buffer->SwapToSceneMemory(false, HdBufferState::Unknown);
+        budget.Charge(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start));
+    }
+    return true;
+}
+
+void HdPageableDataSourceManager::PrefetchNeighbours(const std::vector<SdfPath>& keys)
+{
+    for (const SdfPath& key : keys)
+    {
+        (void)PrefetchBuffer(key, mBufferManager->FindBuffer(key), true);
+    }
 }
 
 size_t HdPageableDataSourceManager::GetResidentBufferCount() const
@@ -1881,12 +2576,22 @@ float HdPageableDataSourceManager::GetMemoryPressure() const
 
 void HdPageableDataSourceManager::BackgroundCleanupLoop()
 {
+    using std::chrono::milliseconds;
+
+    // Delay chosen by the pressure controller, none before its first update.
+    milliseconds controlInterval { 0 };
     while (mBackgroundCleanupEnabled)
     {
+        const bool pressureControl = mPressureControl;
+        const milliseconds slice   = pressureControl
+              ? milliseconds(10)
+              : std::max(milliseconds(mFreeCrawlInterval.load()), milliseconds(1));
+        const milliseconds period  = pressureControl ? controlInterval : slice * 10;
+
         // Sleep with periodic checks for stop request
-        for (int i = 0; i < 10 && mBackgroundCleanupEnabled; ++i)
+        for (milliseconds slept { 0 }; slept < period && mBackgroundCleanupEnabled; slept += slice)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(mFreeCrawlInterval.load()));
+            std::this_thread::sleep_for(std::min(slice, period - slept));
         }
 
         if (!mBackgroundCleanupEnabled)
@@ -1894,15 +2599,54 @@ void HdPageableDataSourceManager::BackgroundCleanupLoop()
             break;
         }
 
-        auto& monitor          = mBufferManager->GetMemoryMonitor();
+        auto& monitor = mBufferManager->GetMemoryMonitor();
+        monitor->RefreshSystemMemory();
+
         float scenePressure    = monitor->GetSceneMemoryPressure();
         float rendererPressure = monitor->GetRendererMemoryPressure();
 
-        if (scenePressure > HdMemoryMonitor::LOW_MEMORY_THRESHOLD ||
+        if (pressureControl)
+        {
+            // Evict the scene memory the controller asks for; the renderer memory is still
+            // crawled above the threshold.
+            const HdPressureControlStep step = mPressureController.Update(
+                monitor->GetUsedSceneMemory(), monitor->GetSceneMemoryLimit());
+            if (step.bytesToEvict > 0)
+            {
+                mPressureController.ReportEvicted(
+                    mBufferManager->FreeSceneMemory(step.bytesToEvict));
+            }
+            controlInterval = step.nextInterval;
+
+            if (rendererPressure > HdMemoryMonitor::LOW_MEMORY_THRESHOLD)
+            {
+                mBufferManager->FreeCrawl(mFreeCrawlPercentage);
+            }
+        }
+        else if (scenePressure > HdMemoryMonitor::LOW_MEMORY_THRESHOLD ||
             rendererPressure > HdMemoryMonitor::LOW_MEMORY_THRESHOLD)
         {
             mBufferManager->FreeCrawl(mFreeCrawlPercentage);
         }
+
+        // Compact the page files in budget sized steps, one step in flight at a time.
+        const size_t compactionBudget = mCompactionBudget;
+        if (compactionBudget > 0 &&
+            (!mCompaction.valid() ||
+                mCompaction.wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+        {
+            mCompaction = mBufferManager->CompactPageFilesAsync(compactionBudget);
+        }
+
+        // Move the cold pages down the storage tiers the same way.
+        const size_t migrationBudget = mMigrationBudget;
+        const bool tiered = mBufferManager->GetPageFileManager()->GetStorageTierCount() > 1;
+        if (migrationBudget > 0 && tiered &&
+            (!mMigration.valid() ||
+                mMigration.wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+        {
+            mMigration = mBufferManager->MigrateColdPagesAsync(migrationBudget, mColdPageAge);
+        }
     }
 }
 
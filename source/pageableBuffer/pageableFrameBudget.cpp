@@ -0,0 +1,147 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableFrameBudget.h>
+
+#include <algorithm>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+
+void HdFrameIOBudget::SetConfig(const HdFrameIOBudgetConfig& config) noexcept
+{
+    mBytesPerFrame        = config.bytesPerFrame;
+    mMicrosecondsPerFrame = config.timePerFrame.count();
+}
+
+HdFrameIOBudgetConfig HdFrameIOBudget::GetConfig() const noexcept
+{
+    HdFrameIOBudgetConfig config;
+    config.bytesPerFrame = mBytesPerFrame;
+    config.timePerFrame  = std::chrono::microseconds(mMicrosecondsPerFrame.load());
+    return config;
+}
+
+void HdFrameIOBudget::BeginFrame() noexcept
+{
+    ++mFrames;
+    mFrameBytes        = 0;
+    mFrameMicroseconds = 0;
+    mFrameOperations   = 0;
+}
+
+bool HdFrameIOBudget::TryAcquire(size_t bytes) noexcept
+{
+    const size_t byteLimit  = mBytesPerFrame.load(std::memory_order_relaxed);
+    const int64_t timeLimit = mMicrosecondsPerFrame.load(std::memory_order_relaxed);
+    if (byteLimit == 0 && timeLimit == 0)
+    {
+        return true;
+    }
+
+    // The first operation of a frame runs whatever its size.
+    if (mFrameOperations.fetch_add(1) == 0)
+    {
+        mFrameBytes += bytes;
+        return true;
+    }
+    if (timeLimit > 0 && mFrameMicroseconds.load() >= timeLimit)
+    {
+        return false;
+    }
+
+    size_t spent = mFrameBytes.load();
+    do
+    {
+        if (byteLimit > 0 && spent + bytes > byteLimit)
+        {
+            return false;
+        }
+    } while (!mFrameBytes.compare_exchange_weak(spent, spent + bytes));
+    return true;
+}
+
+void HdFrameIOBudget::Charge(std::chrono::microseconds elapsed) noexcept
+{
+    mFrameMicroseconds += elapsed.count();
+}
+
+void HdFrameIOBudget::DeferPageIn(const SdfPath& key, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    if (mQueued.insert(key).second)
+    {
+        mQueue.push_back(key);
+        ++mDeferredPageIns;
+        mDeferredPageInBytes += bytes;
+    }
+}
+
+std::vector<SdfPath> HdFrameIOBudget::TakeDeferredPageIns()
+{
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    std::vector<SdfPath> keys;
+    keys.swap(mQueue);
+    mQueued.clear();
+    return keys;
+}
+
+void HdFrameIOBudget::RequeuePageIns(const std::vector<SdfPath>& keys)
+{
+    if (keys.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    std::vector<SdfPath> queue;
+    queue.reserve(keys.size() + mQueue.size());
+    for (const SdfPath& key : keys)
+    {
+        if (mQueued.insert(key).second)
+        {
+            queue.push_back(key);
+        }
+    }
+    queue.insert(queue.end(), std::make_move_iterator(mQueue.begin()),
+        std::make_move_iterator(mQueue.end()));
+    mQueue = std::move(queue);
+}
+
+void HdFrameIOBudget::RecordDeferredPageOut(size_t bytes) noexcept
+{
+    ++mDeferredPageOuts;
+    mDeferredPageOutBytes += bytes;
+}
+
+HdFrameIOStats HdFrameIOBudget::GetStats() const
+{
+    HdFrameIOStats stats;
+    stats.frames               = mFrames;
+    stats.frameBytes           = mFrameBytes;
+    stats.frameMicroseconds    = static_cast<size_t>(std::max<int64_t>(mFrameMicroseconds, 0));
+    stats.deferredPageIns      = mDeferredPageIns;
+    stats.deferredPageInBytes  = mDeferredPageInBytes;
+    stats.deferredPageOuts     = mDeferredPageOuts;
+    stats.deferredPageOutBytes = mDeferredPageOutBytes;
+    stats.resumedPageIns       = mResumedPageIns;
+
+    std::lock_guard<std::mutex> lock(mQueueMutex);
+    stats.pendingPageIns = mQueue.size();
+    return stats;
+}
+
+} // namespace HVT_NS
@@ -16,6 +16,13 @@
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/stringUtils.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <utility>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace HVT_NS
@@ -44,8 +51,261 @@ std::string FormatBytes(size_t bytes)
     }
 }
 
+namespace
+{
+
+bool ReadFirstLine(const std::filesystem::path& path, std::string& line)
+{
+    std::ifstream file(path);
+    return file && std::getline(file, line);
+}
+
+bool ParseBytes(const std::string& text, size_t& value)
+{
+    char* end              = nullptr;
+    const auto parsedValue = std::strtoull(text.c_str(), &end, 10);
+    if (end == text.c_str())
+    {
+        return false;
+    }
+    value = static_cast<size_t>(parsedValue);
+    return true;
+}
+
+// Reads the "some" and "full" avg10 percentages of a PSI file, e.g.
+// "some avg10=1.25 avg60=0.40 avg300=0.10 total=123456".
+bool ReadPressureStall(const std::filesystem::path& path, HdSystemMemoryReading& reading)
+{
+    std::ifstream file(path);
+    std::string kind, average;
+    bool found = false;
+    for (std::string line; std::getline(file, line);)
+    {
+        std::istringstream fields(line);
+        if (!(fields >> kind >> average) || average.rfind("avg10=", 0) != 0)
+        {
+            continue;
+        }
+        const float stall = std::strtof(average.c_str() + 6, nullptr) / 100.0f;
+        if (kind == "some")
+        {
+            reading.stallSome = stall;
+            found             = true;
+        }
+        else if (kind == "full")
+        {
+            reading.stallFull = stall;
+        }
+    }
+    return found;
+}
+
+// The cgroup v2 of the process relative to the cgroup root, from its "0::/path" entry in
+// /proc/self/cgroup. Empty for the root, e.g. in a container with its own cgroup namespace.
+std::filesystem::path FindCgroup(const std::filesystem::path& procRoot)
+{
+    std::ifstream file(procRoot / "self" / "cgroup");
+    for (std::string line; std::getline(file, line);)
+    {
+        if (line.rfind("0::", 0) == 0)
+        {
+            return std::filesystem::path(line.substr(3)).relative_path();
+        }
+    }
+    return {};
+}
+
+} // anonymous namespace
+
+// HdSystemMemoryReading //////////////////////////////////////////////////////
+
+size_t HdSystemMemoryReading::GetHeadroom() const
+{
+    size_t headroom = std::numeric_limits<size_t>::max();
+    if (hasCgroup && cgroupLimit > 0)
+    {
+        headroom = cgroupLimit > cgroupUsage ? cgroupLimit - cgroupUsage : 0;
+    }
+    if (hasMeminfo)
+    {
+        headroom = std::min(headroom, availableMemory);
+    }
+    return headroom;
+}
+
+// HdSystemMemoryProbe ////////////////////////////////////////////////////////
+
+HdSystemMemoryProbe::HdSystemMemoryProbe(
+    std::filesystem::path procRoot, std::filesystem::path cgroupRoot) :
+    mProcRoot(std::move(procRoot)), mCgroupRoot(std::move(cgroupRoot))
+{
+}
+
+HdSystemMemoryReading HdSystemMemoryProbe::Read()
+{
+    HdSystemMemoryReading reading;
+    std::string line;
+
+    // A cgroup is limited by its ancestors too: the level with the least headroom is kept.
+    const std::filesystem::path cgroup = FindCgroup(mProcRoot);
+    size_t cgroupHeadroom              = std::numeric_limits<size_t>::max();
+    for (std::filesystem::path level = cgroup;; level = level.parent_path())
+    {
+        const std::filesystem::path directory = mCgroupRoot / level;
+        size_t limit = 0, usage = 0;
+        if (ReadFirstLine(directory / "memory.max", line))
+        {
+            const bool limited = line != "max" && ParseBytes(line, limit);
+            if (ReadFirstLine(directory / "memory.current", line) && ParseBytes(line, usage))
+            {
+                if (!reading.hasCgroup)
+                {
+                    reading.cgroupUsage = usage;
+                }
+                reading.hasCgroup = true;
+            }
+            if (limited && (limit > usage ? limit - usage : 0) < cgroupHeadroom)
+            {
+                cgroupHeadroom      = limit > usage ? limit - usage : 0;
+                reading.cgroupLimit = limit;
+                reading.cgroupUsage = usage;
+            }
+        }
+        if (level.empty())
+        {
+            break;
+        }
+    }
+
+    std::ifstream meminfo(mProcRoot / "meminfo");
+    for (std::string key; meminfo >> key;)
+    {
+        size_t kiB = 0;
+        meminfo >> kiB;
+        if (key == "MemTotal:")
+        {
+            reading.totalMemory = kiB * ONE_KiB;
+        }
+        else if (key == "MemAvailable:")
+        {
+            reading.availableMemory = kiB * ONE_KiB;
+            reading.hasMeminfo      = true;
+        }
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+
+    // The stalls of the cgroup, or of the whole system.
+    reading.hasPressure = ReadPressureStall(mCgroupRoot / cgroup / "memory.pressure", reading) ||
+        ReadPressureStall(mProcRoot / "pressure" / "memory", reading);
+
+    return reading;
+}
+
+// HdMemoryPool ///////////////////////////////////////////////////////////////
+
+namespace
+{
+
+void ReduceClamped(std::atomic<size_t>& counter, size_t size) noexcept
+{
+    size_t current = counter.load(std::memory_order_relaxed);
+    // Set to zero if trying to subtract more than available
+    while (!counter.compare_exchange_weak(
+        current, (current < size) ? 0 : (current - size), std::memory_order_relaxed));
+}
+
+} // anonymous namespace
+
+HdMemoryPool::HdMemoryPool(std::string name, size_t sceneBudget, HdMemoryPool* parent) :
+    mName(std::move(name)), mParent(parent), mSceneBudget(sceneBudget)
+{
+}
+
+size_t HdMemoryPool::GetDepth() const noexcept
+{
+    size_t depth = 0;
+    for (const HdMemoryPool* pool = mParent; pool; pool = pool->mParent)
+    {
+        ++depth;
+    }
+    return depth;
+}
+
+bool HdMemoryPool::IsWithin(const HdMemoryPool& pool) const noexcept
+{
+    for (const HdMemoryPool* ancestor = this; ancestor; ancestor = ancestor->mParent)
+    {
+        if (ancestor == &pool)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+float HdMemoryPool::GetScenePressure() const noexcept
+{
+    const size_t budget = mSceneBudget;
+    return budget > 0 ? static_cast<float>(mUsedSceneMemory.load()) / static_cast<float>(budget)
+                      : 0.0f;
+}
+
+bool HdMemoryPool::IsOverBudget() const noexcept
+{
+    const size_t budget = mSceneBudget;
+    return budget > 0 && mUsedSceneMemory > budget;
+}
+
+void HdMemoryPool::AddSceneMemory(size_t size) noexcept
+{
+    for (HdMemoryPool* pool = this; pool; pool = pool->mParent)
+    {
+        pool->mUsedSceneMemory.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+void HdMemoryPool::ReduceSceneMemory(size_t size) noexcept
+{
+    for (HdMemoryPool* pool = this; pool; pool = pool->mParent)
+    {
+        ReduceClamped(pool->mUsedSceneMemory, size);
+    }
+}
+
+void HdMemoryPool::AddRendererMemory(size_t size) noexcept
+{
+    for (HdMemoryPool* pool = this; pool; pool = pool->mParent)
+    {
+        pool->mUsedRendererMemory.fetch_add(size, std::memory_order_relaxed);
+    }
+}
+
+void HdMemoryPool::ReduceRendererMemory(size_t size) noexcept
+{
+    for (HdMemoryPool* pool = this; pool; pool = pool->mParent)
+    {
+        ReduceClamped(pool->mUsedRendererMemory, size);
+    }
+}
+
+HdMemoryPoolStats HdMemoryPool::GetStats() const
+{
+    HdMemoryPoolStats stats;
+    stats.name               = mName;
+    stats.parent             = mParent ? mParent->mName : std::string();
+    stats.sceneBudget        = mSceneBudget;
+    stats.usedSceneMemory    = mUsedSceneMemory;
+    stats.usedRendererMemory = mUsedRendererMemory;
+    stats.bufferCount        = mBufferCount;
+    return stats;
+}
+
+// HdMemoryMonitor ////////////////////////////////////////////////////////////
+
 HdMemoryMonitor::HdMemoryMonitor(size_t sceneMemoryLimit, size_t rendererMemoryLimit) :
-    mSceneMemoryLimit(sceneMemoryLimit), mRendererMemoryLimit(rendererMemoryLimit)
+    mConfiguredSceneMemoryLimit(sceneMemoryLimit),
+    mSceneMemoryLimit(sceneMemoryLimit),
+    mRendererMemoryLimit(rendererMemoryLimit)
 {
 }
 
@@ -77,7 +337,9 @@ void HdMemoryMonitor::ReduceRendererMemory(size_t size)
 
 float HdMemoryMonitor::GetSceneMemoryPressure() const
 {
-    return static_cast<float>(mUsedSceneMemory.load()) / static_cast<float>(mSceneMemoryLimit);
+    return std::max(
+        static_cast<float>(mUsedSceneMemory.load()) / static_cast<float>(mSceneMemoryLimit.load()),
+        mSystemMemoryPressure.load());
 }
 
 float HdMemoryMonitor::GetRendererMemoryPressure() const
@@ -86,6 +348,155 @@ float HdMemoryMonitor::GetRendererMemoryPressure() const
         static_cast<float>(mRendererMemoryLimit);
 }
 
+std::vector<HdPageTierStats> HdMemoryMonitor::GetStorageTierStats() const
+{
+    if (!mStorageTierStatsSource)
+    {
+        return {};
+    }
+    return mStorageTierStatsSource();
+}
+
+void HdMemoryMonitor::SetStorageTierStatsSource(StorageTierStatsSource source)
+{
+    mStorageTierStatsSource = std::move(source);
+}
+
+void HdMemoryMonitor::SetSystemMemoryProbe(
+    std::shared_ptr<IHdSystemMemoryProbe> probe, const HdSystemMemoryBudget& budget)
+{
+    mSystemMemoryProbe  = std::move(probe);
+    mSystemMemoryBudget = budget;
+    RefreshSystemMemory(true);
+}
+
+bool HdMemoryMonitor::RefreshSystemMemory(bool force)
+{
+    if (!mSystemMemoryProbe)
+    {
+        return false;
+    }
+
+    // A crawl does not wait for the refresh of another one.
+    std::unique_lock<std::mutex> lock(mSystemMemoryMutex, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        return false;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (!force && mSystemMemoryRead &&
+        now - mLastSystemMemoryRefresh < mSystemMemoryBudget.refreshInterval)
+    {
+        return false;
+    }
+    mSystemMemoryReading     = mSystemMemoryProbe->Read();
+    mLastSystemMemoryRefresh = now;
+    mSystemMemoryRead        = true;
+
+    // The scene may grow into its share of the headroom, the used scene memory is part of the
+    // usage the headroom was measured against.
+    const HdSystemMemoryBudget& budget = mSystemMemoryBudget;
+    size_t limit                       = mConfiguredSceneMemoryLimit;
+    const size_t headroom              = mSystemMemoryReading.GetHeadroom();
+    if (headroom != std::numeric_limits<size_t>::max())
+    {
+        const size_t reserved = budget.reservedMemory;
+        const size_t spare    = headroom > reserved ? headroom - reserved : 0;
+        limit                 = mUsedSceneMemory.load() +
+            static_cast<size_t>(std::clamp(budget.sceneShare, 0.0f, 1.0f) * spare);
+        limit = std::max(limit, budget.minSceneMemoryLimit);
+        if (budget.maxSceneMemoryLimit > 0)
+        {
+            limit = std::min(limit, budget.maxSceneMemoryLimit);
+        }
+        limit = std::max(limit, static_cast<size_t>(1));
+    }
+    mSceneMemoryLimit = limit;
+
+    mSystemMemoryPressure = mSystemMemoryReading.hasPressure && budget.stallSaturation > 0.0f
+        ? std::clamp(mSystemMemoryReading.stallSome / budget.stallSaturation, 0.0f, 1.0f)
+        : 0.0f;
+    return true;
+}
+
+HdSystemMemoryReading HdMemoryMonitor::GetSystemMemoryReading() const
+{
+    std::lock_guard<std::mutex> lock(mSystemMemoryMutex);
+    return mSystemMemoryReading;
+}
+
+HdMemoryPool* HdMemoryMonitor::CreatePool(
+    const std::string& name, size_t sceneBudget, HdMemoryPool* parent)
+{
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    const auto owned = [parent](const std::unique_ptr<HdMemoryPool>& pool)
+    { return pool.get() == parent; };
+    if (parent && std::none_of(mPools.begin(), mPools.end(), owned))
+    {
+        TF_WARN("The parent of the memory pool '%s' belongs to another monitor.\n", name.c_str());
+        return nullptr;
+    }
+    for (const auto& pool : mPools)
+    {
+        if (pool->mName == name)
+        {
+            TF_WARN("The memory pool '%s' already exists.\n", name.c_str());
+            return nullptr;
+        }
+    }
+
+    mPools.push_back(std::unique_ptr<HdMemoryPool>(new HdMemoryPool(name, sceneBudget, parent)));
+    mPoolCount = mPools.size();
+    return mPools.back().get();
+}
+
+HdMemoryPool* HdMemoryMonitor::FindPool(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    for (const auto& pool : mPools)
+    {
+        if (pool->mName == name)
+        {
+            return pool.get();
+        }
+    }
+    return nullptr;
+}
+
+std::vector<HdMemoryPool*> HdMemoryMonitor::GetOverBudgetPools() const
+{
+    std::vector<HdMemoryPool*> pools;
+    if (mPoolCount == 0)
+    {
+        return pools;
+    }
+
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    for (const auto& pool : mPools)
+    {
+        if (pool->IsOverBudget())
+        {
+            pools.push_back(pool.get());
+        }
+    }
+    // The deepest pools first: freeing them also relieves their ancestors.
+    std::stable_sort(pools.begin(), pools.end(),
+        [](const HdMemoryPool* a, const HdMemoryPool* b) { return a->GetDepth() > b->GetDepth(); });
+    return pools;
+}
+
+std::vector<HdMemoryPoolStats> HdMemoryMonitor::GetPoolStats() const
+{
+    std::lock_guard<std::mutex> lock(mPoolMutex);
+    std::vector<HdMemoryPoolStats> stats;
+    stats.reserve(mPools.size());
+    for (const auto& pool : mPools)
+    {
+        stats.push_back(pool->GetStats());
+    }
+    return stats;
+}
+
 void HdMemoryMonitor::PrintMemoryStats() const
 {
     size_t usedScene       = mUsedSceneMemory.load();
@@ -107,12 +518,64 @@ void HdMemoryMonitor::PrintMemoryStats() const
         "  Scene Paging: %.1f%%\n"
         "  Low Memory: %.1f%%\n"
         "=========================\n",
-        FormatBytes(usedScene).c_str(), FormatBytes(mSceneMemoryLimit).c_str(),
+        FormatBytes(usedScene).c_str(), FormatBytes(mSceneMemoryLimit.load()).c_str(),
         scenePressure * 100,
         FormatBytes(usedRenderer).c_str(), FormatBytes(mRendererMemoryLimit).c_str(),
         hardwarePressure * 100,
         RENDERER_PAGING_THRESHOLD * 100, SCENE_PAGING_THRESHOLD * 100, LOW_MEMORY_THRESHOLD * 100);
     // clang-format on
+
+    if (mSystemMemoryProbe)
+    {
+        const HdSystemMemoryReading reading = GetSystemMemoryReading();
+        const size_t headroom               = reading.GetHeadroom();
+        TF_STATUS("System Memory: %s headroom, cgroup %s / %s, %s available, %.1f%% stalled\n",
+            headroom == std::numeric_limits<size_t>::max() ? "unknown"
+                                                           : FormatBytes(headroom).c_str(),
+            FormatBytes(reading.cgroupUsage).c_str(),
+            reading.cgroupLimit == 0 ? "unlimited" : FormatBytes(reading.cgroupLimit).c_str(),
+            FormatBytes(reading.availableMemory).c_str(), reading.stallSome * 100);
+    }
+
+    for (const HdMemoryPoolStats& pool : GetPoolStats())
+    {
+        TF_STATUS("Memory Pool %s%s%s: %s / %s, %s renderer, %zu buffers\n", pool.name.c_str(),
+            pool.parent.empty() ? "" : " in ", pool.parent.c_str(),
+            FormatBytes(pool.usedSceneMemory).c_str(),
+            pool.sceneBudget == 0 ? "unlimited" : FormatBytes(pool.sceneBudget).c_str(),
+            FormatBytes(pool.usedRendererMemory).c_str(), pool.bufferCount);
+    }
+
+    if (mFrameIOBudget.IsEnabled())
+    {
+        const HdFrameIOStats io = mFrameIOBudget.GetStats();
+        TF_STATUS("Frame I/O: %s in %zu us this frame, %zu page-ins (%s) and %zu page-outs (%s) "
+                  "deferred, %zu pending\n",
+            FormatBytes(io.frameBytes).c_str(), io.frameMicroseconds, io.deferredPageIns,
+            FormatBytes(io.deferredPageInBytes).c_str(), io.deferredPageOuts,
+            FormatBytes(io.deferredPageOutBytes).c_str(), io.pendingPageIns);
+    }
+
+    const HdPrefetchStats prefetch = mPrefetchHistory.GetStats();
+    if (prefetch.issued > 0)
+    {
+        TF_STATUS("Prefetch: %zu issued (%zu learned), %zu dropped, %zu hits (%.1f%%), "
+                  "%zu expired, %zu demand page-ins\n",
+            prefetch.issued, prefetch.learned, prefetch.dropped, prefetch.hits,
+            prefetch.HitRate() * 100.0f, prefetch.expired, prefetch.demandPageIns);
+    }
+
+    const std::vector<HdPageTierStats> tiers = GetStorageTierStats();
+    for (size_t tier = 0; tiers.size() > 1 && tier < tiers.size(); ++tier)
+    {
+        const HdPageTierStats& stats = tiers[tier];
+        TF_STATUS("Storage Tier %zu (%s): %s / %s, %zu pages in %zu files, %s spilled in, "
+                  "%s migrated out, %s promoted in\n",
+            tier, stats.directory.string().c_str(), FormatBytes(stats.usedBytes).c_str(),
+            stats.capacity == 0 ? "unlimited" : FormatBytes(stats.capacity).c_str(),
+            stats.pageCount, stats.pageFileCount, FormatBytes(stats.spilledBytes).c_str(),
+            FormatBytes(stats.migratedBytes).c_str(), FormatBytes(stats.promotedBytes).c_str());
+    }
 }
 
 } // namespace HVT_NS
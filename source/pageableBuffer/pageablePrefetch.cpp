@@ -0,0 +1,216 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageablePrefetch.h>
+
+#include <algorithm>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+
+void HdPrefetchHistory::SetConfig(const HdPrefetchConfig& config)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mConfig = config;
+}
+
+HdPrefetchConfig HdPrefetchHistory::GetConfig() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mConfig;
+}
+
+void HdPrefetchHistory::SetNeighbourCallback(NeighbourCallback callback)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mNeighbourCallback = std::move(callback);
+}
+
+void HdPrefetchHistory::RecordDemandPageIn(const SdfPath& key)
+{
+    NeighbourCallback callback;
+    std::vector<SdfPath> neighbours;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ++mStats.demandPageIns;
+
+        // Prefetched, but paged out again or not read yet: neither a hit nor expired.
+        mPending.erase(key);
+
+        if (!mConfig.learnCoAccess)
+        {
+            return;
+        }
+        if (mFramePageIns.size() < MAX_FRAME_PAGE_INS)
+        {
+            mFramePageIns.push_back(key);
+        }
+        if (mNeighbourCallback)
+        {
+            neighbours = FindNeighbours(key);
+            callback   = mNeighbourCallback;
+        }
+    }
+
+    // Outside the lock: the callback pages in, and the page-ins record their accesses.
+    if (!neighbours.empty())
+    {
+        callback(neighbours);
+    }
+}
+
+void HdPrefetchHistory::RecordPrefetch(const SdfPath& key, bool learned)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mPending[key] = mFrame;
+    ++mStats.issued;
+    if (learned)
+    {
+        ++mStats.learned;
+    }
+}
+
+void HdPrefetchHistory::RecordHit(const SdfPath& key)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mPending.erase(key) > 0)
+    {
+        ++mStats.hits;
+    }
+}
+
+void HdPrefetchHistory::RecordRequested(size_t count) noexcept
+{
+    mRequested += count;
+}
+
+void HdPrefetchHistory::RecordDropped() noexcept
+{
+    ++mDropped;
+}
+
+void HdPrefetchHistory::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // A buffer paged in twice in a frame counts once.
+    std::sort(mFramePageIns.begin(), mFramePageIns.end());
+    mFramePageIns.erase(
+        std::unique(mFramePageIns.begin(), mFramePageIns.end()), mFramePageIns.end());
+
+    // The page-ins of the frame are neighbours of each other, and follow the ones of the
+    // previous frame.
+    for (const SdfPath& to : mFramePageIns)
+    {
+        for (const SdfPath& from : mFramePageIns)
+        {
+            if (from != to)
+            {
+                Learn(from, to);
+            }
+        }
+        for (const SdfPath& from : mPreviousPageIns)
+        {
+            if (from != to &&
+                !std::binary_search(mFramePageIns.begin(), mFramePageIns.end(), from))
+            {
+                Learn(from, to);
+            }
+        }
+    }
+    mPreviousPageIns.swap(mFramePageIns);
+    mFramePageIns.clear();
+
+    ++mFrame;
+    for (auto it = mPending.begin(); it != mPending.end();)
+    {
+        if (mFrame - it->second >= mConfig.hitWindow)
+        {
+            it = mPending.erase(it);
+            ++mStats.expired;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+std::vector<SdfPath> HdPrefetchHistory::GetNeighbours(const SdfPath& key) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return FindNeighbours(key);
+}
+
+HdPrefetchStats HdPrefetchHistory::GetStats() const
+{
+    HdPrefetchStats stats;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        stats = mStats;
+    }
+    stats.requested = mRequested;
+    stats.dropped   = mDropped;
+    return stats;
+}
+
+void HdPrefetchHistory::Learn(const SdfPath& from, const SdfPath& to)
+{
+    std::vector<Neighbour>& neighbours = mNeighbours[from];
+    auto it = std::find_if(neighbours.begin(), neighbours.end(),
+        [&to](const Neighbour& neighbour) { return neighbour.key == to; });
+    if (it != neighbours.end())
+    {
+        ++it->count;
+    }
+    else if (neighbours.size() < MAX_NEIGHBOURS)
+    {
+        it = neighbours.insert(neighbours.end(), Neighbour { to, 1 });
+    }
+    else
+    {
+        // The least paged in together makes room.
+        it  = std::prev(neighbours.end());
+        *it = Neighbour { to, 1 };
+    }
+
+    // Keeps the neighbours ordered by count.
+    while (it != neighbours.begin() && std::prev(it)->count < it->count)
+    {
+        std::iter_swap(it, std::prev(it));
+        --it;
+    }
+}
+
+std::vector<SdfPath> HdPrefetchHistory::FindNeighbours(const SdfPath& key) const
+{
+    std::vector<SdfPath> keys;
+    const auto it = mNeighbours.find(key);
+    if (it == mNeighbours.end())
+    {
+        return keys;
+    }
+    for (const Neighbour& neighbour : it->second)
+    {
+        if (neighbour.count >= mConfig.minCoAccess)
+        {
+            keys.push_back(neighbour.key);
+        }
+    }
+    return keys;
+}
+
+} // namespace HVT_NS
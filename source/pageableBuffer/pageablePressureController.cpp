@@ -0,0 +1,125 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageablePressureController.h>
+
+#include <algorithm>
+
+namespace HVT_NS
+{
+
+HdPressureController::HdPressureController(const HdPressureControllerConfig& config) :
+    mConfig(config)
+{
+}
+
+HdPressureControlStep HdPressureController::Update(
+    size_t usedBytes, size_t limitBytes, Clock::time_point now)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto limit     = static_cast<double>(limitBytes);
+    const float pressure = limitBytes > 0 ? static_cast<float>(usedBytes / limit) : 0.0f;
+
+    // The rate measures the load: the pressure the evictions removed is added back.
+    if (mHasSample)
+    {
+        const double seconds = std::chrono::duration<double>(now - mLastUpdate).count();
+        if (seconds > 0.0)
+        {
+            const float evicted =
+                limitBytes > 0 ? static_cast<float>(mEvictedSinceUpdate / limit) : 0.0f;
+            const auto sample =
+                static_cast<float>((pressure + evicted - mState.pressure) / seconds);
+            const float weight = std::clamp(mConfig.rateSmoothing, 0.0f, 1.0f);
+            mState.pressureRate += weight * (sample - mState.pressureRate);
+        }
+    }
+    mLastUpdate         = now;
+    mHasSample          = true;
+    mEvictedSinceUpdate = 0;
+
+    mState.pressure          = pressure;
+    mState.targetPressure    = mConfig.targetPressure;
+    mState.predictedPressure = pressure + mConfig.lookahead * mState.pressureRate;
+    mState.error             = mState.predictedPressure - mConfig.targetPressure;
+    ++mState.updates;
+
+    HdPressureControlStep step;
+    if (limitBytes > 0 && mState.error > mConfig.deadband)
+    {
+        const float evict =
+            std::min(mConfig.proportionalGain * mState.error, mConfig.maxEvictPressure);
+        step.bytesToEvict = std::min(static_cast<size_t>(evict * limit), usedBytes);
+    }
+    mState.lastBytesToEvict = step.bytesToEvict;
+
+    // Right after an eviction, to see its effect; before the growth reaches the deadband;
+    // backing off while the memory is steady or falling.
+    std::chrono::milliseconds interval;
+    if (step.bytesToEvict > 0)
+    {
+        ++mState.evictions;
+        interval = mConfig.minInterval;
+    }
+    else if (mState.pressureRate > 0.0f)
+    {
+        const float headroom = mConfig.targetPressure + mConfig.deadband - pressure;
+        const float reachMs  = std::max(headroom, 0.0f) / mState.pressureRate * 1000.0f;
+        interval             = std::chrono::milliseconds(static_cast<long long>(
+            std::min(reachMs / 2.0f, static_cast<float>(mConfig.maxInterval.count()))));
+    }
+    else
+    {
+        interval = std::max(mState.interval, mConfig.minInterval) * 2;
+    }
+    step.nextInterval = std::clamp(interval, mConfig.minInterval, mConfig.maxInterval);
+    mState.interval   = step.nextInterval;
+
+    return step;
+}
+
+void HdPressureController::ReportEvicted(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEvictedSinceUpdate += bytes;
+    mState.bytesEvicted += bytes;
+}
+
+void HdPressureController::Reset()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mState              = {};
+    mEvictedSinceUpdate = 0;
+    mHasSample          = false;
+}
+
+void HdPressureController::SetConfig(const HdPressureControllerConfig& config)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mConfig = config;
+}
+
+HdPressureControllerConfig HdPressureController::GetConfig() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mConfig;
+}
+
+HdPressureControllerState HdPressureController::GetState() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mState;
+}
+
+} // namespace HVT_NS
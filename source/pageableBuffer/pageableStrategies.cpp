@@ -157,4 +157,453 @@ HdPagingDecision HybridStrategy::operator()(
     return decision;
 }
 
+// Scan-resistant Buffer Selection Strategies /////////////////////////////////
+
+namespace
+{
+
+bool HoldsMemory(const HdPageableBufferCore& buffer)
+{
+    return buffer.HasSceneBuffer() || buffer.HasRendererBuffer();
+}
+
+} // anonymous namespace
+
+ReplacementPolicy::~ReplacementPolicy() = default;
+
+std::vector<std::shared_ptr<HdPageableBufferCore>> ReplacementPolicy::Select(
+    const std::vector<std::shared_ptr<HdPageableBufferCore>>& buffers,
+    const HdSelectionContext& context)
+{
+    struct Observation
+    {
+        BufferId id;
+        Entry* entry;
+        unsigned int references;
+        unsigned int frameStamp;
+        bool holdsMemory;
+    };
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mEpoch;
+    mCapacity = 0;
+
+    std::vector<Observation> observations;
+    observations.reserve(buffers.size());
+    for (const auto& buffer : buffers)
+    {
+        auto [it, inserted] = mEntries.try_emplace(buffer.get());
+        Entry& entry        = it->second;
+        // A new buffer at the address of a destroyed one starts without history.
+        if (!inserted && (entry.handle.owner_before(buffer) || buffer.owner_before(entry.handle)))
+        {
+            Unlink(entry);
+            entry    = Entry {};
+            inserted = true;
+        }
+        if (inserted)
+        {
+            entry.handle = buffer;
+        }
+
+        const unsigned int accessCount = buffer->AccessCount();
+        const bool holdsMemory         = HoldsMemory(*buffer);
+        observations.push_back({ buffer.get(), &entry, accessCount - entry.accessCount,
+            buffer->FrameStamp(), holdsMemory });
+        entry.accessCount = accessCount;
+        entry.epoch       = mEpoch;
+        mCapacity += holdsMemory ? 1 : 0;
+    }
+
+    // Buffers not given anymore were removed from the buffer manager.
+    for (auto it = mEntries.begin(); it != mEntries.end();)
+    {
+        if (it->second.epoch != mEpoch)
+        {
+            Unlink(it->second);
+            it = mEntries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Replay the accesses in frame stamp order, then catch up with the memory released or
+    // reloaded outside of the selections.
+    std::vector<const Observation*> accesses;
+    for (const auto& observation : observations)
+    {
+        if (observation.references > 0)
+        {
+            accesses.push_back(&observation);
+        }
+    }
+    std::stable_sort(accesses.begin(), accesses.end(),
+        [](const auto* a, const auto* b) { return a->frameStamp < b->frameStamp; });
+    for (const auto* access : accesses)
+    {
+        OnAccess(access->id, *access->entry, access->references);
+    }
+
+    for (const auto& observation : observations)
+    {
+        const int list            = observation.entry->list;
+        const bool onResidentList = list != NO_LIST && list < GHOST_LISTS;
+        if (onResidentList && !observation.holdsMemory)
+        {
+            OnReleased(observation.id, *observation.entry);
+        }
+        else if (!onResidentList && observation.holdsMemory)
+        {
+            OnRestored(observation.id, *observation.entry);
+        }
+    }
+
+    std::vector<BufferId> victims;
+    SelectVictims(std::min(context.requestedCount, mCapacity), victims);
+
+    std::vector<std::shared_ptr<HdPageableBufferCore>> selected;
+    selected.reserve(victims.size());
+    for (BufferId id : victims)
+    {
+        if (auto buffer = mEntries.at(id).handle.lock())
+        {
+            selected.push_back(std::move(buffer));
+        }
+    }
+    return selected;
+}
+
+size_t ReplacementPolicy::GetTrackedCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+void ReplacementPolicy::MoveToBack(BufferId id, Entry& entry, int list)
+{
+    if (entry.list == NO_LIST)
+    {
+        entry.position = mLists[list].insert(mLists[list].end(), id);
+    }
+    else
+    {
+        mLists[list].splice(mLists[list].end(), mLists[entry.list], entry.position);
+    }
+    entry.list = list;
+}
+
+void ReplacementPolicy::MoveToFront(BufferId id, Entry& entry, int list)
+{
+    if (entry.list == NO_LIST)
+    {
+        entry.position = mLists[list].insert(mLists[list].begin(), id);
+    }
+    else
+    {
+        mLists[list].splice(mLists[list].begin(), mLists[entry.list], entry.position);
+    }
+    entry.list = list;
+}
+
+void ReplacementPolicy::Unlink(Entry& entry)
+{
+    if (entry.list != NO_LIST)
+    {
+        mLists[entry.list].erase(entry.position);
+        entry.list = NO_LIST;
+    }
+}
+
+// CLOCK-Pro: `weight` is the reference bit, `flag` marks a cold buffer in its test period.
+
+void ClockProPolicy::OnAccess(BufferId id, Entry& entry, unsigned int references)
+{
+    switch (entry.list)
+    {
+    case Cold:
+    case Hot:
+        entry.weight = 1;
+        break;
+    case Test:
+        // Reloaded within its test period: its reuse distance is short enough to be hot.
+        mColdTarget  = std::min(mColdTarget + 1, std::max<size_t>(mCapacity, 2) - 1);
+        entry.weight = 0;
+        MoveToBack(id, entry, Hot);
+        break;
+    default:
+        entry.flag   = true;
+        entry.weight = references > 1 ? 1 : 0;
+        MoveToBack(id, entry, Cold);
+        break;
+    }
+}
+
+void ClockProPolicy::OnReleased(BufferId id, Entry& entry)
+{
+    entry.weight = 0;
+    if (entry.list == Cold && entry.flag)
+    {
+        MoveToBack(id, entry, Test);
+        TrimTest();
+    }
+    else
+    {
+        Unlink(entry);
+    }
+}
+
+void ClockProPolicy::OnRestored(BufferId id, Entry& entry)
+{
+    // A victim kept in memory goes back under the cold hand.
+    const bool victim = entry.list == Test;
+    entry.flag        = true;
+    entry.weight      = 0;
+    if (victim)
+    {
+        MoveToFront(id, entry, Cold);
+    }
+    else
+    {
+        MoveToBack(id, entry, Cold);
+    }
+}
+
+void ClockProPolicy::SelectVictims(size_t count, std::vector<BufferId>& victims)
+{
+    if (mColdTarget == 0)
+    {
+        mColdTarget = std::max<size_t>(1, mCapacity / 10);
+    }
+    const size_t hotTarget = mCapacity > mColdTarget ? mCapacity - mColdTarget : 1;
+
+    // Cold hand
+    while (victims.size() < count)
+    {
+        if (ListSize(Cold) == 0)
+        {
+            if (ListSize(Hot) == 0)
+            {
+                break;
+            }
+            RunHotHand();
+            continue;
+        }
+
+        BufferId id  = Front(Cold);
+        Entry& entry = GetEntry(id);
+        if (entry.weight > 0)
+        {
+            entry.weight = 0;
+            if (entry.flag)
+            {
+                MoveToBack(id, entry, Hot);
+                while (ListSize(Hot) > hotTarget)
+                {
+                    RunHotHand();
+                }
+            }
+            else
+            {
+                entry.flag = true;
+                MoveToBack(id, entry, Cold);
+            }
+        }
+        else
+        {
+            victims.push_back(id);
+            if (entry.flag)
+            {
+                MoveToBack(id, entry, Test);
+                TrimTest();
+            }
+            else
+            {
+                Unlink(entry);
+            }
+        }
+    }
+}
+
+void ClockProPolicy::RunHotHand()
+{
+    // Demotes the first hot buffer not referenced since the previous pass.
+    while (ListSize(Hot) > 0)
+    {
+        BufferId id  = Front(Hot);
+        Entry& entry = GetEntry(id);
+        if (entry.weight > 0)
+        {
+            entry.weight = 0;
+            MoveToBack(id, entry, Hot);
+        }
+        else
+        {
+            entry.flag = false;
+            MoveToBack(id, entry, Cold);
+            return;
+        }
+    }
+}
+
+void ClockProPolicy::TrimTest()
+{
+    while (ListSize(Test) > std::max<size_t>(mCapacity, 1))
+    {
+        Unlink(GetEntry(Front(Test)));
+        // Test period over without a reload: less room for cold buffers.
+        if (mColdTarget > 1)
+        {
+            --mColdTarget;
+        }
+    }
+}
+
+// ARC
+
+void ArcPolicy::OnAccess(BufferId id, Entry& entry, unsigned int references)
+{
+    const double capacity = static_cast<double>(mCapacity);
+    const double sizeB1   = static_cast<double>(ListSize(B1));
+    const double sizeB2   = static_cast<double>(ListSize(B2));
+    switch (entry.list)
+    {
+    case T1:
+    case T2:
+        MoveToBack(id, entry, T2);
+        break;
+    case B1:
+        mTargetT1    = std::min(capacity, mTargetT1 + std::max(sizeB2 / sizeB1, 1.0));
+        mLastHitInB2 = false;
+        MoveToBack(id, entry, T2);
+        break;
+    case B2:
+        mTargetT1    = std::max(0.0, mTargetT1 - std::max(sizeB1 / sizeB2, 1.0));
+        mLastHitInB2 = true;
+        MoveToBack(id, entry, T2);
+        break;
+    default:
+        MoveToBack(id, entry, references > 1 ? T2 : T1);
+        break;
+    }
+}
+
+void ArcPolicy::OnReleased(BufferId id, Entry& entry)
+{
+    MoveToBack(id, entry, entry.list == T1 ? B1 : B2);
+    TrimGhosts();
+}
+
+void ArcPolicy::OnRestored(BufferId id, Entry& entry)
+{
+    if (entry.list == B1 || entry.list == B2)
+    {
+        MoveToFront(id, entry, entry.list == B1 ? T1 : T2);
+    }
+    else
+    {
+        MoveToBack(id, entry, T1);
+    }
+}
+
+void ArcPolicy::SelectVictims(size_t count, std::vector<BufferId>& victims)
+{
+    while (victims.size() < count && ListSize(T1) + ListSize(T2) > 0)
+    {
+        const double sizeT1 = static_cast<double>(ListSize(T1));
+        const bool fromT1   = ListSize(T1) > 0 &&
+            (ListSize(T2) == 0 || sizeT1 > mTargetT1 || (mLastHitInB2 && sizeT1 >= mTargetT1));
+
+        BufferId id = Front(fromT1 ? T1 : T2);
+        victims.push_back(id);
+        MoveToBack(id, GetEntry(id), fromT1 ? B1 : B2);
+    }
+    TrimGhosts();
+}
+
+void ArcPolicy::TrimGhosts()
+{
+    while (ListSize(B1) > 0 && ListSize(T1) + ListSize(B1) > mCapacity)
+    {
+        Unlink(GetEntry(Front(B1)));
+    }
+    while (ListSize(B2) > 0 &&
+        ListSize(T1) + ListSize(T2) + ListSize(B1) + ListSize(B2) > 2 * mCapacity)
+    {
+        Unlink(GetEntry(Front(B2)));
+    }
+}
+
+// 2Q
+
+void TwoQueuePolicy::OnAccess(BufferId id, Entry& entry, unsigned int references)
+{
+    switch (entry.list)
+    {
+    case A1In:
+    case Am:
+    case A1Out:
+        MoveToBack(id, entry, Am);
+        break;
+    default:
+        MoveToBack(id, entry, references > 1 ? Am : A1In);
+        break;
+    }
+}
+
+void TwoQueuePolicy::OnReleased(BufferId id, Entry& entry)
+{
+    if (entry.list == A1In)
+    {
+        MoveToBack(id, entry, A1Out);
+        TrimA1Out();
+    }
+    else
+    {
+        Unlink(entry);
+    }
+}
+
+void TwoQueuePolicy::OnRestored(BufferId id, Entry& entry)
+{
+    if (entry.list == A1Out)
+    {
+        MoveToFront(id, entry, A1In);
+    }
+    else
+    {
+        MoveToBack(id, entry, A1In);
+    }
+}
+
+void TwoQueuePolicy::SelectVictims(size_t count, std::vector<BufferId>& victims)
+{
+    const size_t targetA1In = std::max<size_t>(1, mCapacity / 4);
+    while (victims.size() < count && ListSize(A1In) + ListSize(Am) > 0)
+    {
+        if (ListSize(A1In) > targetA1In || ListSize(Am) == 0)
+        {
+            BufferId id = Front(A1In);
+            victims.push_back(id);
+            MoveToBack(id, GetEntry(id), A1Out);
+        }
+        else
+        {
+            BufferId id = Front(Am);
+            victims.push_back(id);
+            Unlink(GetEntry(id));
+        }
+    }
+    TrimA1Out();
+}
+
+void TwoQueuePolicy::TrimA1Out()
+{
+    while (ListSize(A1Out) > std::max<size_t>(1, mCapacity / 2))
+    {
+        Unlink(GetEntry(Front(A1Out)));
+    }
+}
+
 } // namespace HVT_NS::HdPagingStrategies
\ No newline at end of file
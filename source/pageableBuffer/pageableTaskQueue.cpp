@@ -0,0 +1,82 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableTaskQueue.h>
+
+#include <utility>
+
+namespace HVT_NS
+{
+
+HdPagingCancellationToken::HdPagingCancellationToken() :
+    mCancelled(std::make_shared<std::atomic<bool>>(false))
+{
+}
+
+void HdPagingCancellationToken::Cancel() noexcept
+{
+    mCancelled->store(true);
+}
+
+bool HdPagingCancellationToken::IsCancelled() const noexcept
+{
+    return mCancelled->load();
+}
+
+void HdPagingTaskQueue::Push(HdPagingPriority priority, Step step)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mQueues[static_cast<size_t>(priority)].push_back(std::move(step));
+}
+
+bool HdPagingTaskQueue::RunNext()
+{
+    Step step;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto& queue : mQueues)
+        {
+            if (!queue.empty())
+            {
+                step = std::move(queue.front());
+                queue.pop_front();
+                break;
+            }
+        }
+    }
+    if (!step)
+    {
+        return false;
+    }
+    step();
+    return true;
+}
+
+size_t HdPagingTaskQueue::GetQueuedCount(HdPagingPriority priority) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mQueues[static_cast<size_t>(priority)].size();
+}
+
+size_t HdPagingTaskQueue::GetQueuedCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    size_t count = 0;
+    for (const auto& queue : mQueues)
+    {
+        count += queue.size();
+    }
+    return count;
+}
+
+} // namespace HVT_NS
@@ -0,0 +1,358 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableTrace.h>
+
+#include <hvt/pageableBuffer/pageableBuffer.h>
+
+#include <pxr/base/tf/diagnostic.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+
+namespace
+{
+
+constexpr char TRACE_MAGIC[8]     = { 'H', 'V', 'T', 'T', 'R', 'A', 'C', 'E' };
+constexpr uint8_t TRACE_VERSION   = 1;
+constexpr size_t TRACE_BLOCK_SIZE = 64 * 1024; ///< Buffered bytes written at once
+
+// The event is in the low four bits of the first byte of a record, its flags above.
+constexpr uint8_t EVENT_MASK  = 0x0F;
+constexpr uint8_t FLAGS_SHIFT = 4;
+
+uint8_t GetTraceFlags(const HdPageableBufferCore& buffer) noexcept
+{
+    uint8_t flags = 0;
+    if (buffer.HasSceneBuffer() || buffer.HasRendererBuffer())
+    {
+        flags |= HdPagingTraceRecord::RESIDENT;
+    }
+    if (buffer.Usage() == HdBufferUsage::Dynamic)
+    {
+        flags |= HdPagingTraceRecord::DYNAMIC;
+    }
+    return flags;
+}
+
+} // anonymous namespace
+
+// HdPagingTraceRecorder //////////////////////////////////////////////////////
+
+HdPagingTraceRecorder::~HdPagingTraceRecorder()
+{
+    Stop();
+}
+
+bool HdPagingTraceRecorder::Start(
+    const std::filesystem::path& path, const HdPagingTraceHeader& header)
+{
+    Stop();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!path.empty())
+    {
+        mFile.open(path, std::ios::binary | std::ios::trunc);
+        if (!mFile)
+        {
+            TF_WARN("Fails to create the paging trace '%s'.\n", path.string().c_str());
+            return false;
+        }
+    }
+
+    mBufferIds.clear();
+    mNextBufferId = 0;
+    mStats        = {};
+    mPending.assign(std::begin(TRACE_MAGIC), std::end(TRACE_MAGIC));
+    mPending.push_back(TRACE_VERSION);
+    WriteVarint(header.sceneMemoryLimit);
+    WriteVarint(header.rendererMemoryLimit);
+    WriteVarint(static_cast<uint64_t>(std::max(header.ageLimit, 0)));
+    WriteVarint(header.startFrame);
+
+    mRecording = true;
+    return true;
+}
+
+void HdPagingTraceRecorder::Stop()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mRecording)
+    {
+        return;
+    }
+    mRecording = false;
+
+    Flush();
+    if (mFile.is_open())
+    {
+        mFile.close();
+    }
+    mBufferIds.clear();
+}
+
+void HdPagingTraceRecorder::RecordAccess(const HdPageableBufferCore& buffer) noexcept
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mRecording)
+    {
+        return;
+    }
+    const uint32_t id   = GetBufferId(buffer);
+    const uint8_t flags = GetTraceFlags(buffer);
+    Write(HdPagingTraceEvent::Access, flags);
+    WriteVarint(id);
+
+    ++mStats.accesses;
+    if (flags & HdPagingTraceRecord::RESIDENT)
+    {
+        ++mStats.hits;
+    }
+}
+
+void HdPagingTraceRecorder::RecordPaging(
+    HdPagingTraceEvent event, const HdPageableBufferCore& buffer, size_t bytes) noexcept
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mRecording)
+    {
+        return;
+    }
+    const uint32_t id = GetBufferId(buffer);
+    Write(event, 0);
+    WriteVarint(id);
+    WriteVarint(bytes);
+
+    if (event == HdPagingTraceEvent::PageIn)
+    {
+        ++mStats.pageIns;
+        mStats.bytesPagedIn += bytes;
+    }
+    else
+    {
+        ++mStats.pageOuts;
+        mStats.bytesPagedOut += bytes;
+    }
+}
+
+void HdPagingTraceRecorder::RecordRemove(const HdPageableBufferCore& buffer) noexcept
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    const auto it = mBufferIds.find(&buffer);
+    if (!mRecording || it == mBufferIds.end())
+    {
+        return; // Never seen by this trace.
+    }
+    Write(HdPagingTraceEvent::Remove, 0);
+    WriteVarint(it->second);
+    mBufferIds.erase(it);
+}
+
+void HdPagingTraceRecorder::RecordFrame(unsigned int frame) noexcept
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mRecording)
+    {
+        Write(HdPagingTraceEvent::Frame, 0);
+        WriteVarint(frame);
+    }
+}
+
+void HdPagingTraceRecorder::RecordCrawl(float percentage) noexcept
+{
+    if (!IsRecording())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mRecording)
+    {
+        Write(HdPagingTraceEvent::Crawl, 0);
+        WriteVarint(static_cast<uint64_t>(std::lround(std::max(percentage, 0.0f) * 100.0f)));
+    }
+}
+
+HdPagingTraceStats HdPagingTraceRecorder::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    HdPagingTraceStats stats = mStats;
+    stats.traceBytes += mPending.size();
+    return stats;
+}
+
+uint32_t HdPagingTraceRecorder::GetBufferId(const HdPageableBufferCore& buffer)
+{
+    const auto [it, inserted] = mBufferIds.try_emplace(&buffer, mNextBufferId);
+    if (inserted)
+    {
+        ++mNextBufferId;
+        Write(HdPagingTraceEvent::Create, GetTraceFlags(buffer));
+        WriteVarint(it->second);
+        WriteVarint(buffer.Size());
+    }
+    return it->second;
+}
+
+void HdPagingTraceRecorder::Write(HdPagingTraceEvent event, uint8_t flags)
+{
+    if (mPending.size() >= TRACE_BLOCK_SIZE)
+    {
+        Flush();
+    }
+    mPending.push_back(static_cast<uint8_t>(static_cast<uint8_t>(event) | (flags << FLAGS_SHIFT)));
+    ++mStats.records;
+}
+
+void HdPagingTraceRecorder::WriteVarint(uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        mPending.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    mPending.push_back(static_cast<uint8_t>(value));
+}
+
+void HdPagingTraceRecorder::Flush()
+{
+    if (mFile.is_open() && !mPending.empty())
+    {
+        mFile.write(reinterpret_cast<const char*>(mPending.data()),
+            static_cast<std::streamsize>(mPending.size()));
+    }
+    mStats.traceBytes += mPending.size();
+    mPending.clear();
+}
+
+// HdPagingTraceReader ////////////////////////////////////////////////////////
+
+HdPagingTraceReader::HdPagingTraceReader(const std::filesystem::path& path) :
+    mFile(path, std::ios::binary)
+{
+    char magic[sizeof(TRACE_MAGIC)] = {};
+    char version                    = 0;
+    if (!mFile.read(magic, sizeof(magic)) || std::memcmp(magic, TRACE_MAGIC, sizeof(magic)) != 0 ||
+        !mFile.get(version) || static_cast<uint8_t>(version) != TRACE_VERSION)
+    {
+        TF_WARN("'%s' is not a paging trace.\n", path.string().c_str());
+        return;
+    }
+
+    uint64_t sceneMemoryLimit = 0, rendererMemoryLimit = 0, ageLimit = 0, startFrame = 0;
+    if (!ReadVarint(sceneMemoryLimit) || !ReadVarint(rendererMemoryLimit) ||
+        !ReadVarint(ageLimit) || !ReadVarint(startFrame))
+    {
+        TF_WARN("'%s' is not a paging trace.\n", path.string().c_str());
+        return;
+    }
+    mHeader.sceneMemoryLimit    = static_cast<size_t>(sceneMemoryLimit);
+    mHeader.rendererMemoryLimit = static_cast<size_t>(rendererMemoryLimit);
+    mHeader.ageLimit            = static_cast<int>(ageLimit);
+    mHeader.startFrame          = static_cast<unsigned int>(startFrame);
+    mValid                      = true;
+}
+
+bool HdPagingTraceReader::Next(HdPagingTraceRecord& record)
+{
+    char first = 0;
+    if (!mValid || !mFile.get(first))
+    {
+        return false;
+    }
+
+    const auto byte = static_cast<uint8_t>(first);
+    record          = {};
+    record.event    = static_cast<HdPagingTraceEvent>(byte & EVENT_MASK);
+    record.flags    = static_cast<uint8_t>(byte >> FLAGS_SHIFT);
+
+    uint64_t id = 0;
+    switch (record.event)
+    {
+    case HdPagingTraceEvent::Create:
+    case HdPagingTraceEvent::PageIn:
+    case HdPagingTraceEvent::PageOut:
+        if (!ReadVarint(id) || !ReadVarint(record.value))
+        {
+            return false;
+        }
+        break;
+    case HdPagingTraceEvent::Access:
+    case HdPagingTraceEvent::Remove:
+        if (!ReadVarint(id))
+        {
+            return false;
+        }
+        break;
+    case HdPagingTraceEvent::Frame:
+    case HdPagingTraceEvent::Crawl:
+        if (!ReadVarint(record.value))
+        {
+            return false;
+        }
+        break;
+    default:
+        TF_WARN("Unknown paging trace event %d.\n", static_cast<int>(record.event));
+        mValid = false;
+        return false;
+    }
+    record.buffer = static_cast<uint32_t>(id);
+    return true;
+}
+
+bool HdPagingTraceReader::ReadVarint(uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        char byte = 0;
+        if (!mFile.get(byte))
+        {
+            return false;
+        }
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(byte) & 0x7F) << shift;
+        if (!(static_cast<uint8_t>(byte) & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace HVT_NS
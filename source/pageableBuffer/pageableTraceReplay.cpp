@@ -0,0 +1,190 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableTraceReplay.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+
+// SummarizePagingTrace ///////////////////////////////////////////////////////
+
+HdPagingReplayStats SummarizePagingTrace(const std::filesystem::path& tracePath)
+{
+    HdPagingReplayStats stats;
+    HdPagingTraceReader reader(tracePath);
+    if (!reader.IsValid())
+    {
+        return stats;
+    }
+
+    struct TracedBuffer
+    {
+        size_t size   = 0;
+        bool resident = false;
+    };
+    std::vector<TracedBuffer> buffers;
+    size_t residentBytes = 0;
+
+    HdPagingTraceRecord record;
+    while (reader.Next(record))
+    {
+        if (record.event == HdPagingTraceEvent::Frame)
+        {
+            ++stats.frames;
+            continue;
+        }
+        if (record.event == HdPagingTraceEvent::Crawl)
+        {
+            ++stats.crawls;
+            continue;
+        }
+
+        if (record.buffer >= buffers.size())
+        {
+            buffers.resize(static_cast<size_t>(record.buffer) + 1);
+        }
+        TracedBuffer& buffer = buffers[record.buffer];
+        switch (record.event)
+        {
+        case HdPagingTraceEvent::Create:
+            buffer.size     = static_cast<size_t>(record.value);
+            buffer.resident = (record.flags & HdPagingTraceRecord::RESIDENT) != 0;
+            residentBytes += buffer.resident ? buffer.size : 0;
+            ++stats.buffers;
+            break;
+        case HdPagingTraceEvent::Access:
+            ++stats.accesses;
+            if (record.flags & HdPagingTraceRecord::RESIDENT)
+            {
+                ++stats.hits;
+            }
+            break;
+        case HdPagingTraceEvent::PageIn:
+            ++stats.pageIns;
+            stats.bytesPagedIn += static_cast<size_t>(record.value);
+            if (!buffer.resident)
+            {
+                buffer.resident = true;
+                residentBytes += buffer.size;
+            }
+            break;
+        case HdPagingTraceEvent::PageOut:
+            ++stats.pageOuts;
+            stats.bytesPagedOut += static_cast<size_t>(record.value);
+            if (buffer.resident)
+            {
+                buffer.resident = false;
+                residentBytes -= buffer.size;
+            }
+            break;
+        case HdPagingTraceEvent::Remove:
+            residentBytes -= buffer.resident ? buffer.size : 0;
+            buffer = {};
+            break;
+        default:
+            break;
+        }
+        stats.peakResidentBytes = std::max(stats.peakResidentBytes, residentBytes);
+    }
+
+    return stats;
+}
+
+// HdReplayBuffer /////////////////////////////////////////////////////////////
+
+HdReplayBuffer::HdReplayBuffer(const SdfPath& key, size_t size, HdBufferUsage usage,
+    bool resident, const std::unique_ptr<HdPageFileManager>& pageFileManager,
+    const std::unique_ptr<HdMemoryMonitor>& memoryMonitor) :
+    HdPageableBufferBase<SdfPath>(key, size, usage, pageFileManager, memoryMonitor, nullptr)
+{
+    if (!resident)
+    {
+        // Not traced: the buffer is not in a buffer manager yet.
+        (void)PageToDisk();
+        ReleaseSceneBuffer();
+    }
+}
+
+HdReplayBuffer::~HdReplayBuffer()
+{
+    // The placeholder page is not known to the page file manager.
+    ReleaseDiskPage();
+}
+
+bool HdReplayBuffer::PageToSceneMemory(bool /*force*/)
+{
+    if (HasSceneBuffer())
+    {
+        return true;
+    }
+    if (!HasDiskBuffer() && !HasRendererBuffer())
+    {
+        return false;
+    }
+
+    CreateSceneBuffer();
+    return true;
+}
+
+bool HdReplayBuffer::PageToRendererMemory(bool /*force*/)
+{
+    if (HasRendererBuffer())
+    {
+        return true;
+    }
+    if (!HasDiskBuffer() && !HasSceneBuffer())
+    {
+        return false;
+    }
+
+    CreateRendererBuffer();
+    return true;
+}
+
+bool HdReplayBuffer::PageToDisk(bool /*force*/)
+{
+    if (HasDiskBuffer())
+    {
+        return true;
+    }
+    if (!HasSceneBuffer() && !HasRendererBuffer())
+    {
+        return false;
+    }
+
+    mPageEntry   = std::make_unique<HdBufferPageEntry>(0, mSize, 0);
+    mBufferState = static_cast<HdBufferState>(
+        static_cast<int>(mBufferState) | static_cast<int>(HdBufferState::DiskBuffer));
+    return true;
+}
+
+TfSpan<const std::byte> HdReplayBuffer::PreparePageOut(HdBufferState /*source*/)
+{
+    return {};
+}
+
+const HdBufferPageEntry* HdReplayBuffer::PreparePageIn()
+{
+    return nullptr;
+}
+
+void HdReplayBuffer::ReleaseDiskPage() noexcept
+{
+    mPageEntry.reset();
+    mBufferState = static_cast<HdBufferState>(
+        static_cast<int>(mBufferState) & ~static_cast<int>(HdBufferState::DiskBuffer));
+}
+
+} // namespace HVT_NS
@@ -0,0 +1,574 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <hvt/pageableBuffer/pageableValueTypes.h>
+
+#include <pxr/base/arch/demangle.h>
+#include <pxr/base/gf/dualQuatd.h>
+#include <pxr/base/gf/dualQuatf.h>
+#include <pxr/base/gf/dualQuath.h>
+#include <pxr/base/gf/half.h>
+#include <pxr/base/gf/matrix2d.h>
+#include <pxr/base/gf/matrix2f.h>
+#include <pxr/base/gf/matrix3d.h>
+#include <pxr/base/gf/matrix3f.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/matrix4f.h>
+#include <pxr/base/gf/quatd.h>
+#include <pxr/base/gf/quatf.h>
+#include <pxr/base/gf/quath.h>
+#include <pxr/base/gf/quaternion.h>
+#include <pxr/base/gf/range1d.h>
+#include <pxr/base/gf/range1f.h>
+#include <pxr/base/gf/range2d.h>
+#include <pxr/base/gf/range2f.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/range3f.h>
+#include <pxr/base/gf/rect2i.h>
+#include <pxr/base/gf/vec2d.h>
+#include <pxr/base/gf/vec2f.h>
+#include <pxr/base/gf/vec2h.h>
+#include <pxr/base/gf/vec2i.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec3h.h>
+#include <pxr/base/gf/vec3i.h>
+#include <pxr/base/gf/vec4d.h>
+#include <pxr/base/gf/vec4f.h>
+#include <pxr/base/gf/vec4h.h>
+#include <pxr/base/gf/vec4i.h>
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/dictionary.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace HVT_NS
+{
+////////////////////////////////////////////////////////////////////////////////
+// Built-in value types
+//
+// Payload formats, after the [uint8 tag] of the page:
+// - POD arrays: the array storage (no header, no padding)
+// - POD scalars: the bytes of the value
+// - String, token and path arrays: [size_t count] ([size_t len] [chars])...
+// - String, token and path scalars: [chars]
+// - Dictionaries: [size_t count] ([size_t len] [key] [size_t size] [uint8 tag] [payload])...
+//
+// The scalar of a type uses the tag of its array plus SCALAR_TAG_OFFSET.
+////////////////////////////////////////////////////////////////////////////////
+namespace
+{
+
+// Tags of the built-in arrays. The first ones are the tags of the original serializer: the
+// tags are stored in the pages, append only.
+enum class ValueTag : uint8_t
+{
+    Unknown = 0,
+    FloatArray,
+    DoubleArray,
+    HalfArray,
+    IntArray,
+    UIntArray,
+    Int64Array,
+    UInt64Array,
+    Vec2fArray,
+    Vec2dArray,
+    Vec2iArray,
+    Vec3fArray,
+    Vec3dArray,
+    Vec3iArray,
+    Vec4fArray,
+    Vec4dArray,
+    Vec4iArray,
+    Matrix4fArray,
+    Matrix4dArray,
+    QuatfArray,
+    QuatdArray,
+    StringArray,
+    TokenArray,
+    BoolArray,
+    CharArray,
+    UCharArray,
+    ShortArray,
+    UShortArray,
+    Vec2hArray,
+    Vec3hArray,
+    Vec4hArray,
+    Matrix2fArray,
+    Matrix2dArray,
+    Matrix3fArray,
+    Matrix3dArray,
+    QuathArray,
+    QuaternionArray,
+    DualQuathArray,
+    DualQuatfArray,
+    DualQuatdArray,
+    Range1fArray,
+    Range1dArray,
+    Range2fArray,
+    Range2dArray,
+    Range3fArray,
+    Range3dArray,
+    Rect2iArray,
+    PathArray,
+    Dictionary,
+};
+
+constexpr uint8_t SCALAR_TAG_OFFSET = 64;
+static_assert(static_cast<uint8_t>(ValueTag::Dictionary) < SCALAR_TAG_OFFSET &&
+        static_cast<uint8_t>(ValueTag::Dictionary) + SCALAR_TAG_OFFSET <
+            HdValueTypeRegistry::FIRST_USER_TAG,
+    "The built-in tags must stay below the user tags");
+
+constexpr uint8_t ArrayTag(ValueTag tag)
+{
+    return static_cast<uint8_t>(tag);
+}
+
+constexpr uint8_t ScalarTag(ValueTag tag)
+{
+    return static_cast<uint8_t>(tag) + SCALAR_TAG_OFFSET;
+}
+
+TfSpan<const std::byte> AsBytes(const void* data, size_t size)
+{
+    return TfSpan<const std::byte>(static_cast<const std::byte*>(data), size);
+}
+
+// Reads a size_t at offset, and moves past it. Returns false past the end of the payload.
+bool ReadSize(const uint8_t* payload, size_t size, size_t& offset, size_t& value)
+{
+    if (size - offset < sizeof(size_t))
+    {
+        return false;
+    }
+    std::memcpy(&value, payload + offset, sizeof(size_t));
+    offset += sizeof(size_t);
+    return true;
+}
+
+// Characters of the string-like types.
+const std::string& ToString(const std::string& s)
+{
+    return s;
+}
+
+const std::string& ToString(const TfToken& t)
+{
+    return t.GetString();
+}
+
+const std::string& ToString(const SdfPath& p)
+{
+    return p.GetString();
+}
+
+template <typename T>
+T FromString(std::string s);
+
+template <>
+std::string FromString<std::string>(std::string s)
+{
+    return s;
+}
+
+template <>
+TfToken FromString<TfToken>(std::string s)
+{
+    return TfToken(std::move(s));
+}
+
+template <>
+SdfPath FromString<SdfPath>(std::string s)
+{
+    return SdfPath(s);
+}
+
+// Heap held by a string-like value besides its storage: tokens and paths are interned, short
+// strings are stored in the string object itself.
+size_t GetHeapUsage(const std::string& s)
+{
+    const auto* object = reinterpret_cast<const char*>(&s);
+    const std::less<const char*> before;
+    const bool isInline = !before(s.data(), object) && before(s.data(), object + sizeof(s));
+    return isInline ? 0 : s.capacity() + 1;
+}
+
+size_t GetHeapUsage(const TfToken& /*t*/)
+{
+    return 0;
+}
+
+size_t GetHeapUsage(const SdfPath& /*p*/)
+{
+    return 0;
+}
+
+// Codec of a string, token or path.
+template <typename T>
+struct StringValueCodec
+{
+    static size_t PayloadSize(const VtValue& value)
+    {
+        return ToString(value.UncheckedGet<T>()).size();
+    }
+
+    static bool Write(const VtValue& value, const HdPageSink& sink)
+    {
+        const std::string& s = ToString(value.UncheckedGet<T>());
+        return sink(AsBytes(s.data(), s.size()));
+    }
+
+    static VtValue Read(const uint8_t* payload, size_t size)
+    {
+        return VtValue(FromString<T>(std::string(reinterpret_cast<const char*>(payload), size)));
+    }
+
+    static size_t MemoryUsage(const VtValue& value)
+    {
+        return sizeof(T) + GetHeapUsage(value.UncheckedGet<T>());
+    }
+};
+
+// Codec of an array of strings, tokens or paths.
+template <typename T>
+struct StringArrayCodec
+{
+    static size_t PayloadSize(const VtValue& value)
+    {
+        size_t size = sizeof(size_t);
+        for (const T& element : value.UncheckedGet<VtArray<T>>())
+        {
+            size += sizeof(size_t) + ToString(element).size();
+        }
+        return size;
+    }
+
+    static bool Write(const VtValue& value, const HdPageSink& sink)
+    {
+        const auto& array  = value.UncheckedGet<VtArray<T>>();
+        const size_t count = array.size();
+        if (!sink(AsBytes(&count, sizeof(size_t))))
+        {
+            return false;
+        }
+        for (const T& element : array)
+        {
+            const std::string& s = ToString(element);
+            const size_t len     = s.size();
+            if (!sink(AsBytes(&len, sizeof(size_t))) || !sink(AsBytes(s.data(), len)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Truncated elements are left empty, as by the original serializer.
+    static VtValue Read(const uint8_t* payload, size_t size)
+    {
+        size_t offset = 0;
+        size_t count  = 0;
+        if (!ReadSize(payload, size, offset, count))
+        {
+            return VtValue(VtArray<T>());
+        }
+
+        VtArray<T> array(count);
+        size_t len = 0;
+        for (size_t i = 0; i < count && ReadSize(payload, size, offset, len); ++i)
+        {
+            if (size - offset >= len)
+            {
+                const auto* chars = reinterpret_cast<const char*>(payload + offset);
+                array[i]          = FromString<T>(std::string(chars, len));
+                offset += len;
+            }
+        }
+        return VtValue(std::move(array));
+    }
+
+    static size_t MemoryUsage(const VtValue& value)
+    {
+        const auto& array = value.UncheckedGet<VtArray<T>>();
+        size_t usage      = array.size() * sizeof(T);
+        for (const T& element : array)
+        {
+            usage += GetHeapUsage(element);
+        }
+        return usage;
+    }
+};
+
+// Codec of a VtDictionary, its values of any registered type, nested dictionaries included.
+struct DictionaryCodec
+{
+    // Type and serialized size (tag and payload) of a value. Returns false if the value, or a
+    // value nested in it, is not serializable.
+    static bool GetElementSize(const VtValue& element, const HdValueType*& type, size_t& size)
+    {
+        type = HdValueTypeRegistry::GetInstance().Find(element.GetTypeid());
+        if (!type)
+        {
+            return false;
+        }
+        const size_t payloadSize = type->payloadSize(element);
+        if (payloadSize == 0 && type->payloadSize == &PayloadSize)
+        {
+            return false;
+        }
+        size = sizeof(uint8_t) + payloadSize;
+        return true;
+    }
+
+    static size_t PayloadSize(const VtValue& value)
+    {
+        size_t size = sizeof(size_t);
+        for (const auto& [key, element] : value.UncheckedGet<VtDictionary>())
+        {
+            const HdValueType* type = nullptr;
+            size_t elementSize      = 0;
+            if (!GetElementSize(element, type, elementSize))
+            {
+                return 0;
+            }
+            size += sizeof(size_t) + key.size() + sizeof(size_t) + elementSize;
+        }
+        return size;
+    }
+
+    static bool Write(const VtValue& value, const HdPageSink& sink)
+    {
+        const auto& dictionary = value.UncheckedGet<VtDictionary>();
+        const size_t count     = dictionary.size();
+        if (!sink(AsBytes(&count, sizeof(size_t))))
+        {
+            return false;
+        }
+        for (const auto& [key, element] : dictionary)
+        {
+            const HdValueType* type = nullptr;
+            size_t elementSize      = 0;
+            const size_t len        = key.size();
+            if (!GetElementSize(element, type, elementSize) ||
+                !sink(AsBytes(&len, sizeof(size_t))) || !sink(AsBytes(key.data(), len)) ||
+                !sink(AsBytes(&elementSize, sizeof(size_t))) ||
+                !sink(AsBytes(&type->tag, sizeof(uint8_t))) || !type->write(element, sink))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static VtValue Read(const uint8_t* payload, size_t size)
+    {
+        size_t offset = 0;
+        size_t count  = 0;
+        if (!ReadSize(payload, size, offset, count))
+        {
+            return {};
+        }
+
+        VtDictionary dictionary;
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t len = 0;
+            if (!ReadSize(payload, size, offset, len) || size - offset < len)
+            {
+                return {};
+            }
+            std::string key(reinterpret_cast<const char*>(payload + offset), len);
+            offset += len;
+
+            size_t elementSize = 0;
+            if (!ReadSize(payload, size, offset, elementSize) || size - offset < elementSize ||
+                elementSize < sizeof(uint8_t))
+            {
+                return {};
+            }
+            const HdValueType* type = HdValueTypeRegistry::GetInstance().FindTag(payload[offset]);
+            VtValue element =
+                type ? type->read(payload + offset + sizeof(uint8_t), elementSize - sizeof(uint8_t))
+                     : VtValue();
+            if (element.IsEmpty())
+            {
+                return {};
+            }
+            dictionary[key] = std::move(element);
+            offset += elementSize;
+        }
+        return VtValue(std::move(dictionary));
+    }
+
+    // The map nodes hold their key and a VtValue, which holds the storage of its value.
+    static size_t MemoryUsage(const VtValue& value)
+    {
+        size_t usage = sizeof(VtDictionary);
+        for (const auto& [key, element] : value.UncheckedGet<VtDictionary>())
+        {
+            usage += sizeof(VtDictionary::value_type) + GetHeapUsage(key);
+            const HdValueType* type = HdValueTypeRegistry::GetInstance().Find(element.GetTypeid());
+            if (type)
+            {
+                usage += type->memoryUsage(element);
+            }
+        }
+        return usage;
+    }
+};
+
+} // anonymous namespace
+
+// HdValueTypeRegistry Implementation /////////////////////////////////////////
+
+HdValueTypeRegistry& HdValueTypeRegistry::GetInstance()
+{
+    static HdValueTypeRegistry sInstance;
+    return sInstance;
+}
+
+HdValueTypeRegistry::HdValueTypeRegistry()
+{
+    // Trivially copyable types: their arrays and scalars, shuffled by the size of their scalars.
+    auto addPod = [this](auto* type, ValueTag tag, size_t scalarSize)
+    {
+        using T = std::remove_pointer_t<decltype(type)>;
+        AddBuiltIn(MakeValueType<VtArray<T>, HdPodArrayCodec<T>>(ArrayTag(tag), scalarSize));
+        AddBuiltIn(MakeValueType<T, HdPodValueCodec<T>>(ScalarTag(tag), scalarSize));
+    };
+    addPod(static_cast<float*>(nullptr), ValueTag::FloatArray, sizeof(float));
+    addPod(static_cast<double*>(nullptr), ValueTag::DoubleArray, sizeof(double));
+    addPod(static_cast<GfHalf*>(nullptr), ValueTag::HalfArray, sizeof(GfHalf));
+    addPod(static_cast<int*>(nullptr), ValueTag::IntArray, sizeof(int));
+    addPod(static_cast<unsigned int*>(nullptr), ValueTag::UIntArray, sizeof(unsigned int));
+    addPod(static_cast<int64_t*>(nullptr), ValueTag::Int64Array, sizeof(int64_t));
+    addPod(static_cast<uint64_t*>(nullptr), ValueTag::UInt64Array, sizeof(uint64_t));
+    addPod(static_cast<bool*>(nullptr), ValueTag::BoolArray, 1);
+    addPod(static_cast<char*>(nullptr), ValueTag::CharArray, 1);
+    addPod(static_cast<unsigned char*>(nullptr), ValueTag::UCharArray, 1);
+    addPod(static_cast<short*>(nullptr), ValueTag::ShortArray, sizeof(short));
+    addPod(static_cast<unsigned short*>(nullptr), ValueTag::UShortArray, sizeof(unsigned short));
+
+    addPod(static_cast<GfVec2f*>(nullptr), ValueTag::Vec2fArray, sizeof(float));
+    addPod(static_cast<GfVec2d*>(nullptr), ValueTag::Vec2dArray, sizeof(double));
+    addPod(static_cast<GfVec2i*>(nullptr), ValueTag::Vec2iArray, sizeof(int));
+    addPod(static_cast<GfVec2h*>(nullptr), ValueTag::Vec2hArray, sizeof(GfHalf));
+    addPod(static_cast<GfVec3f*>(nullptr), ValueTag::Vec3fArray, sizeof(float));
+    addPod(static_cast<GfVec3d*>(nullptr), ValueTag::Vec3dArray, sizeof(double));
+    addPod(static_cast<GfVec3i*>(nullptr), ValueTag::Vec3iArray, sizeof(int));
+    addPod(static_cast<GfVec3h*>(nullptr), ValueTag::Vec3hArray, sizeof(GfHalf));
+    addPod(static_cast<GfVec4f*>(nullptr), ValueTag::Vec4fArray, sizeof(float));
+    addPod(static_cast<GfVec4d*>(nullptr), ValueTag::Vec4dArray, sizeof(double));
+    addPod(static_cast<GfVec4i*>(nullptr), ValueTag::Vec4iArray, sizeof(int));
+    addPod(static_cast<GfVec4h*>(nullptr), ValueTag::Vec4hArray, sizeof(GfHalf));
+
+    addPod(static_cast<GfMatrix2f*>(nullptr), ValueTag::Matrix2fArray, sizeof(float));
+    addPod(static_cast<GfMatrix2d*>(nullptr), ValueTag::Matrix2dArray, sizeof(double));
+    addPod(static_cast<GfMatrix3f*>(nullptr), ValueTag::Matrix3fArray, sizeof(float));
+    addPod(static_cast<GfMatrix3d*>(nullptr), ValueTag::Matrix3dArray, sizeof(double));
+    addPod(static_cast<GfMatrix4f*>(nullptr), ValueTag::Matrix4fArray, sizeof(float));
+    addPod(static_cast<GfMatrix4d*>(nullptr), ValueTag::Matrix4dArray, sizeof(double));
+
+    addPod(static_cast<GfQuath*>(nullptr), ValueTag::QuathArray, sizeof(GfHalf));
+    addPod(static_cast<GfQuatf*>(nullptr), ValueTag::QuatfArray, sizeof(float));
+    addPod(static_cast<GfQuatd*>(nullptr), ValueTag::QuatdArray, sizeof(double));
+    addPod(static_cast<GfQuaternion*>(nullptr), ValueTag::QuaternionArray, sizeof(double));
+    addPod(static_cast<GfDualQuath*>(nullptr), ValueTag::DualQuathArray, sizeof(GfHalf));
+    addPod(static_cast<GfDualQuatf*>(nullptr), ValueTag::DualQuatfArray, sizeof(float));
+    addPod(static_cast<GfDualQuatd*>(nullptr), ValueTag::DualQuatdArray, sizeof(double));
+
+    addPod(static_cast<GfRange1f*>(nullptr), ValueTag::Range1fArray, sizeof(float));
+    addPod(static_cast<GfRange1d*>(nullptr), ValueTag::Range1dArray, sizeof(double));
+    addPod(static_cast<GfRange2f*>(nullptr), ValueTag::Range2fArray, sizeof(float));
+    addPod(static_cast<GfRange2d*>(nullptr), ValueTag::Range2dArray, sizeof(double));
+    addPod(static_cast<GfRange3f*>(nullptr), ValueTag::Range3fArray, sizeof(float));
+    addPod(static_cast<GfRange3d*>(nullptr), ValueTag::Range3dArray, sizeof(double));
+    addPod(static_cast<GfRect2i*>(nullptr), ValueTag::Rect2iArray, sizeof(int));
+
+    // String-like types, stored as their characters.
+    auto addString = [this](auto* type, ValueTag tag)
+    {
+        using T = std::remove_pointer_t<decltype(type)>;
+        AddBuiltIn(MakeValueType<VtArray<T>, StringArrayCodec<T>>(ArrayTag(tag)));
+        AddBuiltIn(MakeValueType<T, StringValueCodec<T>>(ScalarTag(tag)));
+    };
+    addString(static_cast<std::string*>(nullptr), ValueTag::StringArray);
+    addString(static_cast<TfToken*>(nullptr), ValueTag::TokenArray);
+    addString(static_cast<SdfPath*>(nullptr), ValueTag::PathArray);
+
+    AddBuiltIn(MakeValueType<VtDictionary, DictionaryCodec>(ArrayTag(ValueTag::Dictionary)));
+}
+
+void HdValueTypeRegistry::AddBuiltIn(const HdValueType& type)
+{
+    mTypes.push_back(type);
+    mBuiltIns.emplace(std::type_index(*type.type), &mTypes.back());
+    mByTag[type.tag].store(&mTypes.back());
+}
+
+const HdValueType* HdValueTypeRegistry::Find(const std::type_index& type) const
+{
+    const auto builtIn = mBuiltIns.find(type);
+    if (builtIn != mBuiltIns.end())
+    {
+        return builtIn->second;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mUserMutex);
+    const auto user = mUserTypes.find(type);
+    return user != mUserTypes.end() ? user->second : nullptr;
+}
+
+const HdValueType* HdValueTypeRegistry::FindTag(uint8_t tag) const noexcept
+{
+    return mByTag[tag].load(std::memory_order_acquire);
+}
+
+bool HdValueTypeRegistry::Register(const HdValueType& type)
+{
+    if (type.tag < FIRST_USER_TAG || !type.type || !type.payloadSize || !type.write ||
+        !type.read || !type.memoryUsage)
+    {
+        TF_WARN("HdValueTypeRegistry: Invalid value type with tag %d", static_cast<int>(type.tag));
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mUserMutex);
+    const std::type_index index(*type.type);
+    if (mByTag[type.tag].load() || mBuiltIns.count(index) > 0 || mUserTypes.count(index) > 0)
+    {
+        TF_WARN("HdValueTypeRegistry: Tag %d or type %s is registered already",
+            static_cast<int>(type.tag), ArchGetDemangled(*type.type).c_str());
+        return false;
+    }
+    mTypes.push_back(type);
+    mUserTypes.emplace(index, &mTypes.back());
+    mByTag[type.tag].store(&mTypes.back(), std::memory_order_release);
+    return true;
+}
+
+size_t HdValueTypeRegistry::GetTypeCount() const
+{
+    std::shared_lock<std::shared_mutex> lock(mUserMutex);
+    return mTypes.size();
+}
+
+} // namespace HVT_NS
@@ -34,12 +34,17 @@ PXR_NAMESPACE_USING_DIRECTIVE
 #include <pxr/imaging/hd/retainedDataSource.h>
 #include <pxr/imaging/hd/tokens.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <random>
 #include <string>
 #include <thread>
 #include <vector>
@@ -130,13 +135,14 @@ static size_t GetHeapAllocatedBytes()
 
 #elif defined(__linux__)
     // mallinfo2 (glibc >= 2.33) uses size_t; mallinfo uses int and overflows >2 GiB.
+    // Allocations above the mmap threshold (128 KiB by default) are counted in hblkhd.
 #if defined(__GLIBC__) && defined(__GLIBC_MINOR__) \
     && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
     struct mallinfo2 mi = mallinfo2();
-    return mi.uordblks;
+    return mi.uordblks + mi.hblkhd;
 #else
     struct mallinfo mi = mallinfo();
-    return static_cast<size_t>(mi.uordblks);
+    return static_cast<size_t>(mi.uordblks) + static_cast<size_t>(mi.hblkhd);
 #endif
 
 #elif defined(_WIN32)
@@ -168,6 +174,46 @@ static size_t GetHeapAllocatedBytes()
 #endif
 }
 
+/// Samples the heap usage on a background thread and keeps its peak, e.g. the transient
+/// allocations of a page-in which are freed before it returns.
+class HeapPeakSampler
+{
+public:
+    HeapPeakSampler() : mPeakBytes(GetHeapAllocatedBytes())
+    {
+        mThread = std::thread(
+            [this]()
+            {
+                while (!mStop.load())
+                {
+                    Sample();
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+            });
+    }
+
+    ~HeapPeakSampler() { Stop(); }
+
+    /// Stops sampling and returns the peak heap usage.
+    size_t Stop()
+    {
+        if (mThread.joinable())
+        {
+            mStop = true;
+            mThread.join();
+            Sample();
+        }
+        return mPeakBytes;
+    }
+
+private:
+    void Sample() { mPeakBytes = std::max(mPeakBytes, GetHeapAllocatedBytes()); }
+
+    size_t mPeakBytes = 0;
+    std::atomic<bool> mStop { false };
+    std::thread mThread;
+};
+
 /// Cross-platform MemoryManager that reports per-benchmark heap and RSS
 /// statistics through Google Benchmark's reporting infrastructure.
 class PagingMemoryManager : public benchmark::MemoryManager
@@ -564,7 +610,7 @@ static void BM_BatchAsyncOperations(benchmark::State& state)
     size_t batchIdx = 0;
     for (auto _ : state)
     {
-        std::vector<std::future<bool>> futures;
+        std::vector<hvt::HdPagingFuture> futures;
         futures.reserve(batchSize);
 
         // Launch batch of async operations
@@ -678,6 +724,64 @@ static void BM_FreeCrawlAsync(benchmark::State& state)
 }
 BENCHMARK(BM_FreeCrawlAsync)->Arg(25)->Arg(50)->Arg(75)->Arg(100);
 
+/// Benchmark: Free crawl cost against the buffer count. The LRU selection walks the access index
+/// and visits only the buffers it selects; LargestFirst sorts all buffers.
+/// Args: selection (0 = LRU, 1 = LargestFirst), buffer count
+static void BM_FreeCrawlScaling(benchmark::State& state)
+{
+    const bool sortingSelection = state.range(0) != 0;
+    const auto bufferCount      = static_cast<size_t>(state.range(1));
+
+    auto runCrawl = [&](auto& bufferManager)
+    {
+        // Buffers without scene memory keep the paging decisions cheap: the crawl cost is the
+        // selection. They are spread over 64 frame stamps.
+        for (size_t i = 0; i < bufferCount; ++i)
+        {
+            auto buffer = bufferManager.CreateBuffer(
+                SdfPath("/FreeCrawlScaling_Buffer" + std::to_string(i)), hvt::ONE_KiB);
+            buffer->ReleaseSceneBuffer();
+            buffer->UpdateFrameStamp(static_cast<unsigned int>(i % 64));
+        }
+        bufferManager.AdvanceFrame(128);
+
+        // Full scene memory, so that every crawl runs.
+        auto& memoryMonitor = bufferManager.GetMemoryMonitor();
+        memoryMonitor->AddSceneMemory(memoryMonitor->GetSceneMemoryLimit());
+
+        for (auto _ : state)
+        {
+            bufferManager.FreeCrawl(0.0f); // Checks kMinimalCheckCount buffers
+        }
+
+        memoryMonitor->ReduceSceneMemory(memoryMonitor->GetSceneMemoryLimit());
+    };
+
+    if (sortingSelection)
+    {
+        using Mgr = hvt::PressureBasedLargestBufferManager;
+        Mgr::InitializeDesc desc;
+        desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_crawl_scaling";
+        Mgr bufferManager(desc);
+        runCrawl(bufferManager);
+    }
+    else
+    {
+        using Mgr = hvt::PressureBasedLRUBufferManager;
+        Mgr::InitializeDesc desc;
+        desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_crawl_scaling";
+        Mgr bufferManager(desc);
+        runCrawl(bufferManager);
+    }
+
+    state.SetLabel(sortingSelection ? "LargestFirst" : "LRU");
+    state.counters["buffers"] = static_cast<double>(bufferCount);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_FreeCrawlScaling)
+    ->ArgsProduct({ { 0, 1 }, { 1 << 10, 1 << 14, 1 << 17, 1 << 20 } })
+    ->Unit(benchmark::kMicrosecond);
+
 // =============================================================================
 // PageableValue Benchmarks
 // =============================================================================
@@ -1889,7 +1993,7 @@ static void BM_AsyncSwapOperations(benchmark::State& state)
     for (auto _ : state)
     {
         // Batch swap to disk
-        std::vector<std::future<bool>> toDiskFuts;
+        std::vector<hvt::HdPagingFuture> toDiskFuts;
         toDiskFuts.reserve(batchSize);
         for (auto& pv : buffers)
         {
@@ -1901,7 +2005,7 @@ static void BM_AsyncSwapOperations(benchmark::State& state)
         }
 
         // Batch swap back to scene
-        std::vector<std::future<bool>> toSceneFuts;
+        std::vector<hvt::HdPagingFuture> toSceneFuts;
         toSceneFuts.reserve(batchSize);
         for (auto& pv : buffers)
         {
@@ -2303,6 +2407,668 @@ BENCHMARK(BM_MassPageOut)
     ->Iterations(1);
 
 
+// =============================================================================
+// Page File Backend Benchmarks
+// =============================================================================
+
+/// Benchmark: raw page-in through the positional I/O backend vs the memory-mapped backend.
+///   Arg(0): 0 = Positional copy, 1 = MemoryMapped copy, 2 = MemoryMapped zero-copy view
+///   Arg(1): page size in KiB
+static void BM_PageFileBackendLoadPage(benchmark::State& state)
+{
+    const int mode        = static_cast<int>(state.range(0));
+    const size_t pageSize = static_cast<size_t>(state.range(1)) * hvt::ONE_KiB;
+    const size_t numPages = 256;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_backend_load";
+    desc.pageFileIOMode    = (mode == 0) ? hvt::HdPageFileIOMode::Positional
+                                         : hvt::HdPageFileIOMode::MemoryMapped;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::byte> payload(pageSize, std::byte { 0x5A });
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages;
+    pages.reserve(numPages);
+    for (size_t i = 0; i < numPages; ++i)
+    {
+        pages.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+    }
+
+    std::vector<std::byte> dest(pageSize);
+    size_t idx = 0;
+    for (auto _ : state)
+    {
+        const auto& page = *pages[idx++ % numPages];
+        if (mode == 2)
+        {
+            // Touch one byte per 4 KiB so the page faults are part of the measurement.
+            auto view          = pageFileManager->LoadPage(page);
+            unsigned int total = 0;
+            for (size_t offset = 0; offset < view.size(); offset += 4 * hvt::ONE_KiB)
+            {
+                total += static_cast<unsigned int>(view[offset]);
+            }
+            benchmark::DoNotOptimize(total);
+        }
+        else
+        {
+            benchmark::DoNotOptimize(pageFileManager->LoadPage(page, dest.data()));
+        }
+    }
+
+    static const char* kLabels[] = { "Positional", "MemoryMapped", "MemoryMappedView" };
+    state.SetLabel(kLabels[mode]);
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(pageSize));
+}
+BENCHMARK(BM_PageFileBackendLoadPage)
+    ->Args({ 0, 64 })
+    ->Args({ 1, 64 })
+    ->Args({ 2, 64 })
+    ->Args({ 0, 1024 })
+    ->Args({ 1, 1024 })
+    ->Args({ 2, 1024 })
+    ->Args({ 0, 16384 })
+    ->Args({ 1, 16384 })
+    ->Args({ 2, 16384 });
+
+/// Benchmark: HdPageableValue page-in (GetValue on a paged-out value) per backend.
+///   Arg(0): 0 = Positional, 1 = MemoryMapped
+///   Arg(1): element count (floats)
+static void BM_PageFileBackendValuePageIn(benchmark::State& state)
+{
+    const bool useMapping     = (state.range(0) == 1);
+    const size_t elementCount = static_cast<size_t>(state.range(1));
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_backend_value";
+    desc.pageFileIOMode =
+        useMapping ? hvt::HdPageFileIOMode::MemoryMapped : hvt::HdPageFileIOMode::Positional;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    VtValue data(GenerateFloats(elementCount));
+    auto pageableValue = std::make_shared<hvt::HdPageableValue>(SdfPath("/Backend/floats"),
+        hvt::HdPageableValue::EstimateMemoryUsage(data), hvt::HdBufferUsage::Static,
+        bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor(),
+        [](const SdfPath&) {}, data, TfToken("float[]"));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        pageableValue->SwapSceneToDisk();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(pageableValue->GetValue());
+    }
+
+    state.SetLabel(useMapping ? "MemoryMapped" : "Positional");
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(elementCount * sizeof(float)));
+}
+BENCHMARK(BM_PageFileBackendValuePageIn)
+    ->Args({ 0, 100000 })
+    ->Args({ 1, 100000 })
+    ->Args({ 0, 1000000 })
+    ->Args({ 1, 1000000 });
+
+
+/// Benchmark: page-in scaling with the number of reader threads. Readers of different pages do
+/// not serialize on the page file manager.
+///   Arg(0): 0 = Positional, 1 = MemoryMapped
+///   Arg(1): reader thread count
+static void BM_ConcurrentPageIn(benchmark::State& state)
+{
+    const bool useMapping    = (state.range(0) == 1);
+    const int threadCount    = static_cast<int>(state.range(1));
+    const size_t pageSize    = 256 * hvt::ONE_KiB;
+    const size_t numPages    = 512;
+    const int loadsPerThread = 256;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_concurrent_pagein";
+    desc.pageFileIOMode =
+        useMapping ? hvt::HdPageFileIOMode::MemoryMapped : hvt::HdPageFileIOMode::Positional;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::byte> payload(pageSize, std::byte { 0x3C });
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages;
+    pages.reserve(numPages);
+    for (size_t i = 0; i < numPages; ++i)
+    {
+        pages.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+    }
+
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        std::atomic<int> successCount { 0 };
+
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back(
+                [&pageFileManager, &pages, &successCount, pageSize, numPages, loadsPerThread, t]()
+                {
+                    std::vector<std::byte> dest(pageSize);
+                    for (int i = 0; i < loadsPerThread; ++i)
+                    {
+                        const auto& page = *pages[(static_cast<size_t>(t) * 97 + i) % numPages];
+                        if (pageFileManager->LoadPage(page, dest.data()))
+                        {
+                            ++successCount;
+                        }
+                    }
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        benchmark::DoNotOptimize(successCount.load());
+    }
+
+    state.SetLabel(useMapping ? "MemoryMapped" : "Positional");
+    state.SetItemsProcessed(
+        static_cast<int64_t>(state.iterations()) * threadCount * loadsPerThread);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * threadCount *
+                            loadsPerThread * static_cast<int64_t>(pageSize));
+}
+BENCHMARK(BM_ConcurrentPageIn)
+    ->ArgsProduct({ { 0, 1 }, { 1, 2, 4, 8, 16 } })
+    ->UseRealTime();
+
+/// Benchmark: page-out burst, one CreatePageEntry per page vs one CreatePageEntries batch.
+///   Arg(0): 0 = per page, 1 = batched
+///   Arg(1): page size in KiB
+static void BM_PageOutBurst(benchmark::State& state)
+{
+    const bool batched    = (state.range(0) == 1);
+    const size_t pageSize = static_cast<size_t>(state.range(1)) * hvt::ONE_KiB;
+    const size_t numPages = 256;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_page_out_burst";
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::vector<std::byte>> payloads(numPages, std::vector<std::byte>(pageSize));
+    std::vector<PXR_NS::TfSpan<const std::byte>> pages;
+    pages.reserve(numPages);
+    for (const auto& payload : payloads)
+    {
+        pages.emplace_back(payload.data(), payload.size());
+    }
+
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pageEntries;
+    for (auto _ : state)
+    {
+        if (batched)
+        {
+            pageEntries = pageFileManager->CreatePageEntries(
+                PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>>(pages.data(), pages.size()));
+        }
+        else
+        {
+            pageEntries.clear();
+            for (const auto& page : pages)
+            {
+                pageEntries.push_back(pageFileManager->CreatePageEntry(page));
+            }
+        }
+
+        state.PauseTiming();
+        for (const auto& pageEntry : pageEntries)
+        {
+            pageFileManager->ReleasePage(*pageEntry);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetLabel(batched ? "Batched" : "PerPage");
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+        static_cast<int64_t>(numPages * pageSize));
+}
+BENCHMARK(BM_PageOutBurst)->ArgsProduct({ { 0, 1 }, { 4, 64, 1024 } });
+
+/// Benchmark: page file free space allocation with a fragmented file (allocate + release).
+///   Arg(0): number of holes
+static void BM_PageFileFreeSpaceChurn(benchmark::State& state)
+{
+    const size_t numHoles = static_cast<size_t>(state.range(0));
+
+    // Holes of varying sizes, separated by live pages so they never merge.
+    hvt::HdPageFileFreeSpace freeSpace;
+    std::ptrdiff_t offset = 0;
+    for (size_t i = 0; i < numHoles; ++i)
+    {
+        const size_t holeSize = (1 + (i * 7919) % 256) * hvt::ONE_KiB;
+        freeSpace.Release(offset, holeSize);
+        offset += static_cast<std::ptrdiff_t>(holeSize + hvt::ONE_KiB);
+    }
+
+    size_t idx = 0;
+    for (auto _ : state)
+    {
+        const size_t size       = (1 + (idx++ * 104729) % 256) * hvt::ONE_KiB;
+        const std::ptrdiff_t at = freeSpace.Allocate(size);
+        benchmark::DoNotOptimize(at);
+        if (at != -1)
+        {
+            freeSpace.Release(at, size);
+        }
+    }
+
+    state.counters["holes"] = static_cast<double>(freeSpace.HoleCount());
+}
+BENCHMARK(BM_PageFileFreeSpaceChurn)->RangeMultiplier(8)->Range(64, 32768);
+
+/// Benchmark: compaction of a sparse page file (one page in four live) with concurrent page-ins.
+/// The budget bounds the bytes moved per call, smaller budgets keep page-in latency lower.
+///   Arg(0): compaction budget per call in KiB
+static void BM_PageFileCompaction(benchmark::State& state)
+{
+    const size_t ioBudget = static_cast<size_t>(state.range(0)) * hvt::ONE_KiB;
+    const size_t pageSize = 16 * hvt::ONE_KiB;
+    const size_t numPages = 4096;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_compaction";
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::byte> payload(pageSize, std::byte { 0x3C });
+    size_t bytesMoved = 0;
+    size_t calls      = 0;
+    double maxLoadUs  = 0.0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages;
+        for (size_t i = 0; i < numPages; ++i)
+        {
+            pages.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+        }
+
+        // Fill the page file up so the next page starts a new one, then thin the pages out.
+        auto reservation = pageFileManager->CreatePageEntry(
+            nullptr, hvt::HdPageFileManager::MAX_PAGE_FILE_SIZE - numPages * pageSize);
+        auto next = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+        pageFileManager->ReleasePage(*reservation);
+        for (size_t i = 0; i < numPages; ++i)
+        {
+            if (i % 4 != 0)
+            {
+                pageFileManager->ReleasePage(*pages[i]);
+            }
+        }
+
+        std::atomic<bool> compacting { true };
+        std::thread reader(
+            [&]()
+            {
+                std::vector<std::byte> dest(pageSize);
+                size_t idx = 0;
+                while (compacting)
+                {
+                    const auto start = std::chrono::high_resolution_clock::now();
+                    pageFileManager->LoadPage(*pages[(idx++ * 4) % numPages], dest.data());
+                    const std::chrono::duration<double, std::micro> elapsed =
+                        std::chrono::high_resolution_clock::now() - start;
+                    maxLoadUs = std::max(maxLoadUs, elapsed.count());
+                }
+            });
+        state.ResumeTiming();
+
+        hvt::HdPageFileCompactionResult result;
+        do
+        {
+            result = pageFileManager->Compact(ioBudget);
+            bytesMoved += result.bytesMoved;
+            ++calls;
+        } while (result.pending);
+
+        state.PauseTiming();
+        compacting = false;
+        reader.join();
+        for (size_t i = 0; i < numPages; i += 4)
+        {
+            pageFileManager->ReleasePage(*pages[i]);
+        }
+        pageFileManager->ReleasePage(*next);
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytesMoved));
+    state.counters["calls"]     = benchmark::Counter(static_cast<double>(calls),
+        benchmark::Counter::kAvgIterations);
+    state.counters["maxLoadUs"] = maxLoadUs;
+}
+BENCHMARK(BM_PageFileCompaction)->Arg(256)->Arg(4096)->Arg(65536)->Unit(benchmark::kMillisecond);
+
+/// Benchmark: page-out of instanced content (e.g. the same bolt mesh in many prims) with and
+/// without page deduplication. The "diskMiB" counter is the page file usage after the page-out.
+///   Arg(0): 0 = deduplication off, 1 = on
+///   Arg(1): distinct page contents among the 1024 pages
+static void BM_PageDeduplication(benchmark::State& state)
+{
+    const bool deduplicate     = state.range(0) == 1;
+    const size_t distinctPages = static_cast<size_t>(state.range(1));
+    const size_t pageSize      = 64 * hvt::ONE_KiB;
+    const size_t numPages      = 1024;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_dedup";
+    desc.pageDeduplication = deduplicate;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::vector<std::byte>> payloads(distinctPages, std::vector<std::byte>(pageSize));
+    for (size_t i = 0; i < distinctPages; ++i)
+    {
+        for (size_t j = 0; j < pageSize; ++j)
+        {
+            payloads[i][j] = static_cast<std::byte>((i * 131 + j * 7) & 0xFF);
+        }
+    }
+
+    size_t diskUsage = 0;
+    double ratio     = 1.0;
+    for (auto _ : state)
+    {
+        std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages;
+        pages.reserve(numPages);
+        for (size_t i = 0; i < numPages; ++i)
+        {
+            const auto& payload = payloads[i % distinctPages];
+            pages.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+        }
+
+        state.PauseTiming();
+        diskUsage = pageFileManager->GetTotalDiskUsage();
+        ratio     = pageFileManager->GetDeduplicationStats().Ratio();
+        for (const auto& page : pages)
+        {
+            pageFileManager->ReleasePage(*page);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * numPages * pageSize));
+    state.counters["diskMiB"] = static_cast<double>(diskUsage) / static_cast<double>(hvt::ONE_MiB);
+    state.counters["ratio"]   = ratio;
+}
+BENCHMARK(BM_PageDeduplication)
+    ->ArgsProduct({ { 0, 1 }, { 1, 16, 1024 } })
+    ->Unit(benchmark::kMillisecond);
+
+/// Benchmark: initial page-out of a reopened model, with a cold and a warm persistent page
+/// cache. Warm sessions find the pages of the previous session and write nothing.
+///   Arg(0): 0 = cold (no index), 1 = warm (pages stored by the previous session)
+static void BM_PersistentPageCacheReopen(benchmark::State& state)
+{
+    const bool warm       = state.range(0) == 1;
+    const size_t pageSize = 64 * hvt::ONE_KiB;
+    const size_t numPages = 1024;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory   = std::filesystem::temp_directory_path() / "hvt_bench_persistent";
+    desc.persistentPageCache = true;
+    std::filesystem::remove_all(desc.pageFileDirectory);
+
+    std::vector<std::byte> payload(pageSize, std::byte { 0x5C });
+    std::vector<hvt::HdPersistentPageKey> keys(numPages);
+    for (size_t i = 0; i < numPages; ++i)
+    {
+        keys[i] = { "/models/plant.usd", "/Plant/Part_" + std::to_string(i), "points", i };
+    }
+
+    // One session (open, page out every buffer, close) per iteration.
+    size_t bytesWritten = 0;
+    for (auto _ : state)
+    {
+        if (!warm)
+        {
+            state.PauseTiming();
+            std::filesystem::remove_all(desc.pageFileDirectory);
+            state.ResumeTiming();
+        }
+
+        hvt::DefaultBufferManager bufferManager(desc);
+        auto& pageFileManager = bufferManager.GetPageFileManager();
+        std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages(numPages);
+        for (size_t i = 0; i < numPages; ++i)
+        {
+            pages[i] = pageFileManager->FindPersistentPage(keys[i]);
+            if (!pages[i])
+            {
+                pages[i] = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+                pageFileManager->StorePersistentPage(keys[i], pages[i]);
+                bytesWritten += pageSize;
+            }
+        }
+        for (const auto& page : pages)
+        {
+            pageFileManager->ReleasePage(*page);
+        }
+    }
+
+    state.counters["writtenMiB"] = benchmark::Counter(
+        static_cast<double>(bytesWritten) / static_cast<double>(hvt::ONE_MiB),
+        benchmark::Counter::kAvgIterations);
+    std::filesystem::remove_all(desc.pageFileDirectory);
+}
+BENCHMARK(BM_PersistentPageCacheReopen)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+/// Benchmark: random page-ins through the page I/O engine, all submitted before the first is
+/// awaited, compared with blocking LoadPage calls.
+///   Arg(0): 0 = blocking LoadPage, 1 = thread pool engine, 2 = native engine (io_uring)
+///   Arg(1): queue depth
+static void BM_PageIOEngine(benchmark::State& state)
+{
+    const int mode          = static_cast<int>(state.range(0));
+    const size_t queueDepth = static_cast<size_t>(state.range(1));
+    const size_t pageSize   = 64 * hvt::ONE_KiB;
+    const size_t numPages   = 1024;
+    const size_t numReads   = 256;
+
+    if (mode == 2 && !hvt::HdPageIOEngine::IsNativeBackendAvailable())
+    {
+        state.SkipWithError("Native page I/O is not available");
+        return;
+    }
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_page_io";
+    desc.pageIO.backend =
+        (mode == 2) ? hvt::HdPageIOBackend::IOUring : hvt::HdPageIOBackend::ThreadPool;
+    desc.pageIO.queueDepth = queueDepth;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::byte> payload(pageSize, std::byte { 0x3C });
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages(numPages);
+    for (auto& page : pages)
+    {
+        page = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> pick(0, numPages - 1);
+    std::vector<std::vector<std::byte>> destinations(numReads, std::vector<std::byte>(pageSize));
+    std::vector<std::future<bool>> reads;
+    reads.reserve(numReads);
+    for (auto _ : state)
+    {
+        if (mode == 0)
+        {
+            for (auto& destination : destinations)
+            {
+                benchmark::DoNotOptimize(
+                    pageFileManager->LoadPage(*pages[pick(rng)], destination.data()));
+            }
+        }
+        else
+        {
+            reads.clear();
+            for (auto& destination : destinations)
+            {
+                reads.push_back(pageFileManager->LoadPageAsync(*pages[pick(rng)], destination));
+            }
+            for (auto& read : reads)
+            {
+                benchmark::DoNotOptimize(read.get());
+            }
+        }
+    }
+
+    for (const auto& page : pages)
+    {
+        pageFileManager->ReleasePage(*page);
+    }
+
+    state.SetLabel(mode == 0 ? "Blocking" : (mode == 1 ? "ThreadPool" : "Native"));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * numReads * pageSize));
+}
+BENCHMARK(BM_PageIOEngine)
+    ->ArgsProduct({ { 0, 1, 2 }, { 1, 4, 16, 64 } })
+    ->Unit(benchmark::kMillisecond);
+
+/// Benchmark: migration of cold pages from a fast storage tier to a slow one, in budget sized
+/// steps, while the pages stay readable. The "calls" counter is the steps per migration.
+///   Arg(0): I/O budget per MigrateColdPages call, in KiB
+static void BM_StorageTierMigration(benchmark::State& state)
+{
+    const size_t ioBudget = static_cast<size_t>(state.range(0)) * hvt::ONE_KiB;
+    const size_t pageSize = 64 * hvt::ONE_KiB;
+    const size_t numPages = 1024;
+
+    const auto root = std::filesystem::temp_directory_path() / "hvt_bench_tiers";
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.storageTiers = { { root / "fast", numPages * pageSize }, { root / "slow", 0 } };
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::byte> payload(pageSize, std::byte { 0x6D });
+    size_t bytesMoved = 0;
+    size_t calls      = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pages(numPages);
+        for (auto& page : pages)
+        {
+            page = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+        }
+        state.ResumeTiming();
+
+        hvt::HdPageFileCompactionResult result;
+        do
+        {
+            result = pageFileManager->MigrateColdPages(ioBudget, std::chrono::milliseconds(0));
+            bytesMoved += result.bytesMoved;
+            ++calls;
+        } while (result.pending);
+
+        state.PauseTiming();
+        for (const auto& page : pages)
+        {
+            pageFileManager->ReleasePage(*page);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(bytesMoved));
+    state.counters["calls"] = benchmark::Counter(static_cast<double>(calls),
+        benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_StorageTierMigration)->Arg(256)->Arg(4096)->Arg(65536)->Unit(benchmark::kMillisecond);
+
+// =============================================================================
+// Page Codec Benchmarks
+// =============================================================================
+
+/// Benchmark: HdPageableValue page-in with and without the shuffle + LZ page codec. The "ratio"
+/// counter is the raw size divided by the size of the page on disk.
+///   Arg(0): 0 = Raw, 1 = ShuffleLZ
+///   Arg(1): 0 = grid points (GfVec3f), 1 = triangle indices (int), 2 = ramp (float)
+///   Arg(2): element count
+static void BM_PageCodecValuePageIn(benchmark::State& state)
+{
+    const auto codec = (state.range(0) == 1) ? hvt::HdPageCodec::ShuffleLZ : hvt::HdPageCodec::Raw;
+    const int dataKind        = static_cast<int>(state.range(1));
+    const size_t elementCount = static_cast<size_t>(state.range(2));
+
+    VtValue data;
+    size_t rawSize = 0;
+    if (dataKind == 0)
+    {
+        VtVec3fArray points(elementCount);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            points[i] = GfVec3f(static_cast<float>(i % 256) * 0.5f,
+                static_cast<float>(i / 256) * 0.5f, std::sin(static_cast<float>(i) * 0.01f));
+        }
+        rawSize = elementCount * sizeof(GfVec3f);
+        data    = VtValue(points);
+    }
+    else if (dataKind == 1)
+    {
+        VtIntArray indices(elementCount);
+        for (size_t i = 0; i < elementCount; ++i)
+        {
+            indices[i] = static_cast<int>(i / 6 + (i % 3));
+        }
+        rawSize = elementCount * sizeof(int);
+        data    = VtValue(indices);
+    }
+    else
+    {
+        rawSize = elementCount * sizeof(float);
+        data    = VtValue(GenerateFloats(elementCount));
+    }
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_page_codec";
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    hvt::HdCompressedValueSerializer serializer(
+        std::make_shared<hvt::HdDefaultValueSerializer>(), codec);
+    auto pageableValue = std::make_shared<hvt::HdPageableValue>(SdfPath("/Codec/data"),
+        hvt::HdPageableValue::EstimateMemoryUsage(data), hvt::HdBufferUsage::Static,
+        bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor(),
+        [](const SdfPath&) {}, data, TfToken("data"), true, &serializer);
+
+    size_t pageSize = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        pageableValue->SwapSceneToDisk();
+        pageSize = bufferManager.GetPageFileManager()->GetFragmentationStats().fileBytes;
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(pageableValue->GetValue());
+    }
+
+    state.SetLabel(codec == hvt::HdPageCodec::Raw ? "Raw" : "ShuffleLZ");
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(rawSize));
+    state.counters["ratio"] =
+        static_cast<double>(rawSize) / static_cast<double>(std::max<size_t>(pageSize, 1));
+}
+BENCHMARK(BM_PageCodecValuePageIn)->ArgsProduct({ { 0, 1 }, { 0, 1, 2 }, { 100000, 1000000 } });
+
+
 // =============================================================================
 // Memory Verification Benchmarks (guarded by ENABLE_MEMORY_TRACKER)
 // =============================================================================
@@ -2498,6 +3264,60 @@ BENCHMARK(BM_PagingLifecycleHeap)
     ->Iterations(5)
     ->Unit(benchmark::kMillisecond);
 
+/// Benchmark: peak heap usage of an HdPageableValue page-in, relative to the payload size. The
+/// default serializer reads the payload straight into the array (PeakPerPayload ~1), the codec
+/// serializer reads the page into a staging buffer first (PeakPerPayload ~2).
+///   Arg(0): 0 = default serializer, 1 = codec serializer with raw pages
+///   Arg(1): payload size in MiB
+static void BM_ValuePageInPeakHeap(benchmark::State& state)
+{
+    const bool staged        = state.range(0) == 1;
+    const size_t payloadSize = static_cast<size_t>(state.range(1)) * hvt::ONE_MiB;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_bench_peak_heap";
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    hvt::HdCompressedValueSerializer serializer(
+        std::make_shared<hvt::HdDefaultValueSerializer>(), hvt::HdPageCodec::Raw);
+    auto pageableValue = std::make_shared<hvt::HdPageableValue>(SdfPath("/PeakHeap/points"),
+        payloadSize, hvt::HdBufferUsage::Static, bufferManager.GetPageFileManager(),
+        bufferManager.GetMemoryMonitor(), [](const SdfPath&) {},
+        VtValue(VtVec3fArray(payloadSize / sizeof(GfVec3f), GfVec3f(1.0f, 2.0f, 3.0f))),
+        TfToken("points"), true, staged ? &serializer : nullptr);
+
+    size_t peakBytes = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        pageableValue->SwapSceneToDisk();
+        const size_t baseline = GetHeapAllocatedBytes();
+        HeapPeakSampler sampler;
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(pageableValue->GetValue());
+
+        state.PauseTiming();
+        const size_t peak = sampler.Stop();
+        peakBytes         = std::max(peakBytes, peak > baseline ? peak - baseline : 0);
+        state.ResumeTiming();
+    }
+
+    state.SetLabel(staged ? "Staged" : "Direct");
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(payloadSize));
+    state.counters["PeakMiB"] = static_cast<double>(peakBytes) / hvt::ONE_MiB;
+    state.counters["PeakPerPayload"] =
+        static_cast<double>(peakBytes) / static_cast<double>(payloadSize);
+
+    pageableValue.reset();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+}
+BENCHMARK(BM_ValuePageInPeakHeap)
+    ->ArgsProduct({ { 0, 1 }, { 16, 64, 200 } })
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
 #endif // ENABLE_MEMORY_TRACKER
 
 // =============================================================================
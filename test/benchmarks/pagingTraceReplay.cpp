@@ -0,0 +1,219 @@
+// Copyright 2026 Autodesk, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// =============================================================================
+// Paging Trace Replay
+// =============================================================================
+//
+// Replays a paging trace, recorded with HdPageableBufferManager::StartTrace or
+// the tracePath of its InitializeDesc, against combinations of paging and
+// buffer selection strategies. No page is read or written: the replay only
+// runs the strategies, so a trace of a long session replays in seconds.
+//
+// Usage:
+//   hvt_trace_replay <trace> [--paging hybrid|age|pressure|conservative|all]
+//       [--selection lru|fifo|oldest|largest|clockpro|arc|2q|all]
+//       [--crawl-percentage P] [--crawl-each-frame] [--age-limit N]
+//       [--scene-limit MiB] [--renderer-limit MiB]
+// =============================================================================
+
+#include <pxr/pxr.h>
+PXR_NAMESPACE_USING_DIRECTIVE
+
+#include <hvt/pageableBuffer/pageableBufferManager.h>
+#include <hvt/pageableBuffer/pageableMemoryMonitor.h>
+#include <hvt/pageableBuffer/pageableStrategies.h>
+#include <hvt/pageableBuffer/pageableTraceReplay.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using ReplayFunction = hvt::HdPagingReplayStats (*)(
+    const std::filesystem::path&, const hvt::HdPagingReplayConfig&);
+
+struct Combination
+{
+    const char* paging;
+    const char* selection;
+    ReplayFunction replay;
+};
+
+template <typename PagingStrategyType, typename BufferSelectionStrategyType>
+hvt::HdPagingReplayStats Replay(
+    const std::filesystem::path& tracePath, const hvt::HdPagingReplayConfig& config)
+{
+    return hvt::ReplayPagingTrace<
+        hvt::HdPageableBufferManager<PagingStrategyType, BufferSelectionStrategyType>>(
+        tracePath, config);
+}
+
+template <typename PagingStrategyType>
+void AddCombinations(std::vector<Combination>& combinations, const char* paging)
+{
+    using namespace hvt::HdPagingStrategies;
+    combinations.push_back({ paging, "lru", &Replay<PagingStrategyType, LRUSelectionStrategy> });
+    combinations.push_back({ paging, "fifo", &Replay<PagingStrategyType, FIFOSelectionStrategy> });
+    combinations.push_back(
+        { paging, "oldest", &Replay<PagingStrategyType, OldestFirstSelectionStrategy> });
+    combinations.push_back(
+        { paging, "largest", &Replay<PagingStrategyType, LargestFirstSelectionStrategy> });
+    combinations.push_back(
+        { paging, "clockpro", &Replay<PagingStrategyType, ClockProSelectionStrategy> });
+    combinations.push_back({ paging, "arc", &Replay<PagingStrategyType, ArcSelectionStrategy> });
+    combinations.push_back(
+        { paging, "2q", &Replay<PagingStrategyType, TwoQueueSelectionStrategy> });
+}
+
+std::vector<Combination> GetCombinations()
+{
+    using namespace hvt::HdPagingStrategies;
+    std::vector<Combination> combinations;
+    AddCombinations<HybridStrategy>(combinations, "hybrid");
+    AddCombinations<AgeBasedStrategy>(combinations, "age");
+    AddCombinations<PressureBasedStrategy>(combinations, "pressure");
+    AddCombinations<ConservativeStrategy>(combinations, "conservative");
+    return combinations;
+}
+
+double ToMiB(size_t bytes)
+{
+    return static_cast<double>(bytes) / static_cast<double>(hvt::ONE_MiB);
+}
+
+void PrintRow(const char* paging, const char* selection, const hvt::HdPagingReplayStats& stats,
+    double milliseconds)
+{
+    std::printf("%-13s %-9s %8.2f%% %10.1f %10.1f %10.1f %8zu %8zu %9.1f\n", paging, selection,
+        stats.HitRate() * 100.0, ToMiB(stats.bytesPagedIn), ToMiB(stats.bytesPagedOut),
+        ToMiB(stats.peakResidentBytes), stats.pageIns, stats.pageOuts, milliseconds);
+}
+
+int PrintUsage(const char* program)
+{
+    std::fprintf(stderr,
+        "Usage: %s <trace> [--paging hybrid|age|pressure|conservative|all]\n"
+        "    [--selection lru|fifo|oldest|largest|clockpro|arc|2q|all]\n"
+        "    [--crawl-percentage P] [--crawl-each-frame] [--age-limit N]\n"
+        "    [--scene-limit MiB] [--renderer-limit MiB]\n",
+        program);
+    return 1;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        return PrintUsage(argv[0]);
+    }
+
+    const std::filesystem::path tracePath = argv[1];
+    std::string paging                    = "all";
+    std::string selection                 = "all";
+    hvt::HdPagingReplayConfig config;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        const char* option  = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(option, "--crawl-each-frame") == 0)
+        {
+            config.crawlEachFrame = true;
+        }
+        else if (std::strcmp(option, "--paging") == 0 && hasValue)
+        {
+            paging = argv[++i];
+        }
+        else if (std::strcmp(option, "--selection") == 0 && hasValue)
+        {
+            selection = argv[++i];
+        }
+        else if (std::strcmp(option, "--crawl-percentage") == 0 && hasValue)
+        {
+            config.freeCrawlPercentage = std::strtof(argv[++i], nullptr);
+        }
+        else if (std::strcmp(option, "--age-limit") == 0 && hasValue)
+        {
+            config.ageLimit = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(option, "--scene-limit") == 0 && hasValue)
+        {
+            config.sceneMemoryLimit =
+                static_cast<size_t>(std::strtod(argv[++i], nullptr) * hvt::ONE_MiB);
+        }
+        else if (std::strcmp(option, "--renderer-limit") == 0 && hasValue)
+        {
+            config.rendererMemoryLimit =
+                static_cast<size_t>(std::strtod(argv[++i], nullptr) * hvt::ONE_MiB);
+        }
+        else
+        {
+            return PrintUsage(argv[0]);
+        }
+    }
+
+    std::vector<Combination> combinations;
+    for (const Combination& combination : GetCombinations())
+    {
+        if ((paging == "all" || paging == combination.paging) &&
+            (selection == "all" || selection == combination.selection))
+        {
+            combinations.push_back(combination);
+        }
+    }
+    if (combinations.empty())
+    {
+        std::fprintf(stderr, "No strategy matches --paging %s --selection %s.\n", paging.c_str(),
+            selection.c_str());
+        return 1;
+    }
+
+    hvt::HdPagingTraceReader reader(tracePath);
+    if (!reader.IsValid())
+    {
+        return 1;
+    }
+    const hvt::HdPagingTraceHeader& header  = reader.GetHeader();
+    const hvt::HdPagingReplayStats recorded = hvt::SummarizePagingTrace(tracePath);
+
+    std::printf("Trace: %s\n", tracePath.string().c_str());
+    std::printf("  %zu buffers, %zu frames, %zu crawls, %zu accesses\n", recorded.buffers,
+        recorded.frames, recorded.crawls, recorded.accesses);
+    std::printf("  Recorded with scene limit %.1f MiB, renderer limit %.1f MiB, age limit %d\n\n",
+        ToMiB(header.sceneMemoryLimit), ToMiB(header.rendererMemoryLimit), header.ageLimit);
+
+    std::printf("%-13s %-9s %9s %10s %10s %10s %8s %8s %9s\n", "Paging", "Selection", "Hit rate",
+        "In (MiB)", "Out (MiB)", "Peak (MiB)", "Ins", "Outs", "Time (ms)");
+    PrintRow("recorded", "-", recorded, 0.0);
+
+    for (const Combination& combination : combinations)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const hvt::HdPagingReplayStats stats = combination.replay(tracePath, config);
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        PrintRow(combination.paging, combination.selection, stats, elapsed.count());
+    }
+
+    return 0;
+}
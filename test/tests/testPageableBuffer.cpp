@@ -20,8 +20,14 @@
 
 // Include USD types for tests
 #include <pxr/pxr.h>
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/frustum.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec2f.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/dictionary.h>
 #include <pxr/imaging/hd/dataSource.h>
 #include <pxr/imaging/hd/retainedDataSource.h>
 #include <pxr/imaging/hd/tokens.h>
@@ -32,20 +38,34 @@
 // Include paging system
 #include <hvt/pageableBuffer/pageableBuffer.h>
 #include <hvt/pageableBuffer/pageableBufferManager.h>
+#include <hvt/pageableBuffer/pageableChunkedArray.h>
 #include <hvt/pageableBuffer/pageableConcepts.h>
 #include <hvt/pageableBuffer/pageableDataSource.h>
 #include <hvt/pageableBuffer/pageableMemoryMonitor.h>
+#include <hvt/pageableBuffer/pageablePrefetch.h>
+#include <hvt/pageableBuffer/pageablePressureController.h>
 #include <hvt/pageableBuffer/pageableRetainedDataSource.h>
 #include <hvt/pageableBuffer/pageableStrategies.h>
+#include <hvt/pageableBuffer/pageableTaskQueue.h>
+#include <hvt/pageableBuffer/pageableTraceReplay.h>
+#include <hvt/pageableBuffer/pageableValueTypes.h>
+#include <hvt/pageableBuffer/pageQuantization.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
+#include <fstream>
+#include <future>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -1662,3 +1682,2549 @@ TEST(TestPageableDataSource, IntegrationDemo)
 
     GTEST_SUCCEED();
 }
+
+/// Test: Page codec round trips, raw fallback for incompressible data, and compressed pages
+/// written through the data source manager.
+TEST(TestPageableDataSource, CompressedPages)
+{
+    // A smooth float ramp compresses, random bytes are stored raw.
+    std::vector<float> ramp(4096);
+    for (size_t i = 0; i < ramp.size(); ++i)
+    {
+        ramp[i] = static_cast<float>(i) * 0.125f;
+    }
+    const auto* rampBytes = reinterpret_cast<const uint8_t*>(ramp.data());
+    const size_t rampSize = ramp.size() * sizeof(float);
+    auto page = hvt::HdPageCodecs::Encode(hvt::HdPageCodec::ShuffleLZ, rampBytes, rampSize, 4);
+    EXPECT_EQ(hvt::HdPageCodecs::GetCodec(page.data(), page.size()), hvt::HdPageCodec::ShuffleLZ);
+    EXPECT_LT(page.size() * 2, rampSize);
+
+    std::vector<uint8_t> scratch;
+    const uint8_t* decoded = nullptr;
+    size_t decodedSize     = 0;
+    ASSERT_TRUE(hvt::HdPageCodecs::Decode(page.data(), page.size(), scratch, decoded, decodedSize));
+    ASSERT_EQ(decodedSize, rampSize);
+    EXPECT_TRUE(std::equal(decoded, decoded + decodedSize, rampBytes));
+
+    std::vector<uint8_t> noise(4096);
+    uint32_t state = 12345;
+    for (auto& byte : noise)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte  = static_cast<uint8_t>(state >> 24);
+    }
+    page = hvt::HdPageCodecs::Encode(hvt::HdPageCodec::ShuffleLZ, noise.data(), noise.size(), 1);
+    EXPECT_EQ(hvt::HdPageCodecs::GetCodec(page.data(), page.size()), hvt::HdPageCodec::Raw);
+    EXPECT_EQ(page.size(), noise.size() + 1);
+    ASSERT_TRUE(hvt::HdPageCodecs::Decode(page.data(), page.size(), scratch, decoded, decodedSize));
+    EXPECT_TRUE(std::equal(decoded, decoded + decodedSize, noise.begin(), noise.end()));
+
+    // Truncated pages are rejected.
+    page = hvt::HdPageCodecs::Encode(hvt::HdPageCodec::ShuffleLZ, rampBytes, rampSize, 4);
+    page.resize(page.size() / 2);
+    EXPECT_FALSE(hvt::HdPageCodecs::Decode(page.data(), page.size(), scratch, decoded, decodedSize));
+
+    // Manager configured with the codec: the page on disk is smaller, the value is unchanged.
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory       = std::filesystem::temp_directory_path() / "hvt_codec_test";
+    config.enableBackgroundCleanup = false;
+    config.pageCodec               = hvt::HdPageCodec::ShuffleLZ;
+    auto manager = std::make_shared<hvt::HdPageableDataSourceManager>(config);
+
+    PXR_NS::VtVec3fArray points(10000);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        points[i] = PXR_NS::GfVec3f(static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f);
+    }
+    auto pageableValue = std::dynamic_pointer_cast<hvt::HdPageableValue>(manager->GetOrCreateBuffer(
+        PXR_NS::SdfPath("/Codec/points"), PXR_NS::VtValue(points), PXR_NS::HdTokens->points));
+    ASSERT_NE(pageableValue, nullptr);
+
+    EXPECT_TRUE(pageableValue->SwapSceneToDisk());
+    const size_t rawSize = points.size() * sizeof(PXR_NS::GfVec3f);
+    EXPECT_LT(manager->GetPageFileManager()->GetFragmentationStats().fileBytes * 2, rawSize);
+
+    auto value = pageableValue->GetValue();
+    ASSERT_TRUE(value.IsHolding<PXR_NS::VtVec3fArray>());
+    EXPECT_EQ(value.UncheckedGet<PXR_NS::VtVec3fArray>(), points);
+
+    GTEST_SUCCEED();
+}
+
+/// Test: With the persistent page cache, a value paged out in one session already has a valid
+/// disk copy in the next one, so its page-out writes nothing.
+TEST(TestPageableDataSource, PersistentPageCache)
+{
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_persistent_ds_test";
+    config.enableBackgroundCleanup = false;
+    config.persistentPageCache     = true;
+    config.stageIdentity           = "/models/engine.usd";
+    std::filesystem::remove_all(config.pageFileDirectory);
+
+    PXR_NS::VtVec3fArray points(10000);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        points[i] = PXR_NS::GfVec3f(static_cast<float>(i), 1.0f, 2.0f);
+    }
+    const PXR_NS::SdfPath path("/Engine/Bolt.points");
+
+    {
+        auto manager       = std::make_shared<hvt::HdPageableDataSourceManager>(config);
+        auto pageableValue = std::dynamic_pointer_cast<hvt::HdPageableValue>(
+            manager->GetOrCreateBuffer(path, PXR_NS::VtValue(points), PXR_NS::HdTokens->points));
+        ASSERT_NE(pageableValue, nullptr);
+        EXPECT_FALSE(pageableValue->HasValidDiskBuffer());
+        EXPECT_TRUE(pageableValue->SwapSceneToDisk());
+        EXPECT_EQ(manager->GetPageFileManager()->GetPersistentPageCount(), 1u);
+        pageableValue.reset();
+    }
+
+    {
+        auto manager       = std::make_shared<hvt::HdPageableDataSourceManager>(config);
+        auto pageableValue = std::dynamic_pointer_cast<hvt::HdPageableValue>(
+            manager->GetOrCreateBuffer(path, PXR_NS::VtValue(points), PXR_NS::HdTokens->points));
+        ASSERT_NE(pageableValue, nullptr);
+        EXPECT_TRUE(pageableValue->HasValidDiskBuffer());
+
+        const size_t diskUsage = manager->GetPageFileManager()->GetTotalDiskUsage();
+        EXPECT_TRUE(pageableValue->SwapSceneToDisk());
+        EXPECT_EQ(manager->GetPageFileManager()->GetTotalDiskUsage(), diskUsage);
+
+        auto value = pageableValue->GetValue();
+        ASSERT_TRUE(value.IsHolding<PXR_NS::VtVec3fArray>());
+        EXPECT_EQ(value.UncheckedGet<PXR_NS::VtVec3fArray>(), points);
+
+        // Other content under another path is not in the cache.
+        PXR_NS::VtVec3fArray otherPoints(points);
+        otherPoints[0] = PXR_NS::GfVec3f(-1.0f);
+        auto otherValue = std::dynamic_pointer_cast<hvt::HdPageableValue>(
+            manager->GetOrCreateBuffer(PXR_NS::SdfPath("/Engine/Nut.points"),
+                PXR_NS::VtValue(otherPoints), PXR_NS::HdTokens->points));
+        ASSERT_NE(otherValue, nullptr);
+        EXPECT_FALSE(otherValue->HasValidDiskBuffer());
+
+        pageableValue.reset();
+        otherValue.reset();
+    }
+
+    std::filesystem::remove_all(config.pageFileDirectory);
+
+    GTEST_SUCCEED();
+}
+
+/// Test: Memory-mapped page file backend round trip and zero-copy page view
+TEST(TestPageableBuffer, MemoryMappedPageFile)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory   = std::filesystem::temp_directory_path() / "hvt_mmap_test";
+    desc.sceneMemoryLimit    = 256 * hvt::ONE_MiB;
+    desc.rendererMemoryLimit = 128 * hvt::ONE_MiB;
+    desc.pageFileIOMode      = hvt::HdPageFileIOMode::MemoryMapped;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    // Raw page entries: the view must point at the written bytes.
+    std::vector<std::byte> payload(64 * hvt::ONE_KiB);
+    for (size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<std::byte>(i % 251);
+    }
+    auto pageEntry = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+    ASSERT_NE(pageEntry, nullptr);
+
+    std::vector<std::byte> readBack(payload.size());
+    EXPECT_TRUE(pageFileManager->LoadPage(*pageEntry, readBack.data()));
+    EXPECT_EQ(readBack, payload);
+
+    auto view = pageFileManager->LoadPage(*pageEntry);
+    if (pageFileManager->GetIOMode() == hvt::HdPageFileIOMode::MemoryMapped)
+    {
+        ASSERT_EQ(view.size(), payload.size());
+        EXPECT_TRUE(std::equal(view.begin(), view.end(), payload.begin()));
+    }
+    else
+    {
+        // Platforms without mapping support fall back to positional I/O.
+        EXPECT_TRUE(view.empty());
+    }
+    pageFileManager->ReleasePage(*pageEntry);
+
+    // HdPageableValue page-out/page-in goes through the mapped view.
+    PXR_NS::VtFloatArray floats(100000);
+    for (size_t i = 0; i < floats.size(); ++i)
+    {
+        floats[i] = static_cast<float>(i) * 0.5f;
+    }
+    PXR_NS::VtValue floatsValue(floats);
+
+    auto pageableValue = std::make_shared<hvt::HdPageableValue>(PXR_NS::SdfPath("/Mmap/floats"),
+        hvt::HdPageableValue::EstimateMemoryUsage(floatsValue), hvt::HdBufferUsage::Static,
+        pageFileManager, bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {},
+        floatsValue, PXR_NS::TfToken("float[]"));
+
+    EXPECT_TRUE(pageableValue->SwapSceneToDisk());
+    EXPECT_FALSE(pageableValue->IsDataResident());
+
+    bool pagedIn = false;
+    auto value   = pageableValue->GetValue(&pagedIn);
+    EXPECT_TRUE(pagedIn);
+    ASSERT_TRUE(value.IsHolding<PXR_NS::VtFloatArray>());
+    EXPECT_EQ(value.UncheckedGet<PXR_NS::VtFloatArray>(), floats);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    pageFileManager->PrintPagerStats();
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: Batched page-outs, both through the page file API and through FreeCrawl.
+TEST(TestPageableBuffer, BatchedPageOut)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory   = std::filesystem::temp_directory_path() / "hvt_batch_test";
+    desc.sceneMemoryLimit    = 2 * hvt::ONE_MiB;
+    desc.rendererMemoryLimit = 2 * hvt::ONE_MiB;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    // Raw batch: one entry per input, laid out back to back.
+    std::vector<std::vector<std::byte>> payloads;
+    for (int i = 0; i < 16; ++i)
+    {
+        payloads.emplace_back(hvt::ONE_KiB + i * 100, static_cast<std::byte>(i));
+    }
+    std::vector<PXR_NS::TfSpan<const std::byte>> pages;
+    for (const auto& payload : payloads)
+    {
+        pages.emplace_back(payload.data(), payload.size());
+    }
+
+    auto pageEntries = pageFileManager->CreatePageEntries(
+        PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>>(pages.data(), pages.size()));
+    ASSERT_EQ(pageEntries.size(), payloads.size());
+    for (size_t i = 0; i < pageEntries.size(); ++i)
+    {
+        ASSERT_NE(pageEntries[i], nullptr);
+        if (i > 0)
+        {
+            EXPECT_EQ(pageEntries[i]->Offset(),
+                pageEntries[i - 1]->Offset() +
+                    static_cast<std::ptrdiff_t>(pageEntries[i - 1]->Size()));
+        }
+
+        std::vector<std::byte> readBack(payloads[i].size());
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[i], readBack.data()));
+        EXPECT_EQ(readBack, payloads[i]);
+    }
+    for (const auto& pageEntry : pageEntries)
+    {
+        pageFileManager->ReleasePage(*pageEntry);
+    }
+
+    // A value changed between prepare and complete drops the written page.
+    PXR_NS::VtValue intsValue(PXR_NS::VtIntArray(1000, 7));
+    auto staleValue = std::make_shared<hvt::HdPageableValue>(PXR_NS::SdfPath("/Batch/stale"),
+        hvt::HdPageableValue::EstimateMemoryUsage(intsValue), hvt::HdBufferUsage::Static,
+        pageFileManager, bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {}, intsValue,
+        PXR_NS::TfToken("int[]"));
+    auto stalePage = staleValue->PreparePageOut(hvt::HdBufferState::SceneBuffer);
+    ASSERT_FALSE(stalePage.empty());
+    staleValue->SetResidentValue(PXR_NS::VtValue(PXR_NS::VtIntArray(1000, 8)));
+    EXPECT_FALSE(staleValue->CompletePageOut(pageFileManager->CreatePageEntry(stalePage)));
+    EXPECT_TRUE(staleValue->IsDataResident());
+    EXPECT_FALSE(staleValue->HasValidDiskBuffer());
+
+    // FreeCrawl writes all old values under pressure with one batch.
+    std::vector<std::shared_ptr<hvt::HdPageableValue>> values;
+    for (int i = 0; i < 8; ++i)
+    {
+        PXR_NS::VtValue floatsValue(PXR_NS::VtFloatArray(100000, static_cast<float>(i)));
+        auto value = std::make_shared<hvt::HdPageableValue>(
+            PXR_NS::SdfPath("/Batch/value" + std::to_string(i)),
+            hvt::HdPageableValue::EstimateMemoryUsage(floatsValue), hvt::HdBufferUsage::Static,
+            pageFileManager, bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {},
+            floatsValue, PXR_NS::TfToken("float[]"));
+        EXPECT_TRUE(bufferManager.AddBuffer(value->Key(), value));
+        values.push_back(value);
+    }
+
+    bufferManager.AdvanceFrame(desc.ageLimit + 5);
+    bufferManager.FreeCrawl(100.0f);
+
+    size_t pagedOut = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (!values[i]->IsDataResident())
+        {
+            ++pagedOut;
+            EXPECT_TRUE(values[i]->HasValidDiskBuffer());
+        }
+        auto value = values[i]->GetValue();
+        ASSERT_TRUE(value.IsHolding<PXR_NS::VtFloatArray>());
+        EXPECT_EQ(value.UncheckedGet<PXR_NS::VtFloatArray>(),
+            PXR_NS::VtFloatArray(100000, static_cast<float>(i)));
+    }
+    EXPECT_GT(pagedOut, 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    pageFileManager->PrintPagerStats();
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: Page file free space allocator (best fit, coalescing) and fragmentation statistics.
+TEST(TestPageableBuffer, PageFileFreeSpace)
+{
+    hvt::HdPageFileFreeSpace freeSpace;
+    EXPECT_EQ(freeSpace.Allocate(16), -1);
+
+    // Holes of 100, 300 and 200 bytes separated by live ranges.
+    freeSpace.Release(0, 100);
+    freeSpace.Release(200, 300);
+    freeSpace.Release(600, 200);
+    EXPECT_EQ(freeSpace.FreeBytes(), 600u);
+    EXPECT_EQ(freeSpace.HoleCount(), 3u);
+    EXPECT_EQ(freeSpace.LargestHole(), 300u);
+
+    // Best fit: the 200 bytes hole, not the first (too small) or the largest one.
+    EXPECT_EQ(freeSpace.Allocate(150), 600);
+    EXPECT_EQ(freeSpace.Allocate(50), 750);
+    EXPECT_EQ(freeSpace.Allocate(400), -1);
+    EXPECT_EQ(freeSpace.HoleCount(), 2u);
+
+    // Releasing the ranges in between merges everything into one hole.
+    freeSpace.Release(100, 100);
+    freeSpace.Release(500, 100);
+    EXPECT_EQ(freeSpace.HoleCount(), 1u);
+    EXPECT_EQ(freeSpace.LargestHole(), 600u);
+    auto hole = freeSpace.Release(600, 200);
+    EXPECT_EQ(hole.offset, 0);
+    EXPECT_EQ(hole.size, 800u);
+    EXPECT_EQ(freeSpace.Allocate(800), 0);
+    EXPECT_EQ(freeSpace.FreeBytes(), 0u);
+
+    // Page file manager: released pages show up as holes, and the tail is given back.
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_free_space_test";
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    std::vector<std::byte> payload(4 * hvt::ONE_KiB, std::byte { 1 });
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pageEntries;
+    for (int i = 0; i < 8; ++i)
+    {
+        pageEntries.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+        ASSERT_NE(pageEntries.back(), nullptr);
+    }
+
+    // Release every other page: four isolated holes, the last page keeps the tail in use.
+    for (size_t i = 0; i < pageEntries.size(); i += 2)
+    {
+        pageFileManager->ReleasePage(*pageEntries[i]);
+    }
+    auto stats = pageFileManager->GetFragmentationStats();
+    EXPECT_EQ(stats.fileBytes, 8 * payload.size());
+    EXPECT_EQ(stats.freeBytes, 4 * payload.size());
+    EXPECT_EQ(stats.holeCount, 4u);
+    EXPECT_EQ(stats.largestHole, payload.size());
+
+    // Releasing page 1 merges holes 0 to 2.
+    pageFileManager->ReleasePage(*pageEntries[1]);
+    stats = pageFileManager->GetFragmentationStats();
+    EXPECT_EQ(stats.holeCount, 3u);
+    EXPECT_EQ(stats.largestHole, 3 * payload.size());
+
+    // A new page reuses a hole instead of growing the file.
+    auto reused = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(pageFileManager->GetFragmentationStats().fileBytes, 8 * payload.size());
+
+    // Releasing everything gives all the space back to the tail.
+    pageFileManager->ReleasePage(*reused);
+    for (size_t i = 3; i < pageEntries.size(); i += 2)
+    {
+        pageFileManager->ReleasePage(*pageEntries[i]);
+    }
+    stats = pageFileManager->GetFragmentationStats();
+    EXPECT_EQ(stats.fileBytes, 0u);
+    EXPECT_EQ(stats.holeCount, 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    pageFileManager->PrintPagerStats();
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: Page file compaction relocates live pages out of sparse files, keeps the page handles
+/// valid and deletes the emptied files.
+TEST(TestPageableBuffer, PageFileCompaction)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_compaction_test";
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    // 64 small pages, each with its own content.
+    const size_t pageSize = 4 * hvt::ONE_KiB;
+    std::vector<std::vector<std::byte>> payloads;
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pageEntries;
+    for (int i = 0; i < 64; ++i)
+    {
+        payloads.emplace_back(pageSize, static_cast<std::byte>(i + 1));
+        pageEntries.push_back(
+            pageFileManager->CreatePageEntry(payloads.back().data(), payloads.back().size()));
+        ASSERT_NE(pageEntries.back(), nullptr);
+    }
+
+    // Reserve the rest of the first page file (no data, nothing written) to start a second one.
+    const size_t used = pageEntries.size() * pageSize;
+    auto reservation =
+        pageFileManager->CreatePageEntry(nullptr, hvt::HdPageFileManager::MAX_PAGE_FILE_SIZE - used);
+    ASSERT_NE(reservation, nullptr);
+    std::vector<std::byte> lastPayload(pageSize, std::byte { 0xEE });
+    auto lastPage = pageFileManager->CreatePageEntry(lastPayload.data(), lastPayload.size());
+    ASSERT_NE(lastPage, nullptr);
+    EXPECT_EQ(pageEntries.front()->PageId(), 0u);
+    EXPECT_EQ(lastPage->PageId(), 1u);
+
+    // Nothing to do while the first file is dense.
+    auto result = pageFileManager->Compact();
+    EXPECT_EQ(result.pagesMoved, 0u);
+
+    // Keep every 8th page: the first file becomes sparse.
+    pageFileManager->ReleasePage(*reservation);
+    std::vector<size_t> livePages;
+    for (size_t i = 0; i < pageEntries.size(); ++i)
+    {
+        if (i % 8 == 0)
+        {
+            livePages.push_back(i);
+        }
+        else
+        {
+            pageFileManager->ReleasePage(*pageEntries[i]);
+        }
+    }
+    const auto firstFile = desc.pageFileDirectory / "page_0.bin";
+    EXPECT_TRUE(std::filesystem::exists(firstFile));
+
+    // A budget of one byte still moves one page per call.
+    result = pageFileManager->Compact(1);
+    EXPECT_EQ(result.pagesMoved, 1u);
+    EXPECT_EQ(result.bytesMoved, pageSize);
+    EXPECT_TRUE(result.pending);
+
+    // The rest fits the default budget. The emptied file is deleted.
+    result = pageFileManager->Compact();
+    EXPECT_EQ(result.pagesMoved, livePages.size() - 1);
+    EXPECT_FALSE(result.pending);
+    EXPECT_GT(result.bytesReleased, 0u);
+    EXPECT_FALSE(std::filesystem::exists(firstFile));
+    EXPECT_EQ(pageFileManager->GetTotalDiskUsage(), (livePages.size() + 1) * pageSize);
+
+    // The old handles read and update the relocated pages.
+    std::vector<std::byte> readBack(pageSize);
+    for (size_t i : livePages)
+    {
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[i], readBack.data()));
+        EXPECT_EQ(readBack, payloads[i]);
+    }
+    std::vector<std::byte> update(pageSize, std::byte { 0x77 });
+    EXPECT_TRUE(pageFileManager->UpdatePage(*pageEntries[livePages[1]], update.data()));
+    EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[livePages[1]], readBack.data()));
+    EXPECT_EQ(readBack, update);
+
+    // Releasing through the old handles frees the relocated pages.
+    for (size_t i : livePages)
+    {
+        pageFileManager->ReleasePage(*pageEntries[i]);
+    }
+    pageFileManager->ReleasePage(*lastPage);
+    EXPECT_EQ(pageFileManager->GetFragmentationStats().fileBytes, 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    pageFileManager->PrintPagerStats();
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: With page deduplication, identical pages share one region on disk. Updates copy the
+/// shared page out first, and the region is released with its last handle.
+TEST(TestPageableBuffer, PageDeduplication)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_dedup_test";
+    desc.pageDeduplication = true;
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+    ASSERT_TRUE(pageFileManager->IsDeduplicationEnabled());
+
+    // Four copies of one payload and one other payload, half of them written in one batch.
+    const size_t pageSize = 16 * hvt::ONE_KiB;
+    std::vector<std::byte> payload(pageSize);
+    for (size_t i = 0; i < pageSize; ++i)
+    {
+        payload[i] = static_cast<std::byte>(i * 7);
+    }
+    std::vector<std::byte> otherPayload(pageSize, std::byte { 0x42 });
+
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pageEntries;
+    pageEntries.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+    pageEntries.push_back(pageFileManager->CreatePageEntry(payload.data(), payload.size()));
+    const std::vector<PXR_NS::TfSpan<const std::byte>> batch = { payload, otherPayload, payload };
+    for (auto& pageEntry : pageFileManager->CreatePageEntries(batch))
+    {
+        pageEntries.push_back(std::move(pageEntry));
+    }
+    for (const auto& pageEntry : pageEntries)
+    {
+        ASSERT_NE(pageEntry, nullptr);
+        EXPECT_TRUE(pageEntry->IsValid());
+    }
+
+    auto stats = pageFileManager->GetDeduplicationStats();
+    EXPECT_EQ(stats.sharedPages, 2u);
+    EXPECT_EQ(stats.handles, 5u);
+    EXPECT_EQ(stats.logicalBytes, 5 * pageSize);
+    EXPECT_EQ(stats.physicalBytes, 2 * pageSize);
+    EXPECT_EQ(stats.duplicateWrites, 3u);
+    EXPECT_DOUBLE_EQ(stats.Ratio(), 2.5);
+    EXPECT_EQ(pageFileManager->GetTotalDiskUsage(), 2 * pageSize);
+
+    // Every handle reads its own content.
+    std::vector<std::byte> readBack(pageSize);
+    for (size_t i = 0; i < pageEntries.size(); ++i)
+    {
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[i], readBack.data()));
+        EXPECT_EQ(readBack, i == 3 ? otherPayload : payload);
+    }
+
+    // Updating a shared page leaves the other handles untouched.
+    std::vector<std::byte> update(pageSize, std::byte { 0x77 });
+    EXPECT_TRUE(pageFileManager->UpdatePage(*pageEntries[0], update.data()));
+    EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[0], readBack.data()));
+    EXPECT_EQ(readBack, update);
+    EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[1], readBack.data()));
+    EXPECT_EQ(readBack, payload);
+    EXPECT_EQ(pageFileManager->GetDeduplicationStats().physicalBytes, 3 * pageSize);
+
+    // Releasing the other copies keeps the region until the last one is gone.
+    pageFileManager->ReleasePage(*pageEntries[1]);
+    pageFileManager->ReleasePage(*pageEntries[2]);
+    EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[4], readBack.data()));
+    EXPECT_EQ(readBack, payload);
+    pageFileManager->ReleasePage(*pageEntries[4]);
+
+    stats = pageFileManager->GetDeduplicationStats();
+    EXPECT_EQ(stats.sharedPages, 2u);
+    EXPECT_EQ(stats.handles, 2u);
+    EXPECT_EQ(pageFileManager->GetFragmentationStats().freeBytes, pageSize);
+
+    pageFileManager->ReleasePage(*pageEntries[0]);
+    pageFileManager->ReleasePage(*pageEntries[3]);
+    EXPECT_EQ(pageFileManager->GetDeduplicationStats().sharedPages, 0u);
+    EXPECT_EQ(pageFileManager->GetFragmentationStats().fileBytes, 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    pageFileManager->PrintPagerStats();
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: Persistent page files and index survive the page file manager, and the next manager on
+/// the same directory finds the stored pages again.
+TEST(TestPageableBuffer, PersistentPageCache)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory   = std::filesystem::temp_directory_path() / "hvt_persistent_test";
+    desc.persistentPageCache = true;
+    std::filesystem::remove_all(desc.pageFileDirectory);
+
+    std::vector<std::byte> payload(8 * hvt::ONE_KiB);
+    for (size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = static_cast<std::byte>(i * 13);
+    }
+    std::vector<std::byte> otherPayload(4 * hvt::ONE_KiB, std::byte { 0x5A });
+    const hvt::HdPersistentPageKey key { "/models/engine.usd", "/Engine/Bolt", "points", 42 };
+
+    // Session 1: the page is stored, its handle may go away.
+    {
+        hvt::DefaultBufferManager bufferManager(desc);
+        auto& pageFileManager = bufferManager.GetPageFileManager();
+        ASSERT_TRUE(pageFileManager->IsPersistent());
+        EXPECT_EQ(pageFileManager->FindPersistentPage(key), nullptr);
+
+        auto pageEntry = pageFileManager->CreatePageEntry(payload.data(), payload.size());
+        ASSERT_NE(pageEntry, nullptr);
+        EXPECT_TRUE(pageFileManager->StorePersistentPage(key, pageEntry));
+        EXPECT_EQ(pageEntry->PageId(), hvt::HdPageFileManager::SHARED_PAGE_ID);
+        pageFileManager->ReleasePage(*pageEntry);
+
+        auto temporaryPage =
+            pageFileManager->CreatePageEntry(otherPayload.data(), otherPayload.size());
+        ASSERT_NE(temporaryPage, nullptr);
+        pageFileManager->ReleasePage(*temporaryPage);
+        EXPECT_EQ(pageFileManager->GetPersistentPageCount(), 1u);
+    }
+    EXPECT_TRUE(std::filesystem::exists(desc.pageFileDirectory / "page_index.bin"));
+
+    // Session 2: the page is found by its key and content hash, and updates copy it out.
+    {
+        hvt::DefaultBufferManager bufferManager(desc);
+        auto& pageFileManager = bufferManager.GetPageFileManager();
+        EXPECT_EQ(pageFileManager->GetPersistentPageCount(), 1u);
+
+        auto changedKey        = key;
+        changedKey.contentHash = 43;
+        EXPECT_EQ(pageFileManager->FindPersistentPage(changedKey), nullptr);
+
+        auto pageEntry = pageFileManager->FindPersistentPage(key);
+        ASSERT_NE(pageEntry, nullptr);
+        std::vector<std::byte> readBack(payload.size());
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntry, readBack.data()));
+        EXPECT_EQ(readBack, payload);
+
+        std::vector<std::byte> update(payload.size(), std::byte { 0x11 });
+        EXPECT_TRUE(pageFileManager->UpdatePage(*pageEntry, update.data()));
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntry, readBack.data()));
+        EXPECT_EQ(readBack, update);
+        pageFileManager->ReleasePage(*pageEntry);
+
+        pageEntry = pageFileManager->FindPersistentPage(key);
+        ASSERT_NE(pageEntry, nullptr);
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntry, readBack.data()));
+        EXPECT_EQ(readBack, payload);
+        pageFileManager->ReleasePage(*pageEntry);
+
+        // New pages do not overwrite the persistent ones.
+        auto newPage = pageFileManager->CreatePageEntry(otherPayload.data(), otherPayload.size());
+        ASSERT_NE(newPage, nullptr);
+        pageEntry = pageFileManager->FindPersistentPage(key);
+        ASSERT_NE(pageEntry, nullptr);
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntry, readBack.data()));
+        EXPECT_EQ(readBack, payload);
+        pageFileManager->ReleasePage(*pageEntry);
+        pageFileManager->ReleasePage(*newPage);
+
+        pageFileManager->ClearPersistentPages();
+        EXPECT_EQ(pageFileManager->GetPersistentPageCount(), 0u);
+    }
+
+    // Session 3: nothing left.
+    {
+        hvt::DefaultBufferManager bufferManager(desc);
+        EXPECT_EQ(bufferManager.GetPageFileManager()->GetPersistentPageCount(), 0u);
+        EXPECT_EQ(bufferManager.GetPageFileManager()->FindPersistentPage(key), nullptr);
+    }
+
+    std::filesystem::remove_all(desc.pageFileDirectory);
+
+    GTEST_SUCCEED();
+}
+
+/// Test: The page I/O engine reads and writes pages asynchronously, merges the writes of
+/// adjacent pages, and serves the async swaps of the buffer manager.
+TEST(TestPageableBuffer, PageIOEngine)
+{
+    for (const auto backend : { hvt::HdPageIOBackend::ThreadPool, hvt::HdPageIOBackend::Auto })
+    {
+        hvt::DefaultBufferManager::InitializeDesc desc;
+        desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_page_io_test";
+        desc.numThreads        = 2;
+        desc.pageIO.backend    = backend;
+        desc.pageIO.queueDepth = 4;
+
+        hvt::DefaultBufferManager bufferManager(desc);
+        auto& pageFileManager = bufferManager.GetPageFileManager();
+
+        // One batch of adjacent pages, written with merged operations.
+        std::vector<std::vector<std::byte>> payloads;
+        std::vector<PXR_NS::TfSpan<const std::byte>> pages;
+        for (int i = 0; i < 64; ++i)
+        {
+            payloads.emplace_back(4 * hvt::ONE_KiB + i * 10, static_cast<std::byte>(i));
+        }
+        for (const auto& payload : payloads)
+        {
+            pages.emplace_back(payload.data(), payload.size());
+        }
+
+        std::promise<std::vector<std::unique_ptr<hvt::HdBufferPageEntry>>> written;
+        pageFileManager->CreatePageEntriesAsync(
+            PXR_NS::TfSpan<const PXR_NS::TfSpan<const std::byte>>(pages.data(), pages.size()),
+            [&written](std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pageEntries)
+            { written.set_value(std::move(pageEntries)); });
+        auto pageEntries = written.get_future().get();
+        ASSERT_EQ(pageEntries.size(), payloads.size());
+
+        // Reads complete in any order, each into its own buffer.
+        std::vector<std::vector<std::byte>> readBack(payloads.size());
+        std::vector<std::future<bool>> reads;
+        for (size_t i = 0; i < pageEntries.size(); ++i)
+        {
+            ASSERT_NE(pageEntries[i], nullptr);
+            readBack[i].resize(payloads[i].size());
+            reads.push_back(pageFileManager->LoadPageAsync(*pageEntries[i], readBack[i]));
+        }
+        for (size_t i = 0; i < reads.size(); ++i)
+        {
+            EXPECT_TRUE(reads[i].get());
+            EXPECT_EQ(readBack[i], payloads[i]);
+        }
+
+        std::vector<std::byte> update(payloads[3].size(), std::byte { 0xEE });
+        EXPECT_TRUE(pageFileManager->UpdatePageAsync(*pageEntries[3], update).get());
+        EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[3], readBack[3].data()));
+        EXPECT_EQ(readBack[3], update);
+
+        // A destination smaller than the page fails right away.
+        std::vector<std::byte> tooSmall(16);
+        EXPECT_FALSE(pageFileManager->LoadPageAsync(*pageEntries[0], tooSmall).get());
+
+        pageFileManager->WaitForPendingIO();
+        const auto stats = pageFileManager->GetIOEngine().GetStats();
+        EXPECT_EQ(stats.completed, stats.submitted);
+        EXPECT_EQ(stats.failed, 0u);
+        EXPECT_LT(stats.operations, stats.submitted);
+        EXPECT_GT(stats.merged, 0u);
+        EXPECT_LE(stats.maxInFlight, desc.pageIO.queueDepth);
+        if (backend == hvt::HdPageIOBackend::ThreadPool)
+        {
+            EXPECT_EQ(pageFileManager->GetIOEngine().GetBackend(), backend);
+        }
+
+        for (const auto& pageEntry : pageEntries)
+        {
+            pageFileManager->ReleasePage(*pageEntry);
+        }
+
+        // Async swaps write their pages on the engine; the values page in on the task threads.
+        PXR_NS::VtValue floatsValue(PXR_NS::VtFloatArray(10000, 1.5f));
+        auto value = std::make_shared<hvt::HdPageableValue>(PXR_NS::SdfPath("/PageIO/value"),
+            hvt::HdPageableValue::EstimateMemoryUsage(floatsValue), hvt::HdBufferUsage::Static,
+            pageFileManager, bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {},
+            floatsValue, PXR_NS::TfToken("float[]"));
+        EXPECT_TRUE(bufferManager.SwapSceneToDiskAsync(value).get());
+        EXPECT_FALSE(value->IsDataResident());
+        EXPECT_TRUE(value->HasValidDiskBuffer());
+
+        EXPECT_TRUE(bufferManager.SwapToSceneMemoryAsync(value).get());
+        EXPECT_TRUE(value->IsDataResident());
+        EXPECT_FALSE(value->HasValidDiskBuffer());
+        EXPECT_EQ(value->GetPageInCount(), 1u);
+        auto pagedIn = value->GetValueIfResident();
+        ASSERT_TRUE(pagedIn.IsHolding<PXR_NS::VtFloatArray>());
+        EXPECT_EQ(pagedIn.UncheckedGet<PXR_NS::VtFloatArray>(), PXR_NS::VtFloatArray(10000, 1.5f));
+
+        bufferManager.WaitForAllOperations();
+        EXPECT_EQ(bufferManager.GetPendingOperations(), 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+        pageFileManager->PrintPagerStats();
+#endif
+    }
+
+    GTEST_SUCCEED();
+}
+
+/// Test: Tiered page storage fills the fast tier up to its capacity and spills to the slow one,
+/// cold pages migrate down, rewritten pages move back up, and the memory monitor reports it.
+TEST(TestPageableBuffer, StorageTiers)
+{
+    const auto root = std::filesystem::temp_directory_path() / "hvt_tiers_test";
+    std::filesystem::remove_all(root);
+
+    const size_t pageSize = 16 * hvt::ONE_KiB;
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.storageTiers = { { root / "fast", 4 * pageSize }, { root / "slow", 0 } };
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+    auto& memoryMonitor   = bufferManager.GetMemoryMonitor();
+    ASSERT_EQ(pageFileManager->GetStorageTierCount(), 2u);
+
+    // The first four pages fill the fast tier, the others spill to the slow one.
+    std::vector<std::vector<std::byte>> payloads;
+    std::vector<std::unique_ptr<hvt::HdBufferPageEntry>> pageEntries;
+    for (int i = 0; i < 8; ++i)
+    {
+        payloads.emplace_back(pageSize, static_cast<std::byte>(i + 1));
+        pageEntries.push_back(
+            pageFileManager->CreatePageEntry(payloads.back().data(), payloads.back().size()));
+        ASSERT_NE(pageEntries.back(), nullptr);
+    }
+
+    auto tiers = memoryMonitor->GetStorageTierStats();
+    ASSERT_EQ(tiers.size(), 2u);
+    EXPECT_EQ(tiers[0].directory, root / "fast");
+    EXPECT_EQ(tiers[0].capacity, 4 * pageSize);
+    EXPECT_EQ(tiers[0].pageCount, 4u);
+    EXPECT_EQ(tiers[0].liveBytes, 4 * pageSize);
+    EXPECT_EQ(tiers[1].pageCount, 4u);
+    EXPECT_EQ(tiers[1].spilledBytes, 4 * pageSize);
+    EXPECT_TRUE(std::filesystem::exists(root / "fast" / "page_0.bin"));
+    EXPECT_TRUE(std::filesystem::exists(root / "slow" / "page_1.bin"));
+
+    const auto expectContent = [&]()
+    {
+        std::vector<std::byte> readBack(pageSize);
+        for (size_t i = 0; i < pageEntries.size(); ++i)
+        {
+            EXPECT_TRUE(pageFileManager->LoadPage(*pageEntries[i], readBack.data()));
+            EXPECT_EQ(readBack, payloads[i]);
+        }
+    };
+    expectContent();
+
+    // Pages accessed within the age stay where they are.
+    auto result = bufferManager.MigrateColdPages(hvt::ONE_MiB, std::chrono::hours(1));
+    EXPECT_EQ(result.bytesMoved, 0u);
+    EXPECT_FALSE(result.pending);
+
+    // Without an age, all pages of the fast tier are cold and move down in budget sized steps.
+    size_t steps = 0;
+    do
+    {
+        result = bufferManager.MigrateColdPages(2 * pageSize, std::chrono::milliseconds(0));
+        ++steps;
+    } while (result.pending && steps < 10);
+    EXPECT_EQ(steps, 2u);
+
+    tiers = memoryMonitor->GetStorageTierStats();
+    EXPECT_EQ(tiers[0].pageCount, 0u);
+    EXPECT_EQ(tiers[0].pageFileCount, 0u);
+    EXPECT_EQ(tiers[0].usedBytes, 0u);
+    EXPECT_EQ(tiers[0].migratedBytes, 4 * pageSize);
+    EXPECT_EQ(tiers[1].pageCount, 8u);
+    expectContent();
+
+    // A rewritten page moves back up to the fast tier.
+    payloads[2].assign(pageSize, std::byte { 0x77 });
+    EXPECT_TRUE(pageFileManager->UpdatePage(*pageEntries[2], payloads[2].data()));
+    tiers = memoryMonitor->GetStorageTierStats();
+    EXPECT_EQ(tiers[0].pageCount, 1u);
+    EXPECT_EQ(tiers[0].promotedBytes, pageSize);
+    EXPECT_EQ(tiers[1].pageCount, 7u);
+    expectContent();
+
+    for (const auto& pageEntry : pageEntries)
+    {
+        pageFileManager->ReleasePage(*pageEntry);
+    }
+    tiers = pageFileManager->GetStorageTierStats();
+    EXPECT_EQ(tiers[0].liveBytes, 0u);
+    EXPECT_EQ(tiers[1].liveBytes, 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    pageFileManager->PrintPagerStats();
+    memoryMonitor->PrintMemoryStats();
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: The access index orders the buffers by frame stamp and selects the oldest ones without
+/// sorting all buffers.
+TEST(TestPageableBuffer, AccessIndexSelection)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_access_index_test";
+
+    hvt::DefaultBufferManager bufferManager(desc);
+    static_assert(hvt::DefaultBufferManager::kIndexedSelection);
+    static_assert(hvt::AgeBasedBufferManager::kIndexedSelection);
+    static_assert(!hvt::FIFOBufferManager::kIndexedSelection);
+    static_assert(!hvt::PressureBasedLargestBufferManager::kIndexedSelection);
+
+    // Four generations of four buffers each.
+    bufferManager.AdvanceFrame(100);
+    std::vector<std::shared_ptr<hvt::HdPageableBuffer>> buffers;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        auto buffer =
+            bufferManager.CreateBuffer(PXR_NS::SdfPath("/AccessIndex/Buffer" + std::to_string(i)));
+        ASSERT_NE(buffer, nullptr);
+        buffer->UpdateFrameStamp(bufferManager.GetCurrentFrame() - i % 4);
+        buffers.push_back(buffer);
+    }
+
+    const auto& accessIndex = bufferManager.GetAccessIndex();
+    EXPECT_EQ(accessIndex.Size(), 16u);
+    EXPECT_EQ(accessIndex.GetGenerationCount(), 4u);
+
+    // Least recently stamped first.
+    hvt::HdSelectionContext context;
+    context.currentFrame   = static_cast<int>(bufferManager.GetCurrentFrame());
+    context.requestedCount = 6;
+    auto selected = hvt::HdPagingStrategies::LRUSelectionStrategy {}(accessIndex, context);
+    ASSERT_EQ(selected.size(), 6u);
+    for (size_t i = 0; i < selected.size(); ++i)
+    {
+        EXPECT_EQ(selected[i]->FrameStamp(), i < 4 ? 97u : 98u);
+    }
+
+    // A touched buffer moves to the tail of its new generation.
+    selected.front()->UpdateFrameStamp(bufferManager.GetCurrentFrame() + 1);
+    EXPECT_EQ(accessIndex.GetGenerationCount(), 5u);
+    context.requestedCount = 16;
+    selected = hvt::HdPagingStrategies::OldestFirstSelectionStrategy {}(accessIndex, context);
+    ASSERT_EQ(selected.size(), 16u);
+    EXPECT_EQ(selected.front()->FrameStamp(), 97u);
+    EXPECT_EQ(selected.back()->FrameStamp(), bufferManager.GetCurrentFrame() + 1);
+
+    // Repeat touches within a frame keep the buffer in place: a generation is in first touch
+    // order.
+    auto firstTouched = selected.back();
+    auto nextTouched  = selected.front();
+    nextTouched->UpdateFrameStamp(bufferManager.GetCurrentFrame() + 1);
+    firstTouched->UpdateFrameStamp(bufferManager.GetCurrentFrame() + 1);
+    selected = hvt::HdPagingStrategies::OldestFirstSelectionStrategy {}(accessIndex, context);
+    ASSERT_EQ(selected.size(), 16u);
+    EXPECT_EQ(selected[14], firstTouched);
+    EXPECT_EQ(selected[15], nextTouched);
+    EXPECT_EQ(accessIndex.GetGenerationCount(), 5u);
+    firstTouched.reset();
+    nextTouched.reset();
+    selected.clear();
+
+    // Null buffers are rejected, removed buffers leave the index.
+    EXPECT_FALSE(bufferManager.AddBuffer(PXR_NS::SdfPath("/AccessIndex/Null"), nullptr));
+    for (const auto& buffer : buffers)
+    {
+        bufferManager.RemoveBuffer(buffer->Key());
+    }
+    EXPECT_EQ(accessIndex.Size(), 0u);
+    EXPECT_EQ(accessIndex.GetGenerationCount(), 0u);
+
+    // Unlinked buffers still keep their frame stamp.
+    buffers.front()->UpdateFrameStamp(7);
+    EXPECT_EQ(buffers.front()->FrameStamp(), 7u);
+
+    GTEST_SUCCEED();
+}
+
+/// Test: The scan-resistant selection strategies keep the working set in memory while an orbit
+/// sweeps buffers used once, where LRU pages the working set out on every orbit.
+TEST(TestPageableBuffer, ScanResistantSelection)
+{
+    hvt::ClockProBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_scan_resistant_test";
+
+    // Each round views the working set a few times, then orbits over buffers used once per
+    // round before returning to the working set.
+    constexpr size_t capacity   = 64;
+    constexpr size_t workingSet = 48;
+    constexpr size_t orbitSize  = 256;
+    constexpr int passCount     = 4;
+    constexpr int roundCount    = 6;
+
+    // Replays the trace and returns the hit rate. When more buffers than the capacity hold scene
+    // memory, the victims selected by the strategy are paged out.
+    auto replay = [&](auto&& strategy, bool residentOnly)
+    {
+        hvt::ClockProBufferManager bufferManager(desc);
+        std::vector<std::shared_ptr<hvt::HdPageableBuffer>> buffers;
+        for (size_t i = 0; i < workingSet + orbitSize; ++i)
+        {
+            const PXR_NS::SdfPath path("/ScanResistant/Buffer" + std::to_string(i));
+            buffers.push_back(bufferManager.CreateBuffer(path));
+            EXPECT_TRUE(buffers.back()->SwapSceneToDisk(true));
+        }
+
+        unsigned int frame = 0;
+        size_t hits        = 0;
+        size_t accesses    = 0;
+        size_t resident    = 0;
+        auto access        = [&](const std::shared_ptr<hvt::HdPageableBuffer>& buffer)
+        {
+            buffer->UpdateFrameStamp(++frame);
+            ++accesses;
+            if (buffer->HasSceneBuffer())
+            {
+                ++hits;
+                return;
+            }
+            EXPECT_TRUE(buffer->SwapToSceneMemory(true));
+            if (++resident <= capacity)
+            {
+                return;
+            }
+
+            std::vector<std::shared_ptr<hvt::HdPageableBuffer>> candidates;
+            for (const auto& candidate : buffers)
+            {
+                if (!residentOnly || candidate->HasSceneBuffer())
+                {
+                    candidates.push_back(candidate);
+                }
+            }
+            hvt::HdSelectionContext context;
+            context.currentFrame   = static_cast<int>(frame);
+            context.requestedCount = resident - capacity;
+            for (const auto& victim : strategy(candidates.begin(), candidates.end(), context))
+            {
+                EXPECT_TRUE(victim->HasSceneBuffer());
+                EXPECT_TRUE(victim->SwapSceneToDisk(true));
+                --resident;
+            }
+        };
+
+        for (int round = 0; round < roundCount; ++round)
+        {
+            for (int pass = 0; pass < passCount; ++pass)
+            {
+                for (size_t i = 0; i < workingSet; ++i)
+                {
+                    access(buffers[i]);
+                }
+            }
+            for (size_t i = 0; i < orbitSize; ++i)
+            {
+                access(buffers[workingSet + i]);
+            }
+        }
+        EXPECT_EQ(resident, capacity);
+
+        return static_cast<double>(hits) / static_cast<double>(accesses);
+    };
+
+    const double lruHitRate = replay(hvt::HdPagingStrategies::LRUSelectionStrategy {}, true);
+    const double clockProHitRate =
+        replay(hvt::HdPagingStrategies::ClockProSelectionStrategy {}, false);
+    const double arcHitRate = replay(hvt::HdPagingStrategies::ArcSelectionStrategy {}, false);
+    const double twoQueueHitRate =
+        replay(hvt::HdPagingStrategies::TwoQueueSelectionStrategy {}, false);
+
+    // LRU misses the whole working set after each orbit.
+    EXPECT_GT(clockProHitRate, lruHitRate + 0.05);
+    EXPECT_GT(arcHitRate, lruHitRate + 0.05);
+    EXPECT_GT(twoQueueHitRate, lruHitRate + 0.05);
+
+    // The buffer manager gives all its buffers to the strategy, the policy forgets removed ones.
+    hvt::ClockProBufferManager bufferManager(desc);
+    std::vector<std::shared_ptr<hvt::HdPageableBuffer>> buffers;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        const PXR_NS::SdfPath path("/ScanResistant/Managed" + std::to_string(i));
+        buffers.push_back(bufferManager.CreateBuffer(path));
+        buffers.back()->UpdateFrameStamp(i);
+    }
+    hvt::HdPagingStrategies::ClockProSelectionStrategy strategy;
+    hvt::HdSelectionContext context;
+    context.requestedCount = 4;
+    EXPECT_EQ(strategy(buffers.begin(), buffers.end(), context).size(), 4u);
+    EXPECT_EQ(strategy.policy->GetTrackedCount(), 16u);
+    buffers.resize(8);
+    EXPECT_EQ(strategy(buffers.begin(), buffers.end(), context).size(), 4u);
+    EXPECT_EQ(strategy.policy->GetTrackedCount(), 8u);
+    bufferManager.FreeCrawl(100.0f);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    std::cout << "Hit rates: LRU " << lruHitRate << ", CLOCK-Pro " << clockProHitRate << ", ARC "
+              << arcHitRate << ", 2Q " << twoQueueHitRate << std::endl;
+#endif
+
+    GTEST_SUCCEED();
+}
+
+/// Test: A paging trace records the accesses and paging of a session, and replaying it with the
+/// same strategies reproduces the recorded hits and paging without any I/O.
+TEST(TestPageableBuffer, PagingTraceReplay)
+{
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "hvt_trace_replay_test";
+    std::filesystem::create_directories(directory);
+    const std::filesystem::path tracePath = directory / "session.hvttrace";
+
+    constexpr size_t bufferSize  = 4 * hvt::ONE_KiB;
+    constexpr size_t bufferCount = 32;
+    constexpr int frameCount     = 40;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = directory / "pages";
+    desc.ageLimit          = 4;
+    desc.sceneMemoryLimit  = 12 * bufferSize;
+    desc.tracePath         = tracePath;
+
+    // Records a session viewing a sliding window of buffers, with a crawl per frame. The replay
+    // buffers stand in for real ones, the recorded session then behaves as its replay.
+    hvt::HdPagingTraceStats recorded;
+    {
+        hvt::DefaultBufferManager bufferManager(desc);
+        EXPECT_TRUE(bufferManager.GetTraceRecorder().IsRecording());
+
+        std::vector<std::shared_ptr<hvt::HdReplayBuffer>> buffers;
+        for (size_t i = 0; i < bufferCount; ++i)
+        {
+            const PXR_NS::SdfPath path("/Trace/Buffer" + std::to_string(i));
+            buffers.push_back(std::make_shared<hvt::HdReplayBuffer>(path, bufferSize,
+                i % 4 == 0 ? hvt::HdBufferUsage::Dynamic : hvt::HdBufferUsage::Static, true,
+                bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor()));
+            EXPECT_TRUE(bufferManager.AddBuffer(path, buffers.back()));
+        }
+
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            const size_t first = frame == 0 ? 0 : static_cast<size_t>(frame) % bufferCount;
+            const size_t count = frame == 0 ? bufferCount : 8;
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto& buffer = buffers[(first + i) % bufferCount];
+                buffer->UpdateFrameStamp(bufferManager.GetCurrentFrame());
+                if (!buffer->HasSceneBuffer() && !buffer->HasRendererBuffer())
+                {
+                    EXPECT_TRUE(buffer->SwapToSceneMemory(true));
+                }
+            }
+            bufferManager.AdvanceFrame();
+            bufferManager.FreeCrawl(50.0f);
+        }
+
+        // Removing a buffer is recorded too.
+        bufferManager.RemoveBuffer(buffers.back()->Key());
+        buffers.pop_back();
+
+        recorded = bufferManager.GetTraceRecorder().GetStats();
+        bufferManager.StopTrace();
+        EXPECT_FALSE(bufferManager.GetTraceRecorder().IsRecording());
+    }
+    EXPECT_GT(recorded.pageIns, 0u);
+    EXPECT_GT(recorded.pageOuts, 0u);
+    EXPECT_EQ(recorded.bytesPagedIn, recorded.pageIns * bufferSize);
+    EXPECT_EQ(recorded.traceBytes, std::filesystem::file_size(tracePath));
+
+    // The trace holds the settings of the session, and a few bytes per event.
+    hvt::HdPagingTraceReader reader(tracePath);
+    ASSERT_TRUE(reader.IsValid());
+    EXPECT_EQ(reader.GetHeader().sceneMemoryLimit, desc.sceneMemoryLimit);
+    EXPECT_EQ(reader.GetHeader().ageLimit, desc.ageLimit);
+    EXPECT_LT(recorded.traceBytes, recorded.records * 8);
+
+    const hvt::HdPagingReplayStats summary = hvt::SummarizePagingTrace(tracePath);
+    EXPECT_EQ(summary.buffers, bufferCount);
+    EXPECT_EQ(summary.frames, static_cast<size_t>(frameCount));
+    EXPECT_EQ(summary.crawls, static_cast<size_t>(frameCount));
+    EXPECT_EQ(summary.accesses, recorded.accesses);
+    EXPECT_EQ(summary.hits, recorded.hits);
+    EXPECT_EQ(summary.pageIns, recorded.pageIns);
+    EXPECT_EQ(summary.bytesPagedOut, recorded.bytesPagedOut);
+    EXPECT_LE(summary.peakResidentBytes, bufferCount * bufferSize);
+
+    // The same strategies make the same decisions.
+    hvt::HdPagingReplayConfig config;
+    config.pageFileDirectory                = directory / "replay";
+    const hvt::HdPagingReplayStats replayed =
+        hvt::ReplayPagingTrace<hvt::DefaultBufferManager>(tracePath, config);
+    EXPECT_EQ(replayed.buffers, summary.buffers);
+    EXPECT_EQ(replayed.accesses, summary.accesses);
+    EXPECT_EQ(replayed.hits, summary.hits);
+    EXPECT_EQ(replayed.pageIns, summary.pageIns);
+    EXPECT_EQ(replayed.pageOuts, summary.pageOuts);
+    EXPECT_EQ(replayed.bytesPagedIn, summary.bytesPagedIn);
+    EXPECT_EQ(replayed.peakResidentBytes, summary.peakResidentBytes);
+
+    // Other strategies and settings replay the same accesses.
+    const hvt::HdPagingReplayStats arc =
+        hvt::ReplayPagingTrace<hvt::ArcBufferManager>(tracePath, config);
+    EXPECT_EQ(arc.accesses, summary.accesses);
+    EXPECT_LE(arc.peakResidentBytes, summary.peakResidentBytes);
+
+    config.sceneMemoryLimit = bufferCount * bufferSize * 2;
+    const hvt::HdPagingReplayStats unlimited =
+        hvt::ReplayPagingTrace<hvt::AgeBasedBufferManager>(tracePath, config);
+    EXPECT_EQ(unlimited.accesses, summary.accesses);
+    EXPECT_GE(unlimited.hits, replayed.hits);
+
+    // Not a trace.
+    EXPECT_EQ(hvt::ReplayPagingTrace<hvt::DefaultBufferManager>(directory / "missing", config)
+                  .accesses,
+        0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    std::cout << "Trace: " << recorded.records << " records, " << recorded.traceBytes
+              << " bytes, hit rate " << summary.HitRate() << ", replayed " << replayed.HitRate()
+              << ", age-based unlimited " << unlimited.HitRate() << ", ARC " << arc.HitRate()
+              << std::endl;
+#endif
+
+    std::filesystem::remove_all(directory);
+    GTEST_SUCCEED();
+}
+
+/// Test: The runtime strategies of a buffer manager are replaced between crawls, the buffers are
+/// kept and the next crawl uses the new strategies.
+TEST(TestPageableBuffer, RuntimeStrategies)
+{
+    hvt::RuntimeBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_runtime_strategy_test";
+
+    constexpr size_t bufferCount = 20;
+    constexpr size_t bufferSize  = 4 * hvt::ONE_KiB;
+    desc.sceneMemoryLimit        = bufferCount * bufferSize / 2;
+
+    hvt::RuntimeBufferManager bufferManager(desc);
+    EXPECT_TRUE(bufferManager.GetPagingStrategy().Holds<hvt::HdPagingStrategies::HybridStrategy>());
+    EXPECT_TRUE(bufferManager.GetBufferSelectionStrategy()
+                    .Holds<hvt::HdPagingStrategies::LRUSelectionStrategy>());
+
+    // Buffers of growing size, all in scene memory and used this frame: twice the memory limit.
+    std::vector<std::shared_ptr<hvt::HdReplayBuffer>> buffers;
+    for (size_t i = 0; i < bufferCount; ++i)
+    {
+        const PXR_NS::SdfPath path("/Runtime/Buffer" + std::to_string(i));
+        buffers.push_back(std::make_shared<hvt::HdReplayBuffer>(path, bufferSize + i,
+            hvt::HdBufferUsage::Static, true, bufferManager.GetPageFileManager(),
+            bufferManager.GetMemoryMonitor()));
+        EXPECT_TRUE(bufferManager.AddBuffer(path, buffers.back()));
+        buffers.back()->UpdateFrameStamp(bufferManager.GetCurrentFrame());
+    }
+    auto residentCount = [&]()
+    {
+        return std::count_if(buffers.begin(), buffers.end(),
+            [](const auto& buffer) { return buffer->HasSceneBuffer(); });
+    };
+
+    // The conservative strategy keeps recent buffers even under pressure.
+    bufferManager.GetPagingStrategy().Set(hvt::HdPagingStrategies::ConservativeStrategy {});
+    EXPECT_TRUE(
+        bufferManager.GetPagingStrategy().Holds<hvt::HdPagingStrategies::ConservativeStrategy>());
+    bufferManager.FreeCrawl(100.0f);
+    EXPECT_EQ(residentCount(), static_cast<std::ptrdiff_t>(bufferCount));
+
+    // The pressure-based strategy pages the 10 buffers selected by the largest-first strategy.
+    bufferManager.GetPagingStrategy().Set(hvt::HdPagingStrategies::PressureBasedStrategy {});
+    bufferManager.GetBufferSelectionStrategy().Set(
+        hvt::HdPagingStrategies::LargestFirstSelectionStrategy {});
+    bufferManager.FreeCrawl(10.0f);
+    EXPECT_EQ(residentCount(), static_cast<std::ptrdiff_t>(bufferCount - 10));
+    for (size_t i = 0; i < bufferCount; ++i)
+    {
+        EXPECT_EQ(buffers[i]->HasSceneBuffer(), i < bufferCount - 10);
+    }
+
+    // A custom strategy decides for all the buffers of a crawl in one call of the holder.
+    struct CountingStrategy
+    {
+        hvt::HdPagingDecision operator()(
+            const hvt::HdPageableBufferCore&, const hvt::HdPagingContext&) const
+        {
+            ++*decisions;
+            return {};
+        }
+        std::shared_ptr<std::atomic<size_t>> decisions = std::make_shared<std::atomic<size_t>>(0);
+    };
+    CountingStrategy counting;
+    hvt::HdPagingStrategies::RuntimePagingStrategy paging = bufferManager.GetPagingStrategy();
+    paging.Set(counting); // Copies share the strategy.
+    for (const auto& buffer : buffers)
+    {
+        EXPECT_TRUE(buffer->SwapToSceneMemory(true));
+    }
+    bufferManager.FreeCrawl(100.0f);
+    EXPECT_EQ(counting.decisions->load(), bufferCount);
+    EXPECT_EQ(residentCount(), static_cast<std::ptrdiff_t>(bufferCount));
+
+    // Selection strategies without access index support are given all the buffers.
+    bufferManager.GetBufferSelectionStrategy().Set(
+        hvt::HdPagingStrategies::FIFOSelectionStrategy {});
+    bufferManager.FreeCrawl(50.0f);
+    EXPECT_EQ(counting.decisions->load(), bufferCount + 10);
+
+    // The data source manager offers the same replacement.
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory       = desc.pageFileDirectory / "dataSources";
+    config.enableBackgroundCleanup = false;
+    hvt::HdPageableDataSourceManager dataSourceManager(config);
+    dataSourceManager.SetPagingStrategy(hvt::HdPagingStrategies::AgeBasedStrategy {});
+    dataSourceManager.SetSelectionStrategy(hvt::HdPagingStrategies::ArcSelectionStrategy {});
+    EXPECT_TRUE(
+        dataSourceManager.GetPagingStrategy().Holds<hvt::HdPagingStrategies::AgeBasedStrategy>());
+    EXPECT_TRUE(dataSourceManager.GetSelectionStrategy()
+                    .Holds<hvt::HdPagingStrategies::ArcSelectionStrategy>());
+
+    GTEST_SUCCEED();
+}
+
+/// Test: The pressure controller holds a growing load near its setpoint without evicting below
+/// it, backs off once the load is steady, and the buffer manager frees the bytes it asks for.
+TEST(TestPageableBuffer, PressureController)
+{
+    hvt::HdPressureControllerConfig controllerConfig;
+    hvt::HdPressureController controller(controllerConfig);
+
+    // A load growing by 2% of the limit every 100 ms, evictions applied at once.
+    constexpr size_t limit = 100 * hvt::ONE_MiB;
+    constexpr size_t growth = 2 * hvt::ONE_MiB;
+    constexpr float growthRate = 0.2f; // per second
+    size_t used = limit / 4;
+    auto now    = hvt::HdPressureController::Clock::now();
+    std::chrono::milliseconds lowPressureInterval { 0 };
+    std::chrono::milliseconds highPressureInterval { 0 };
+    for (int step = 0; step < 100; ++step)
+    {
+        const hvt::HdPressureControlStep control = controller.Update(used, limit, now);
+        if (step == 5)
+        {
+            lowPressureInterval = control.nextInterval; // 35% of the limit
+        }
+        else if (step == 18)
+        {
+            highPressureInterval = control.nextInterval; // 61% of the limit
+        }
+        if (control.bytesToEvict > 0)
+        {
+            EXPECT_LE(control.bytesToEvict, used);
+            used -= control.bytesToEvict;
+            controller.ReportEvicted(control.bytesToEvict);
+            EXPECT_EQ(control.nextInterval, controllerConfig.minInterval);
+        }
+
+        // Once the rate is known, the memory stays between the setpoint minus the growth of
+        // a lookahead and the deadband above the setpoint.
+        const float pressure = static_cast<float>(used) / static_cast<float>(limit);
+        if (step > 50)
+        {
+            EXPECT_GE(pressure, controllerConfig.targetPressure -
+                    controllerConfig.lookahead * growthRate - 0.03f);
+            EXPECT_LE(pressure, controllerConfig.targetPressure + controllerConfig.deadband);
+        }
+
+        used += growth;
+        now += std::chrono::milliseconds(100);
+    }
+    hvt::HdPressureControllerState state = controller.GetState();
+    EXPECT_EQ(state.updates, 100u);
+    EXPECT_GT(state.evictions, 0u);
+    EXPECT_GT(state.bytesEvicted, 0u);
+    EXPECT_NEAR(state.pressureRate, growthRate, 0.01f);
+    EXPECT_FLOAT_EQ(state.targetPressure, controllerConfig.targetPressure);
+    // Checked sooner as the memory grows toward the setpoint.
+    EXPECT_LT(highPressureInterval, lowPressureInterval);
+
+    // A steady load is left alone and checked less and less often.
+    for (int step = 0; step < 20; ++step)
+    {
+        const hvt::HdPressureControlStep control = controller.Update(used, limit, now);
+        if (step > 2)
+        {
+            EXPECT_EQ(control.bytesToEvict, 0u);
+        }
+        now += control.nextInterval;
+    }
+    EXPECT_EQ(controller.GetState().interval, controllerConfig.maxInterval);
+
+    // A spike is evicted at once, up to the cap of one eviction.
+    const size_t spike = used + limit / 2;
+    const hvt::HdPressureControlStep control = controller.Update(spike, limit, now);
+    EXPECT_EQ(control.bytesToEvict,
+        static_cast<size_t>(controllerConfig.maxEvictPressure * static_cast<double>(limit)));
+
+    controller.Reset();
+    EXPECT_EQ(controller.GetState().updates, 0u);
+
+    // The buffer manager frees the requested scene memory from the least recently used buffers,
+    // keeping the dynamic and the recent ones.
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_pressure_control_test";
+    desc.ageLimit          = 5;
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    constexpr size_t bufferCount = 20;
+    constexpr size_t bufferSize  = 4 * hvt::ONE_KiB;
+    std::vector<std::shared_ptr<hvt::HdReplayBuffer>> buffers;
+    for (size_t i = 0; i < bufferCount; ++i)
+    {
+        const PXR_NS::SdfPath path("/Pressure/Buffer" + std::to_string(i));
+        buffers.push_back(std::make_shared<hvt::HdReplayBuffer>(path, bufferSize,
+            i == 0 ? hvt::HdBufferUsage::Dynamic : hvt::HdBufferUsage::Static, true,
+            bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor()));
+        EXPECT_TRUE(bufferManager.AddBuffer(path, buffers.back()));
+        buffers.back()->UpdateFrameStamp(bufferManager.GetCurrentFrame());
+        bufferManager.AdvanceFrame();
+    }
+
+    const size_t freed = bufferManager.FreeSceneMemory(3 * bufferSize + 1);
+    EXPECT_EQ(freed, 4 * bufferSize);
+    for (size_t i = 0; i < bufferCount; ++i)
+    {
+        EXPECT_EQ(buffers[i]->HasSceneBuffer(), i == 0 || i > 4) << "buffer " << i;
+    }
+
+    // Only the buffers over the age limit can be paged out: 5 to 15, the last 4 are recent.
+    EXPECT_EQ(bufferManager.FreeSceneMemory(bufferCount * bufferSize), 11 * bufferSize);
+    EXPECT_EQ(bufferManager.FreeSceneMemory(bufferSize), 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    std::cout << "Pressure controller: " << state.evictions << " evictions, "
+              << hvt::FormatBytes(state.bytesEvicted) << " evicted, rate " << state.pressureRate
+              << "/s\n";
+#endif
+
+    // The data source manager runs the controller in its background cleanup.
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory                 = desc.pageFileDirectory / "dataSources";
+    config.enableBackgroundCleanup           = false;
+    config.pressureControl                   = true;
+    config.pressureController.targetPressure = 0.6f;
+    hvt::HdPageableDataSourceManager dataSourceManager(config);
+    EXPECT_TRUE(dataSourceManager.IsPressureControlEnabled());
+    EXPECT_FLOAT_EQ(dataSourceManager.GetPressureController().GetConfig().targetPressure, 0.6f);
+    EXPECT_EQ(dataSourceManager.GetPressureControllerState().updates, 0u);
+
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: With a system memory probe, the scene memory limit follows the cgroup and system
+/// headroom and the memory stalls raise the scene pressure.
+TEST(TestPageableBuffer, SystemMemoryProbe)
+{
+    struct FakeProbe : hvt::IHdSystemMemoryProbe
+    {
+        hvt::HdSystemMemoryReading Read() override { return reading; }
+        hvt::HdSystemMemoryReading reading;
+    };
+    auto probe                     = std::make_shared<FakeProbe>();
+    probe->reading.hasCgroup       = true;
+    probe->reading.cgroupLimit     = 1024 * hvt::ONE_MiB;
+    probe->reading.cgroupUsage     = 600 * hvt::ONE_MiB;
+    probe->reading.hasMeminfo      = true;
+    probe->reading.availableMemory = 8 * hvt::ONE_GiB;
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_system_memory_test";
+    desc.sceneMemoryLimit  = 2 * hvt::ONE_GiB;
+    desc.systemMemoryProbe = probe;
+    desc.systemMemoryBudget.sceneShare          = 0.5f;
+    desc.systemMemoryBudget.reservedMemory      = 100 * hvt::ONE_MiB;
+    desc.systemMemoryBudget.minSceneMemoryLimit = hvt::ONE_MiB;
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& monitor = bufferManager.GetMemoryMonitor();
+
+    // Half of the cgroup headroom above the reserve: (1024 - 600 - 100) / 2 MiB.
+    EXPECT_TRUE(monitor->HasSystemMemoryProbe());
+    EXPECT_EQ(monitor->GetSceneMemoryLimit(), 162 * hvt::ONE_MiB);
+    EXPECT_EQ(monitor->GetConfiguredSceneMemoryLimit(), desc.sceneMemoryLimit);
+
+    // Resident buffers are part of the limit: the scene may keep them and grow into its share.
+    constexpr size_t bufferCount = 8;
+    std::vector<std::shared_ptr<hvt::HdReplayBuffer>> buffers;
+    for (size_t i = 0; i < bufferCount; ++i)
+    {
+        const PXR_NS::SdfPath path("/System/Buffer" + std::to_string(i));
+        buffers.push_back(std::make_shared<hvt::HdReplayBuffer>(path, hvt::ONE_MiB,
+            hvt::HdBufferUsage::Static, true, bufferManager.GetPageFileManager(), monitor));
+        EXPECT_TRUE(bufferManager.AddBuffer(path, buffers.back()));
+    }
+    EXPECT_TRUE(monitor->RefreshSystemMemory(true));
+    EXPECT_EQ(monitor->GetSceneMemoryLimit(), (bufferCount + 162) * hvt::ONE_MiB);
+
+    // The refreshes are rate limited.
+    probe->reading.cgroupUsage = 1000 * hvt::ONE_MiB;
+    EXPECT_FALSE(monitor->RefreshSystemMemory());
+
+    // No headroom left above the reserve: the scene is at its limit and pages out.
+    EXPECT_TRUE(monitor->RefreshSystemMemory(true));
+    EXPECT_EQ(monitor->GetSceneMemoryLimit(), bufferCount * hvt::ONE_MiB);
+    EXPECT_FLOAT_EQ(monitor->GetSceneMemoryPressure(), 1.0f);
+    bufferManager.AdvanceFrame(desc.ageLimit + 1);
+    bufferManager.FreeCrawl(100.0f);
+    EXPECT_LT(monitor->GetUsedSceneMemory(), bufferCount * hvt::ONE_MiB);
+
+    // The system memory bounds the cgroup headroom, the stalls raise the pressure.
+    probe->reading.cgroupUsage     = 0;
+    probe->reading.availableMemory = 300 * hvt::ONE_MiB;
+    probe->reading.hasPressure     = true;
+    probe->reading.stallSome       = 0.15f;
+    EXPECT_TRUE(monitor->RefreshSystemMemory(true));
+    EXPECT_EQ(monitor->GetSceneMemoryLimit(), monitor->GetUsedSceneMemory() + 100 * hvt::ONE_MiB);
+    EXPECT_FLOAT_EQ(monitor->GetSystemMemoryPressure(), 0.75f);
+    EXPECT_FLOAT_EQ(monitor->GetSceneMemoryPressure(), 0.75f);
+    EXPECT_FLOAT_EQ(monitor->GetSystemMemoryReading().stallSome, 0.15f);
+
+    // The Linux probe reads the cgroup of the process and its ancestors.
+    const std::filesystem::path root  = desc.pageFileDirectory / "probe";
+    const std::filesystem::path proc  = root / "proc";
+    const std::filesystem::path scope = root / "cgroup" / "app.slice" / "render.scope";
+    std::filesystem::create_directories(proc / "self");
+    std::filesystem::create_directories(proc / "pressure");
+    std::filesystem::create_directories(scope);
+    auto writeFile = [](const std::filesystem::path& path, const std::string& text)
+    { std::ofstream(path) << text; };
+    writeFile(proc / "self" / "cgroup", "0::/app.slice/render.scope\n");
+    writeFile(proc / "meminfo",
+        "MemTotal:       16777216 kB\nMemFree:         1048576 kB\n"
+        "MemAvailable:    4194304 kB\nBuffers:           65536 kB\n");
+    writeFile(proc / "pressure" / "memory",
+        "some avg10=9.00 avg60=1.00 avg300=0.50 total=1000\n"
+        "full avg10=4.00 avg60=0.50 avg300=0.10 total=500\n");
+    writeFile(scope / "memory.max", "max\n");
+    writeFile(scope / "memory.current", "536870912\n");
+    writeFile(scope / "memory.pressure",
+        "some avg10=2.50 avg60=1.00 avg300=0.50 total=1000\n"
+        "full avg10=1.25 avg60=0.50 avg300=0.10 total=500\n");
+    writeFile(scope.parent_path() / "memory.max", "2147483648\n");
+    writeFile(scope.parent_path() / "memory.current", "1073741824\n");
+
+    hvt::HdSystemMemoryProbe systemProbe(proc, root / "cgroup");
+    const hvt::HdSystemMemoryReading reading = systemProbe.Read();
+    EXPECT_TRUE(reading.hasCgroup);
+    EXPECT_EQ(reading.cgroupLimit, 2 * hvt::ONE_GiB);
+    EXPECT_EQ(reading.cgroupUsage, hvt::ONE_GiB);
+    EXPECT_TRUE(reading.hasMeminfo);
+    EXPECT_EQ(reading.totalMemory, 16 * hvt::ONE_GiB);
+    EXPECT_EQ(reading.availableMemory, 4 * hvt::ONE_GiB);
+    EXPECT_TRUE(reading.hasPressure);
+    EXPECT_FLOAT_EQ(reading.stallSome, 0.025f);
+    EXPECT_FLOAT_EQ(reading.stallFull, 0.0125f);
+    EXPECT_EQ(reading.GetHeadroom(), hvt::ONE_GiB);
+
+    // Nothing found: the configured limit is kept.
+    const hvt::HdSystemMemoryReading missing =
+        hvt::HdSystemMemoryProbe(root / "none", root / "none").Read();
+    EXPECT_FALSE(missing.hasCgroup || missing.hasMeminfo || missing.hasPressure);
+    EXPECT_EQ(missing.GetHeadroom(), std::numeric_limits<size_t>::max());
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    monitor->PrintMemoryStats();
+#endif
+
+    buffers.clear();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Memory pools account the buffers under their key prefixes, nested pools count in their
+/// parents, and a crawl brings the pools over budget back under it without global pressure.
+TEST(TestPageableBuffer, MemoryPools)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_memory_pool_test";
+    desc.sceneMemoryLimit  = 100 * hvt::ONE_MiB;
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    // A reference stage capped at 8 buffers, with a nested pool for its materials, next to an
+    // unlimited working stage.
+    constexpr size_t bufferSize = 64 * hvt::ONE_KiB;
+    hvt::HdMemoryPool* reference = bufferManager.CreateMemoryPool("reference", 8 * bufferSize);
+    hvt::HdMemoryPool* materials =
+        bufferManager.CreateMemoryPool("referenceMaterials", 0, reference);
+    hvt::HdMemoryPool* working = bufferManager.CreateMemoryPool("working");
+    ASSERT_TRUE(reference && materials && working);
+    EXPECT_EQ(bufferManager.CreateMemoryPool("working"), nullptr);
+    EXPECT_EQ(bufferManager.GetMemoryMonitor()->FindPool("referenceMaterials"), materials);
+    EXPECT_EQ(materials->GetParent(), reference);
+
+    const PXR_NS::SdfPath referenceRoot("/Reference");
+    bufferManager.AssignMemoryPool(referenceRoot, reference);
+    bufferManager.AssignMemoryPool(PXR_NS::SdfPath("/Working"), working);
+
+    std::vector<std::shared_ptr<hvt::HdReplayBuffer>> buffers;
+    auto addBuffer = [&](const std::string& path)
+    {
+        buffers.push_back(std::make_shared<hvt::HdReplayBuffer>(PXR_NS::SdfPath(path), bufferSize,
+            hvt::HdBufferUsage::Static, true, bufferManager.GetPageFileManager(),
+            bufferManager.GetMemoryMonitor()));
+        EXPECT_TRUE(bufferManager.AddBuffer(PXR_NS::SdfPath(path), buffers.back()));
+        buffers.back()->UpdateFrameStamp(bufferManager.GetCurrentFrame());
+    };
+    for (int i = 0; i < 8; ++i)
+    {
+        addBuffer("/Reference/Mesh" + std::to_string(i));
+        addBuffer("/Reference/Looks/Material" + std::to_string(i));
+        addBuffer("/Working/Mesh" + std::to_string(i));
+    }
+    addBuffer("/Other/Mesh");
+
+    // The most specific prefix wins; assigning it later moves the resident bytes.
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 16 * bufferSize);
+    bufferManager.AssignMemoryPool(PXR_NS::SdfPath("/Reference/Looks"), materials);
+    EXPECT_EQ(bufferManager.FindMemoryPool(PXR_NS::SdfPath("/Reference/Looks/Material0")),
+        materials);
+    EXPECT_EQ(bufferManager.FindMemoryPool(PXR_NS::SdfPath("/Other/Mesh")), nullptr);
+    EXPECT_EQ(materials->GetUsedSceneMemory(), 8 * bufferSize);
+    EXPECT_EQ(materials->GetBufferCount(), 8u);
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 16 * bufferSize);
+    EXPECT_EQ(reference->GetBufferCount(), 8u);
+    EXPECT_EQ(working->GetUsedSceneMemory(), 8 * bufferSize);
+    EXPECT_TRUE(reference->IsOverBudget());
+    EXPECT_FLOAT_EQ(reference->GetScenePressure(), 2.0f);
+
+    // The global pressure is low, the reference stage is still brought back to its budget, the
+    // working stage and the other buffers stay resident.
+    EXPECT_LT(bufferManager.GetMemoryMonitor()->GetSceneMemoryPressure(),
+        hvt::HdMemoryMonitor::LOW_MEMORY_THRESHOLD);
+    bufferManager.FreeCrawl();
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 8 * bufferSize);
+    EXPECT_EQ(working->GetUsedSceneMemory(), 8 * bufferSize);
+    EXPECT_TRUE(buffers.back()->HasSceneBuffer());
+
+    // A nested budget is enforced within its parent.
+    materials->SetSceneBudget(2 * bufferSize);
+    EXPECT_EQ(bufferManager.GetMemoryMonitor()->GetOverBudgetPools(),
+        std::vector<hvt::HdMemoryPool*> { materials });
+    bufferManager.FreeCrawl();
+    EXPECT_EQ(materials->GetUsedSceneMemory(), 2 * bufferSize);
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 6 * bufferSize);
+
+    // Freeing the memory of a pool only pages out its buffers, whatever their age.
+    EXPECT_EQ(bufferManager.FreeSceneMemory(100 * bufferSize, materials), 2 * bufferSize);
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 4 * bufferSize);
+    EXPECT_EQ(working->GetUsedSceneMemory(), 8 * bufferSize);
+
+    // Paging a buffer in counts in its pools again; removed buffers leave them.
+    for (const auto& buffer : buffers)
+    {
+        EXPECT_TRUE(buffer->SwapToSceneMemory(true));
+    }
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 16 * bufferSize);
+    bufferManager.RemoveBuffer(PXR_NS::SdfPath("/Reference/Mesh0"));
+    EXPECT_EQ(reference->GetUsedSceneMemory(), 15 * bufferSize);
+    EXPECT_EQ(reference->GetBufferCount(), 7u);
+
+    // Statistics of all the pools.
+    const std::vector<hvt::HdMemoryPoolStats> stats = bufferManager.GetMemoryPoolStats();
+    ASSERT_EQ(stats.size(), 3u);
+    EXPECT_EQ(stats[1].name, "referenceMaterials");
+    EXPECT_EQ(stats[1].parent, "reference");
+    EXPECT_EQ(stats[1].usedSceneMemory, 8 * bufferSize);
+    EXPECT_EQ(stats[0].sceneBudget, 8 * bufferSize);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    bufferManager.GetMemoryMonitor()->PrintMemoryStats();
+#endif
+
+    buffers.clear();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Per-frame paging I/O budget spreading evictions and page-ins over frames
+TEST(TestPageableBuffer, FrameIOBudget)
+{
+    constexpr size_t bufferSize = 64 * hvt::ONE_KiB;
+
+    // The budget alone: the first operation of a frame always runs, the next ones must fit.
+    hvt::HdFrameIOBudget budget;
+    EXPECT_FALSE(budget.IsEnabled());
+    EXPECT_TRUE(budget.TryAcquire(100 * hvt::ONE_MiB));
+    budget.SetConfig({ 2 * bufferSize, std::chrono::microseconds(0) });
+    budget.BeginFrame();
+    EXPECT_TRUE(budget.TryAcquire(4 * bufferSize));
+    EXPECT_FALSE(budget.TryAcquire(bufferSize));
+    budget.BeginFrame();
+    EXPECT_TRUE(budget.TryAcquire(bufferSize));
+    EXPECT_TRUE(budget.TryAcquire(bufferSize));
+    EXPECT_FALSE(budget.TryAcquire(1));
+
+    // Or spend their time.
+    budget.SetConfig({ 0, std::chrono::microseconds(500) });
+    budget.BeginFrame();
+    EXPECT_TRUE(budget.TryAcquire(bufferSize));
+    budget.Charge(std::chrono::microseconds(800));
+    EXPECT_FALSE(budget.TryAcquire(1));
+    EXPECT_EQ(budget.GetStats().frameMicroseconds, 800u);
+
+    // Postponed page-ins are queued once, in order; the ones put back stay in front.
+    budget.DeferPageIn(PXR_NS::SdfPath("/A"), bufferSize);
+    budget.DeferPageIn(PXR_NS::SdfPath("/B"), bufferSize);
+    budget.DeferPageIn(PXR_NS::SdfPath("/A"), bufferSize);
+    EXPECT_EQ(budget.GetStats().deferredPageIns, 2u);
+    EXPECT_EQ(budget.GetStats().deferredPageInBytes, 2 * bufferSize);
+    std::vector<PXR_NS::SdfPath> keys = budget.TakeDeferredPageIns();
+    ASSERT_EQ(keys.size(), 2u);
+    EXPECT_EQ(keys[0], PXR_NS::SdfPath("/A"));
+    EXPECT_EQ(budget.GetStats().pendingPageIns, 0u);
+    budget.DeferPageIn(PXR_NS::SdfPath("/C"), bufferSize);
+    budget.RequeuePageIns({ keys[1] });
+    keys = budget.TakeDeferredPageIns();
+    ASSERT_EQ(keys.size(), 2u);
+    EXPECT_EQ(keys[0], PXR_NS::SdfPath("/B"));
+    EXPECT_EQ(keys[1], PXR_NS::SdfPath("/C"));
+
+    // The crawls page out at most the budget of the frame, the rest in the next frames.
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory           = std::filesystem::temp_directory_path() / "hvt_frame_io_test";
+    desc.ageLimit                    = 1;
+    desc.frameIOBudget.bytesPerFrame = 4 * bufferSize;
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& memoryMonitor = bufferManager.GetMemoryMonitor();
+
+    std::vector<std::shared_ptr<hvt::HdReplayBuffer>> buffers;
+    for (int i = 0; i < 16; ++i)
+    {
+        const PXR_NS::SdfPath key("/Scene/Mesh" + std::to_string(i));
+        buffers.push_back(std::make_shared<hvt::HdReplayBuffer>(key, bufferSize,
+            hvt::HdBufferUsage::Static, true, bufferManager.GetPageFileManager(), memoryMonitor));
+        EXPECT_TRUE(bufferManager.AddBuffer(key, buffers.back()));
+    }
+    bufferManager.AdvanceFrame(2);
+
+    EXPECT_EQ(bufferManager.FreeSceneMemory(16 * bufferSize), 4 * bufferSize);
+    EXPECT_EQ(bufferManager.FreeSceneMemory(16 * bufferSize), 0u);
+    hvt::HdFrameIOStats stats = memoryMonitor->GetFrameIOBudget().GetStats();
+    EXPECT_EQ(stats.deferredPageOuts, 12u + 12u);
+    EXPECT_EQ(stats.deferredPageOutBytes, 24 * bufferSize);
+    EXPECT_EQ(stats.frameBytes, 4 * bufferSize);
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        bufferManager.AdvanceFrame();
+        EXPECT_EQ(bufferManager.FreeSceneMemory(16 * bufferSize), 4 * bufferSize);
+    }
+    EXPECT_EQ(memoryMonitor->GetUsedSceneMemory(), 0u);
+
+    // Without a budget, a single crawl frees everything.
+    for (const auto& buffer : buffers)
+    {
+        EXPECT_TRUE(buffer->SwapToSceneMemory(true));
+    }
+    memoryMonitor->GetFrameIOBudget().SetConfig({});
+    bufferManager.AdvanceFrame(2);
+    EXPECT_EQ(bufferManager.FreeSceneMemory(16 * bufferSize), 16 * bufferSize);
+
+    buffers.clear();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+
+    // Implicit page-ins beyond the budget return an empty value and resume in the next frames.
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory           = std::filesystem::temp_directory_path() / "hvt_frame_io_ds";
+    config.enableBackgroundCleanup     = false;
+    config.numThreads                  = 0;
+    config.frameIOBudget.bytesPerFrame = 1;
+    auto manager = std::make_shared<hvt::HdPageableDataSourceManager>(config);
+
+    std::vector<std::shared_ptr<hvt::HdPageableValue>> values;
+    for (int i = 0; i < 3; ++i)
+    {
+        auto value = std::dynamic_pointer_cast<hvt::HdPageableValue>(
+            manager->GetOrCreateBuffer(PXR_NS::SdfPath("/Values/Value" + std::to_string(i)),
+                PXR_NS::VtValue(PXR_NS::VtFloatArray(1000, 1.0f)), PXR_NS::TfToken("float[]")));
+        ASSERT_NE(value, nullptr);
+        EXPECT_TRUE(value->SwapSceneToDisk());
+        values.push_back(value);
+    }
+    manager->AdvanceFrame();
+
+    EXPECT_FALSE(values[0]->GetValue().IsEmpty());
+    EXPECT_TRUE(values[1]->GetValue().IsEmpty());
+    EXPECT_TRUE(values[2]->GetValue().IsEmpty());
+    EXPECT_TRUE(values[1]->GetValue().IsEmpty());
+    EXPECT_TRUE(values[1]->WillPageOnAccess());
+
+    // The deferred values are not loading, they stay paged out until resumed.
+    EXPECT_EQ(values[1]->GetStatus(), hvt::HdPagingStatus::PagedOut);
+    EXPECT_EQ(values[2]->GetStatus(), hvt::HdPagingStatus::PagedOut);
+    stats = manager->GetFrameIOStats();
+    EXPECT_EQ(stats.deferredPageIns, 2u);
+    EXPECT_EQ(stats.pendingPageIns, 2u);
+
+    manager->AdvanceFrame();
+    EXPECT_TRUE(values[1]->IsDataResident());
+    EXPECT_EQ(values[1]->GetStatus(), hvt::HdPagingStatus::Resident);
+    EXPECT_FALSE(values[2]->IsDataResident());
+    manager->AdvanceFrame();
+    EXPECT_TRUE(values[2]->IsDataResident());
+    EXPECT_EQ(values[2]->GetValue().Get<PXR_NS::VtFloatArray>().size(), 1000u);
+    stats = manager->GetFrameIOStats();
+    EXPECT_EQ(stats.resumedPageIns, 2u);
+    EXPECT_EQ(stats.pendingPageIns, 0u);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    manager->GetMemoryMonitor()->PrintMemoryStats();
+#endif
+
+    values.clear();
+    manager.reset();
+    std::filesystem::remove_all(config.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Priorities and cancellation of the asynchronous paging operations
+TEST(TestPageableBuffer, AsyncPriorities)
+{
+    // The queue alone: the most urgent step first, in submission order within a priority.
+    std::vector<int> order;
+    hvt::HdPagingTaskQueue queue;
+    queue.Push(hvt::HdPagingPriority::Background, [&order]() { order.push_back(4); });
+    queue.Push(hvt::HdPagingPriority::Eviction, [&order]() { order.push_back(3); });
+    queue.Push(hvt::HdPagingPriority::OnDemand, [&order]() { order.push_back(1); });
+    queue.Push(hvt::HdPagingPriority::Eviction, [&order]() { order.push_back(33); });
+    queue.Push(hvt::HdPagingPriority::Prefetch, [&order]() { order.push_back(2); });
+    EXPECT_EQ(queue.GetQueuedCount(), 5u);
+    EXPECT_EQ(queue.GetQueuedCount(hvt::HdPagingPriority::Eviction), 2u);
+    while (queue.RunNext())
+    {
+    }
+    EXPECT_EQ(order, (std::vector<int> { 1, 2, 3, 33, 4 }));
+
+    EXPECT_TRUE(hvt::HdPagingResult(true));
+    EXPECT_FALSE(hvt::HdPagingResult::Cancelled());
+    EXPECT_TRUE(hvt::HdPagingResult::Cancelled().IsCancelled());
+
+    // Buffers recording the order of their page-ins to renderer memory; the first one blocks
+    // the worker thread until it is released.
+    struct RecordingBuffer : hvt::HdReplayBuffer
+    {
+        using hvt::HdReplayBuffer::HdReplayBuffer;
+        bool PageToRendererMemory(bool force) override
+        {
+            if (started)
+            {
+                started->set_value();
+                release.wait();
+            }
+            std::lock_guard<std::mutex> lock(*mutex);
+            pagedIn->push_back(Key().GetName());
+            return hvt::HdReplayBuffer::PageToRendererMemory(force);
+        }
+
+        std::promise<void>* started = nullptr;
+        std::shared_future<void> release;
+        std::mutex* mutex = nullptr;
+        std::vector<std::string>* pagedIn = nullptr;
+    };
+
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_async_priorities";
+    desc.ageLimit          = 1;
+    desc.numThreads        = 2; // A single worker thread, the other slot is the caller's
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    std::mutex mutex;
+    std::vector<std::string> pagedIn;
+    std::promise<void> started;
+    std::promise<void> release;
+    const std::shared_future<void> released = release.get_future().share();
+    std::vector<std::shared_ptr<RecordingBuffer>> buffers;
+    for (const char* name : { "Blocker", "Evicted", "Prefetched", "Needed", "Stale", "Kept" })
+    {
+        const PXR_NS::SdfPath key(std::string("/Async/") + name);
+        buffers.push_back(std::make_shared<RecordingBuffer>(key, 64 * hvt::ONE_KiB,
+            hvt::HdBufferUsage::Static, true, bufferManager.GetPageFileManager(),
+            bufferManager.GetMemoryMonitor()));
+        buffers.back()->mutex   = &mutex;
+        buffers.back()->pagedIn = &pagedIn;
+        buffers.back()->release = released;
+        EXPECT_TRUE(bufferManager.AddBuffer(key, buffers.back()));
+    }
+    buffers[0]->started = &started;
+
+    auto blocker = bufferManager.PageToRendererMemoryAsync(buffers[0]);
+    started.get_future().wait();
+
+    // Queued behind the blocker: on-demand page-ins start before prefetches and evictions.
+    hvt::HdPagingTaskOptions eviction;
+    eviction.priority = hvt::HdPagingPriority::Eviction;
+    hvt::HdPagingTaskOptions prefetch;
+    prefetch.priority = hvt::HdPagingPriority::Prefetch;
+    auto evicted    = bufferManager.PageToRendererMemoryAsync(buffers[1], false, eviction);
+    auto prefetched = bufferManager.PageToRendererMemoryAsync(buffers[2], false, prefetch);
+    auto needed     = bufferManager.PageToRendererMemoryAsync(buffers[3]);
+
+    // A cancelled operation does nothing, and a page-out is cancelled by an access.
+    hvt::HdPagingTaskOptions cancellable;
+    cancellable.cancellation = hvt::HdPagingCancellationToken();
+    auto cancelled  = bufferManager.PageToRendererMemoryAsync(buffers[4], false, cancellable);
+    auto stale      = bufferManager.SwapSceneToDiskAsync(buffers[4], true);
+    auto kept       = bufferManager.SwapSceneToDiskAsync(buffers[5], true);
+    auto compaction = bufferManager.CompactPageFilesAsync();
+    cancellable.cancellation->Cancel();
+    buffers[4]->UpdateFrameStamp(bufferManager.GetCurrentFrame());
+
+    EXPECT_EQ(bufferManager.GetPendingOperations(), 8u);
+    EXPECT_EQ(bufferManager.GetPendingOperations(hvt::HdPagingPriority::OnDemand), 3u);
+    EXPECT_EQ(bufferManager.GetPendingOperations(hvt::HdPagingPriority::Prefetch), 1u);
+    EXPECT_EQ(bufferManager.GetPendingOperations(hvt::HdPagingPriority::Eviction), 3u);
+    EXPECT_EQ(bufferManager.GetPendingOperations(hvt::HdPagingPriority::Background), 1u);
+
+    release.set_value();
+    EXPECT_TRUE(blocker.get());
+    EXPECT_TRUE(needed.get());
+    EXPECT_TRUE(prefetched.get());
+    EXPECT_TRUE(evicted.get());
+
+    const hvt::HdPagingResult cancelledResult = cancelled.get();
+    EXPECT_FALSE(cancelledResult);
+    EXPECT_TRUE(cancelledResult.IsCancelled());
+    EXPECT_TRUE(stale.get().IsCancelled());
+    EXPECT_TRUE(buffers[4]->HasSceneBuffer());
+    EXPECT_TRUE(kept.get());
+    EXPECT_FALSE(buffers[5]->HasSceneBuffer());
+    (void)compaction.get();
+
+    bufferManager.WaitForAllOperations();
+    EXPECT_EQ(bufferManager.GetPendingOperations(), 0u);
+    EXPECT_EQ(pagedIn, (std::vector<std::string> { "Blocker", "Needed", "Prefetched", "Evicted" }));
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    bufferManager.GetMemoryMonitor()->PrintMemoryStats();
+#endif
+
+    buffers.clear();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Prefetch hints, co-access learning and prefetch hit rate
+TEST(TestPageableDataSource, Prefetch)
+{
+    // The history alone: buffers paged in together twice become neighbours.
+    hvt::HdPrefetchHistory history;
+    std::vector<PXR_NS::SdfPath> prefetched;
+    history.SetNeighbourCallback([&prefetched](const std::vector<PXR_NS::SdfPath>& keys)
+        { prefetched.insert(prefetched.end(), keys.begin(), keys.end()); });
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        history.RecordDemandPageIn(PXR_NS::SdfPath("/A"));
+        history.RecordDemandPageIn(PXR_NS::SdfPath("/B"));
+        history.EndFrame();
+    }
+    EXPECT_TRUE(prefetched.empty());
+    history.RecordDemandPageIn(PXR_NS::SdfPath("/C"));
+    history.EndFrame();
+    history.RecordDemandPageIn(PXR_NS::SdfPath("/A"));
+    EXPECT_EQ(prefetched, std::vector<PXR_NS::SdfPath> { PXR_NS::SdfPath("/B") });
+    EXPECT_TRUE(history.GetNeighbours(PXR_NS::SdfPath("/C")).empty());
+
+    // A hit is the first access of a prefetch within the hit window.
+    history.SetConfig({ true, 2, 2 });
+    history.RecordPrefetch(PXR_NS::SdfPath("/D"), false);
+    history.RecordPrefetch(PXR_NS::SdfPath("/E"), true);
+    history.RecordHit(PXR_NS::SdfPath("/D"));
+    history.RecordHit(PXR_NS::SdfPath("/D"));
+    history.EndFrame();
+    history.EndFrame();
+    hvt::HdPrefetchStats stats = history.GetStats();
+    EXPECT_EQ(stats.issued, 2u);
+    EXPECT_EQ(stats.learned, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.expired, 1u);
+    EXPECT_EQ(stats.demandPageIns, 6u);
+    EXPECT_FLOAT_EQ(stats.HitRate(), 0.5f);
+
+    // The data source manager prefetches on its async threads.
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory       = std::filesystem::temp_directory_path() / "hvt_prefetch_test";
+    config.enableBackgroundCleanup = false;
+    config.numThreads              = 2;
+    auto manager = std::make_shared<hvt::HdPageableDataSourceManager>(config);
+
+    const auto makeValue = [&manager](const std::string& path)
+    {
+        auto value = std::dynamic_pointer_cast<hvt::HdPageableValue>(
+            manager->GetOrCreateBuffer(PXR_NS::SdfPath(path),
+                PXR_NS::VtValue(PXR_NS::VtFloatArray(1000, 1.0f)), PXR_NS::TfToken("float[]")));
+        EXPECT_TRUE(value && value->SwapSceneToDisk());
+        return value;
+    };
+    const auto waitResident = [](const std::shared_ptr<hvt::HdPageableValue>& value)
+    {
+        for (int i = 0; i < 500 && !value->IsDataResident(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return value->IsDataResident();
+    };
+
+    // Prim paths: the buffers under the prims.
+    auto wheel = makeValue("/Car/Wheel.points");
+    auto body  = makeValue("/Car/Body.points");
+    auto tree  = makeValue("/Tree.points");
+    EXPECT_EQ(manager->Prefetch({ PXR_NS::SdfPath("/Car") }), 2u);
+    EXPECT_TRUE(waitResident(wheel));
+    EXPECT_TRUE(waitResident(body));
+    EXPECT_FALSE(tree->IsDataResident());
+    EXPECT_EQ(wheel->GetValue().Get<PXR_NS::VtFloatArray>().size(), 1000u);
+    stats = manager->GetPrefetchStats();
+    EXPECT_EQ(stats.requested, 2u);
+    EXPECT_EQ(stats.issued, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+
+    // Frustum: the prims whose bounds intersect it, the default frustum looking down -Z.
+    const PXR_NS::GfBBox3d inside(
+        PXR_NS::GfRange3d(PXR_NS::GfVec3d(-0.5, -0.5, -5.5), PXR_NS::GfVec3d(0.5, 0.5, -4.5)));
+    const PXR_NS::GfBBox3d outside(
+        PXR_NS::GfRange3d(PXR_NS::GfVec3d(99.5, -0.5, -5.5), PXR_NS::GfVec3d(100.5, 0.5, -4.5)));
+    EXPECT_TRUE(body->SwapSceneToDisk());
+    EXPECT_EQ(manager->Prefetch(PXR_NS::GfFrustum(),
+                  { { PXR_NS::SdfPath("/Tree"), inside }, { PXR_NS::SdfPath("/Car"), outside } }),
+        1u);
+    EXPECT_TRUE(waitResident(tree));
+    EXPECT_FALSE(body->IsDataResident());
+
+    // Time samples: the next samples from the current time on.
+    std::map<PXR_NS::HdSampledDataSource::Time, PXR_NS::VtValue> samples;
+    for (int time = 0; time < 4; ++time)
+    {
+        samples[static_cast<float>(time)] = PXR_NS::VtValue(PXR_NS::VtFloatArray(1000, 1.0f));
+    }
+    auto sampled =
+        hvt::HdPageableSampledDataSource::Cast(hvt::HdPageableDataSourceUtils::CreateTimeSampled(
+            samples, PXR_NS::SdfPath("/Anim"), PXR_NS::HdTokens->points, manager));
+    ASSERT_NE(sampled, nullptr);
+    const auto sampleBuffers = sampled->GetSampleBuffers(0.0f, 4);
+    ASSERT_EQ(sampleBuffers.size(), 4u);
+    for (const auto& buffer : sampleBuffers)
+    {
+        EXPECT_TRUE(buffer->SwapSceneToDisk());
+    }
+    EXPECT_EQ(manager->PrefetchTimeSamples(*sampled, 1.0f, 2), 2u);
+    EXPECT_TRUE(waitResident(sampleBuffers[1]));
+    EXPECT_TRUE(waitResident(sampleBuffers[2]));
+    EXPECT_FALSE(sampleBuffers[3]->IsDataResident());
+
+    // Co-access: the buffers paged in together are prefetched with the next demand page-in.
+    auto left  = makeValue("/Pair/Left.points");
+    auto right = makeValue("/Pair/Right.points");
+    for (int frame = 0; frame < 2; ++frame)
+    {
+        EXPECT_FALSE(left->GetValue().IsEmpty());
+        EXPECT_FALSE(right->GetValue().IsEmpty());
+        manager->AdvanceFrame();
+        EXPECT_TRUE(left->SwapSceneToDisk());
+        EXPECT_TRUE(right->SwapSceneToDisk());
+    }
+    bool pagedIn = false;
+    EXPECT_FALSE(left->GetValue(&pagedIn).IsEmpty());
+    EXPECT_TRUE(pagedIn);
+    EXPECT_TRUE(waitResident(right));
+    EXPECT_FALSE(right->GetValue(&pagedIn).IsEmpty());
+    EXPECT_FALSE(pagedIn);
+
+    stats = manager->GetPrefetchStats();
+    EXPECT_EQ(stats.issued, 6u);
+    EXPECT_EQ(stats.learned, 1u);
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_FLOAT_EQ(stats.HitRate(), 2.0f / 6.0f);
+
+#ifdef ENABLE_PAGE_ANALYSIS
+    manager->GetMemoryMonitor()->PrintMemoryStats();
+#endif
+
+    wheel.reset();
+    body.reset();
+    tree.reset();
+    left.reset();
+    right.reset();
+    sampled.reset();
+    manager.reset();
+    std::filesystem::remove_all(config.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Page ranges, and page-ins of the default serializer read straight into the value, on
+/// the synchronous and asynchronous paths; string arrays still round trip through a staging page.
+TEST(TestPageableDataSource, DirectPageIn)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_direct_page_in";
+    desc.numThreads        = 2;
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    // Ranges of a page, and ranges beyond its end.
+    std::vector<uint8_t> bytes(1000);
+    for (size_t i = 0; i < bytes.size(); ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 7);
+    }
+    auto page = pageFileManager->CreatePageEntry(bytes.data(), bytes.size());
+    ASSERT_NE(page, nullptr);
+    std::vector<std::byte> range(100);
+    EXPECT_TRUE(pageFileManager->LoadPageRange(*page, 900, range));
+    EXPECT_TRUE(std::equal(range.begin(), range.end(), bytes.begin() + 900,
+        [](std::byte a, uint8_t b) { return static_cast<uint8_t>(a) == b; }));
+    EXPECT_FALSE(pageFileManager->LoadPageRange(*page, 901, range));
+    EXPECT_FALSE(pageFileManager->LoadPageRange(*page, 2000, {}));
+    pageFileManager->ReleasePage(*page);
+
+    PXR_NS::VtVec3fArray points(50000);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        points[i] = PXR_NS::GfVec3f(static_cast<float>(i), 0.5f, -static_cast<float>(i));
+    }
+    PXR_NS::VtIntArray indices(3001);
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = static_cast<int>(i % 17);
+    }
+    const PXR_NS::VtStringArray names = { "wheel", "", "body" };
+
+    auto makeValue = [&bufferManager](const std::string& path, const PXR_NS::VtValue& value)
+    {
+        return std::make_shared<hvt::HdPageableValue>(PXR_NS::SdfPath(path),
+            hvt::HdPageableValue::EstimateMemoryUsage(value), hvt::HdBufferUsage::Static,
+            bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor(),
+            [](const PXR_NS::SdfPath&) {}, value, PXR_NS::TfToken("data"));
+    };
+    auto pointsValue  = makeValue("/Direct/points", PXR_NS::VtValue(points));
+    auto indicesValue = makeValue("/Direct/indices", PXR_NS::VtValue(indices));
+    auto namesValue   = makeValue("/Direct/names", PXR_NS::VtValue(names));
+    auto emptyValue   = makeValue("/Direct/empty", PXR_NS::VtValue(PXR_NS::VtFloatArray()));
+
+    // Synchronous page-in, implicitly on access.
+    for (const auto& value : { pointsValue, indicesValue, namesValue, emptyValue })
+    {
+        EXPECT_TRUE(value->SwapSceneToDisk());
+        EXPECT_FALSE(value->IsDataResident());
+    }
+    EXPECT_EQ(pointsValue->GetValue().Get<PXR_NS::VtVec3fArray>(), points);
+    EXPECT_EQ(indicesValue->GetValue().Get<PXR_NS::VtIntArray>(), indices);
+    EXPECT_EQ(namesValue->GetValue().Get<PXR_NS::VtStringArray>(), names);
+    auto empty = emptyValue->GetValue();
+    ASSERT_TRUE(empty.IsHolding<PXR_NS::VtFloatArray>());
+    EXPECT_TRUE(empty.UncheckedGet<PXR_NS::VtFloatArray>().empty());
+
+    // Asynchronous page-in: the value is read on a task thread rather than the I/O engine.
+    EXPECT_TRUE(pointsValue->SwapSceneToDisk());
+    EXPECT_EQ(pointsValue->PreparePageIn(), nullptr);
+    EXPECT_TRUE(bufferManager.SwapToSceneMemoryAsync(pointsValue).get());
+    EXPECT_TRUE(pointsValue->IsDataResident());
+    EXPECT_EQ(pointsValue->GetPageInCount(), 2u);
+    EXPECT_EQ(pointsValue->GetValueIfResident().Get<PXR_NS::VtVec3fArray>(), points);
+
+    pointsValue.reset();
+    indicesValue.reset();
+    namesValue.reset();
+    emptyValue.reset();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Streamed page writes, and large values paged out straight from their storage without
+/// a serialized copy.
+TEST(TestPageableDataSource, StreamingPageOut)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_streaming_page_out";
+    hvt::DefaultBufferManager bufferManager(desc);
+    auto& pageFileManager = bufferManager.GetPageFileManager();
+
+    // Small chunks are gathered, large ones written as is; the page reads back the same.
+    const size_t largeChunk = hvt::HdPageFileManager::STREAM_CHUNK_SIZE + 3;
+    std::vector<std::byte> bytes(3 * largeChunk + 100);
+    for (size_t i = 0; i < bytes.size(); ++i)
+    {
+        bytes[i] = static_cast<std::byte>(i * 13);
+    }
+    auto writeChunks = [&bytes, largeChunk](const hvt::HdPageSink& sink)
+    {
+        size_t position = 0;
+        for (size_t chunk : { size_t { 1 }, size_t { 99 }, largeChunk, largeChunk, largeChunk })
+        {
+            if (!sink(PXR_NS::TfSpan<const std::byte>(bytes.data() + position, chunk)))
+                return false;
+            position += chunk;
+        }
+        return true;
+    };
+    auto page = pageFileManager->CreatePageEntry(bytes.size(), writeChunks);
+    ASSERT_NE(page, nullptr);
+    std::vector<std::byte> readBack(bytes.size());
+    EXPECT_TRUE(pageFileManager->LoadPage(*page, readBack));
+    EXPECT_EQ(readBack, bytes);
+
+    std::reverse(bytes.begin(), bytes.end());
+    EXPECT_TRUE(pageFileManager->UpdatePage(*page, writeChunks));
+    EXPECT_TRUE(pageFileManager->LoadPage(*page, readBack));
+    EXPECT_EQ(readBack, bytes);
+    pageFileManager->ReleasePage(*page);
+
+    // Writers which do not produce the announced size fail.
+    EXPECT_EQ(pageFileManager->CreatePageEntry(bytes.size() + 1, writeChunks), nullptr);
+    EXPECT_EQ(pageFileManager->CreatePageEntry(bytes.size() - 1, writeChunks), nullptr);
+
+    // The serialized size and the streamed bytes match Serialize.
+    hvt::HdDefaultValueSerializer serializer;
+    PXR_NS::VtVec3fArray points(20000);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        points[i] = PXR_NS::GfVec3f(static_cast<float>(i), 1.0f, 2.0f);
+    }
+    const PXR_NS::VtTokenArray tokens = { PXR_NS::TfToken("left"), PXR_NS::TfToken("right") };
+    for (const auto& value : { PXR_NS::VtValue(points), PXR_NS::VtValue(tokens) })
+    {
+        const auto serialized = serializer.Serialize(value);
+        EXPECT_EQ(serializer.GetSerializedSize(value), serialized.size());
+        std::vector<uint8_t> streamed;
+        EXPECT_TRUE(serializer.SerializeTo(value,
+            [&streamed](PXR_NS::TfSpan<const std::byte> chunk)
+            {
+                const auto* data = reinterpret_cast<const uint8_t*>(chunk.data());
+                streamed.insert(streamed.end(), data, data + chunk.size());
+                return true;
+            }));
+        EXPECT_EQ(streamed, serialized);
+    }
+
+    // A large value is streamed: it is not batched for the I/O engine, and PageToDisk keeps it
+    // resident with a current disk page.
+    auto value = std::make_shared<hvt::HdPageableValue>(PXR_NS::SdfPath("/Streaming/points"),
+        hvt::HdPageableValue::EstimateMemoryUsage(PXR_NS::VtValue(points)),
+        hvt::HdBufferUsage::Static, pageFileManager, bufferManager.GetMemoryMonitor(),
+        [](const PXR_NS::SdfPath&) {}, PXR_NS::VtValue(points), PXR_NS::TfToken("points"));
+    EXPECT_TRUE(value->PreparePageOut(hvt::HdBufferState::SceneBuffer).empty());
+    EXPECT_TRUE(value->PageToDisk());
+    EXPECT_TRUE(value->IsDataResident());
+    EXPECT_TRUE(value->HasValidDiskBuffer());
+
+    // The current page is not written again by the page-out.
+    EXPECT_TRUE(value->SwapSceneToDisk());
+    EXPECT_FALSE(value->IsDataResident());
+    EXPECT_EQ(value->GetValue().Get<PXR_NS::VtVec3fArray>(), points);
+
+    // A changed value of the same size updates its page in place.
+    points[0] = PXR_NS::GfVec3f(-1.0f);
+    value->SetResidentValue(PXR_NS::VtValue(points));
+    EXPECT_TRUE(value->SwapSceneToDisk());
+    EXPECT_EQ(value->GetValue().Get<PXR_NS::VtVec3fArray>(), points);
+
+    value.reset();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: The value type registry serializes scalars, Gf arrays, paths and dictionaries, keeps the
+/// original tags, reports the exact memory of the values and takes user types.
+TEST(TestPageableDataSource, ValueTypeRegistry)
+{
+    hvt::HdDefaultValueSerializer serializer;
+    auto roundTrip = [&serializer](const PXR_NS::VtValue& value)
+    {
+        const auto data = serializer.Serialize(value);
+        EXPECT_FALSE(data.empty());
+        EXPECT_EQ(serializer.GetSerializedSize(value), data.size());
+        return serializer.Deserialize(data, PXR_NS::TfToken());
+    };
+
+    // The tags of the pages written before the registry did not change.
+    EXPECT_EQ(serializer.Serialize(PXR_NS::VtValue(PXR_NS::VtFloatArray(2)))[0], 1);
+    EXPECT_EQ(serializer.Serialize(PXR_NS::VtValue(PXR_NS::VtTokenArray(2)))[0], 22);
+
+    const PXR_NS::GfMatrix4d matrix(2.0);
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(matrix)).Get<PXR_NS::GfMatrix4d>(), matrix);
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(0.5f)).Get<float>(), 0.5f);
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(std::string("name"))).Get<std::string>(), "name");
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(PXR_NS::TfToken("token"))).Get<PXR_NS::TfToken>(),
+        PXR_NS::TfToken("token"));
+
+    const PXR_NS::VtArray<PXR_NS::SdfPath> paths = { PXR_NS::SdfPath("/World/a"),
+        PXR_NS::SdfPath("/World/b") };
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(paths)).Get<PXR_NS::VtArray<PXR_NS::SdfPath>>(), paths);
+    const PXR_NS::VtRange3dArray ranges(
+        3, PXR_NS::GfRange3d(PXR_NS::GfVec3d(-1.0), PXR_NS::GfVec3d(1.0)));
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(ranges)).Get<PXR_NS::VtRange3dArray>(), ranges);
+    const PXR_NS::VtBoolArray flags = { true, false, true };
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(flags)).Get<PXR_NS::VtBoolArray>(), flags);
+
+    // Dictionaries hold any serializable value, nested dictionaries included.
+    PXR_NS::VtDictionary inner;
+    inner["transform"] = PXR_NS::VtValue(matrix);
+    PXR_NS::VtDictionary dictionary;
+    dictionary["indices"] = PXR_NS::VtValue(PXR_NS::VtIntArray { 0, 1, 2 });
+    dictionary["inner"]   = PXR_NS::VtValue(inner);
+    EXPECT_EQ(roundTrip(PXR_NS::VtValue(dictionary)).Get<PXR_NS::VtDictionary>(), dictionary);
+
+    // A truncated dictionary page deserializes to an empty value.
+    auto data = serializer.Serialize(PXR_NS::VtValue(dictionary));
+    data.resize(data.size() - 1);
+    EXPECT_TRUE(serializer.Deserialize(data, PXR_NS::TfToken()).IsEmpty());
+
+    // Types without codec, and dictionaries holding them, are not serializable.
+    EXPECT_FALSE(serializer.CanSerialize(typeid(std::vector<int>)));
+    PXR_NS::VtDictionary unsupported;
+    unsupported["values"] = PXR_NS::VtValue(std::vector<int> { 1 });
+    EXPECT_TRUE(serializer.Serialize(PXR_NS::VtValue(unsupported)).empty());
+
+    // The memory usage is exact.
+    EXPECT_EQ(hvt::HdPageableValue::EstimateMemoryUsage(
+                  PXR_NS::VtValue(PXR_NS::VtMatrix4dArray(10))),
+        10 * sizeof(PXR_NS::GfMatrix4d));
+    EXPECT_EQ(hvt::HdPageableValue::EstimateMemoryUsage(PXR_NS::VtValue(matrix)),
+        sizeof(PXR_NS::GfMatrix4d));
+    EXPECT_EQ(hvt::HdPageableValue::EstimateMemoryUsage(PXR_NS::VtValue(paths)),
+        paths.size() * sizeof(PXR_NS::SdfPath));
+
+    // User types take the tags from FIRST_USER_TAG on.
+    struct Weight
+    {
+        float value;
+        uint32_t joint;
+        bool operator==(const Weight& other) const
+        {
+            return value == other.value && joint == other.joint;
+        }
+    };
+    auto& registry = hvt::HdValueTypeRegistry::GetInstance();
+    if (!registry.Find(typeid(Weight)))
+    {
+        EXPECT_FALSE(registry.RegisterPod<Weight>(hvt::HdValueTypeRegistry::FIRST_USER_TAG - 2));
+        EXPECT_TRUE(registry.RegisterPod<Weight>(hvt::HdValueTypeRegistry::FIRST_USER_TAG, 4));
+    }
+    EXPECT_FALSE(registry.RegisterPod<Weight>(hvt::HdValueTypeRegistry::FIRST_USER_TAG + 2));
+    EXPECT_TRUE(serializer.CanSerialize(typeid(PXR_NS::VtArray<Weight>)));
+    const auto weights = roundTrip(PXR_NS::VtValue(PXR_NS::VtArray<Weight>(5, Weight { 0.25f, 3 })))
+                             .Get<PXR_NS::VtArray<Weight>>();
+    ASSERT_EQ(weights.size(), 5u);
+    EXPECT_EQ(weights[4].value, 0.25f);
+    EXPECT_EQ(weights[4].joint, 3u);
+
+    // Scalars and dictionaries page like arrays.
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_value_type_registry";
+    hvt::DefaultBufferManager bufferManager(desc);
+    for (const auto& value : { PXR_NS::VtValue(matrix), PXR_NS::VtValue(dictionary) })
+    {
+        auto pageableValue = std::make_shared<hvt::HdPageableValue>(
+            PXR_NS::SdfPath("/Registry/value"), hvt::HdPageableValue::EstimateMemoryUsage(value),
+            hvt::HdBufferUsage::Static, bufferManager.GetPageFileManager(),
+            bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {}, value,
+            PXR_NS::TfToken(value.GetTypeName()));
+        EXPECT_TRUE(pageableValue->SwapSceneToDisk());
+        EXPECT_FALSE(pageableValue->IsDataResident());
+        EXPECT_EQ(pageableValue->GetValue(), value);
+    }
+
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Chunked arrays page their chunks independently, and range accesses page in only the
+/// chunks they touch.
+TEST(TestPageableDataSource, ChunkedArray)
+{
+    hvt::DefaultBufferManager::InitializeDesc desc;
+    desc.pageFileDirectory = std::filesystem::temp_directory_path() / "hvt_chunked_array";
+    hvt::DefaultBufferManager bufferManager(desc);
+
+    // 1000 points per chunk, the last chunk holds the 3 remaining ones.
+    PXR_NS::VtVec3fArray points(10003);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        points[i] = PXR_NS::GfVec3f(static_cast<float>(i), 1.0f, 2.0f);
+    }
+    const size_t chunkSize = 1000 * sizeof(PXR_NS::GfVec3f) + 5;
+    auto source = hvt::HdPageableChunkedArrayDataSource::New(PXR_NS::VtValue(points),
+        PXR_NS::SdfPath("/Scan"), PXR_NS::TfToken("points"), bufferManager.GetPageFileManager(),
+        bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {},
+        hvt::HdBufferUsage::Static, chunkSize);
+    ASSERT_NE(source, nullptr);
+    EXPECT_EQ(source->GetElementCount(), points.size());
+    EXPECT_EQ(source->GetElementsPerChunk(), 1000u);
+    EXPECT_EQ(source->GetChunkCount(), 11u);
+    EXPECT_EQ(source->GetChunkIndex(2999), 2u);
+    EXPECT_EQ(source->GetResidentChunkCount(), 11u);
+
+    EXPECT_TRUE(source->SwapSceneToDisk());
+    EXPECT_EQ(source->GetResidentChunkCount(), 0u);
+
+    // A range across two chunks pages in these two only.
+    const PXR_NS::VtValue range = source->GetRange(2500, 1000);
+    ASSERT_TRUE(range.IsHolding<PXR_NS::VtVec3fArray>());
+    const auto& rangePoints = range.UncheckedGet<PXR_NS::VtVec3fArray>();
+    ASSERT_EQ(rangePoints.size(), 1000u);
+    EXPECT_EQ(rangePoints[0], points[2500]);
+    EXPECT_EQ(rangePoints[999], points[3499]);
+    EXPECT_EQ(source->GetResidentChunkCount(), 2u);
+    EXPECT_TRUE(source->IsChunkResident(2));
+    EXPECT_TRUE(source->IsChunkResident(3));
+    EXPECT_FALSE(source->IsChunkResident(4));
+
+    // The chunks are visited without a copy, up to the end of the array.
+    std::vector<size_t> firstElements;
+    size_t visitedElements = 0;
+    EXPECT_TRUE(source->ForEachChunk(9990, 100,
+        [&](const PXR_NS::VtValue& chunk, size_t firstElement)
+        {
+            firstElements.push_back(firstElement);
+            visitedElements += chunk.UncheckedGet<PXR_NS::VtVec3fArray>().size();
+            return true;
+        }));
+    EXPECT_EQ(firstElements, (std::vector<size_t> { 9000, 10000 }));
+    EXPECT_EQ(visitedElements, 1003u);
+    EXPECT_FALSE(source->ForEachChunk(0, 3000,
+        [](const PXR_NS::VtValue&, size_t) { return false; }));
+
+    // Ranges are clamped to the array.
+    EXPECT_EQ(source->GetRange(10000, 10).UncheckedGet<PXR_NS::VtVec3fArray>().size(), 3u);
+    EXPECT_TRUE(source->GetRange(20000, 10).UncheckedGet<PXR_NS::VtVec3fArray>().empty());
+    EXPECT_EQ(source->GetChunkBuffers(0, 2500).size(), 3u);
+    EXPECT_TRUE(source->GetChunk(11).IsEmpty());
+
+    // The consumers which are not chunk-aware get the whole array.
+    EXPECT_EQ(source->GetValue(0.0f).UncheckedGet<PXR_NS::VtVec3fArray>(), points);
+    EXPECT_EQ(source->GetResidentChunkCount(), 11u);
+
+    // Without implicit paging, the chunks paged out are not available.
+    auto explicitSource = hvt::HdPageableChunkedArrayDataSource::New(PXR_NS::VtValue(points),
+        PXR_NS::SdfPath("/ExplicitScan"), PXR_NS::TfToken("points"),
+        bufferManager.GetPageFileManager(), bufferManager.GetMemoryMonitor(),
+        [](const PXR_NS::SdfPath&) {}, hvt::HdBufferUsage::Static, chunkSize, false);
+    ASSERT_NE(explicitSource, nullptr);
+    EXPECT_TRUE(explicitSource->SwapSceneToDisk());
+    EXPECT_TRUE(explicitSource->GetRange(0, 10).IsEmpty());
+    EXPECT_TRUE(explicitSource->GetChunkIfResident(0).IsEmpty());
+    EXPECT_TRUE(explicitSource->SwapToSceneMemory());
+    EXPECT_EQ(explicitSource->GetChunkIfResident(0).UncheckedGet<PXR_NS::VtVec3fArray>()[999],
+        points[999]);
+
+    // Arrays which are not their payload are not chunked.
+    const PXR_NS::VtValue tokens(PXR_NS::VtTokenArray { PXR_NS::TfToken("a") });
+    EXPECT_FALSE(hvt::HdPageableChunkedArrayDataSource::CanChunk(tokens));
+    EXPECT_EQ(hvt::HdPageableChunkedArrayDataSource::New(tokens, PXR_NS::SdfPath("/Tokens"),
+                  PXR_NS::TfToken("tokens"), bufferManager.GetPageFileManager(),
+                  bufferManager.GetMemoryMonitor(), [](const PXR_NS::SdfPath&) {}),
+        nullptr);
+    EXPECT_NE(hvt::HdPageableDataSourceUtils::CreateChunkedArray(
+                  tokens, PXR_NS::SdfPath("/Tokens"), PXR_NS::TfToken("tokens"), nullptr),
+        nullptr);
+
+    source.reset();
+    explicitSource.reset();
+    std::filesystem::remove_all(desc.pageFileDirectory);
+    GTEST_SUCCEED();
+}
+
+/// Test: Quantized pages store the points, normals and UVs within their error bounds, and the
+/// other values exactly.
+TEST(TestPageableDataSource, QuantizedPages)
+{
+    hvt::HdQuantizedValueSerializer serializer(std::make_shared<hvt::HdDefaultValueSerializer>());
+
+    const size_t count = 4096;
+    PXR_NS::VtVec3fArray points(count);
+    PXR_NS::VtVec3fArray normals(count);
+    PXR_NS::VtVec2fArray uvs(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float t = static_cast<float>(i);
+        points[i] = PXR_NS::GfVec3f(std::sin(t) * 100.0f, std::cos(t * 0.7f) * 10.0f, t * 0.01f);
+        normals[i] =
+            PXR_NS::GfVec3f(std::sin(t), std::cos(t * 1.3f), std::sin(t * 0.3f) - 0.5f)
+                .GetNormalized();
+        uvs[i] = PXR_NS::GfVec2f(t / count, 1.0f - 2.0f * t / count);
+    }
+
+    // Positions: 6 bytes per point, within half a step of the grid of their bounding box.
+    auto page = serializer.SerializeAttribute(PXR_NS::VtValue(points), PXR_NS::HdTokens->points);
+    EXPECT_EQ(page[0], static_cast<uint8_t>(hvt::HdQuantizedRole::Position));
+    EXPECT_EQ(page.size(), 33 + count * 6);
+    auto value = serializer.Deserialize(page, PXR_NS::HdTokens->points);
+    ASSERT_TRUE(value.IsHolding<PXR_NS::VtVec3fArray>());
+    const auto& decodedPoints = value.UncheckedGet<PXR_NS::VtVec3fArray>();
+    ASSERT_EQ(decodedPoints.size(), count);
+    const PXR_NS::GfVec3f extent(200.0f, 20.0f, 41.0f);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            EXPECT_LE(std::abs(decodedPoints[i][axis] - points[i][axis]),
+                extent[axis] / 65535.0f * 0.51f);
+        }
+    }
+
+    // Normals: 4 bytes per normal, unit length.
+    page = serializer.SerializeAttribute(PXR_NS::VtValue(normals), PXR_NS::HdTokens->normals);
+    EXPECT_EQ(page[0], static_cast<uint8_t>(hvt::HdQuantizedRole::Normal));
+    EXPECT_EQ(page.size(), 9 + count * 4);
+    value = serializer.Deserialize(page, PXR_NS::HdTokens->normals);
+    const auto& decodedNormals = value.UncheckedGet<PXR_NS::VtVec3fArray>();
+    ASSERT_EQ(decodedNormals.size(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_LE((decodedNormals[i] - normals[i]).GetLength(),
+            hvt::HdPageQuantization::OCTAHEDRAL_MAX_ERROR);
+        EXPECT_LE(std::abs(decodedNormals[i].GetLength() - 1.0f), 1e-5f);
+    }
+
+    // Texture coordinates: half floats.
+    const PXR_NS::TfToken st("primvars:st");
+    page = serializer.SerializeAttribute(PXR_NS::VtValue(uvs), st);
+    EXPECT_EQ(page[0], static_cast<uint8_t>(hvt::HdQuantizedRole::TexCoord));
+    EXPECT_EQ(page.size(), 9 + count * 4);
+    value = serializer.Deserialize(page, st);
+    const auto& decodedUvs = value.UncheckedGet<PXR_NS::VtVec2fArray>();
+    ASSERT_EQ(decodedUvs.size(), count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            EXPECT_LE(std::abs(decodedUvs[i][axis] - uvs[i][axis]),
+                std::abs(uvs[i][axis]) * std::ldexp(1.0f, -11) + std::ldexp(1.0f, -25));
+        }
+    }
+
+    // A truncated page deserializes to an empty value.
+    page.resize(page.size() - 1);
+    EXPECT_TRUE(serializer.Deserialize(page, st).IsEmpty());
+
+    // The other attributes, the other types and the values out of the range of the encodings
+    // are stored exactly.
+    PXR_NS::VtVec3fArray farPoints(points);
+    farPoints[7] = PXR_NS::GfVec3f(std::numeric_limits<float>::infinity());
+    // The extent of this bounding box overflows a float.
+    PXR_NS::VtVec3fArray hugePoints(points);
+    hugePoints[3] = PXR_NS::GfVec3f(-3e38f, 0.0f, 0.0f);
+    hugePoints[5] = PXR_NS::GfVec3f(3e38f, 0.0f, 0.0f);
+    PXR_NS::VtVec2fArray farUvs(uvs);
+    farUvs[7] = PXR_NS::GfVec2f(1e6f, 0.0f);
+    const std::vector<std::pair<PXR_NS::VtValue, PXR_NS::TfToken>> exactValues = {
+        { PXR_NS::VtValue(points), PXR_NS::TfToken("velocities") },
+        { PXR_NS::VtValue(points), PXR_NS::TfToken() },
+        { PXR_NS::VtValue(PXR_NS::VtFloatArray(10, 0.5f)), PXR_NS::HdTokens->points },
+        { PXR_NS::VtValue(farPoints), PXR_NS::HdTokens->points },
+        { PXR_NS::VtValue(hugePoints), PXR_NS::HdTokens->points },
+        { PXR_NS::VtValue(farUvs), st },
+    };
+    for (const auto& [exactValue, typeHint] : exactValues)
+    {
+        page = serializer.SerializeAttribute(exactValue, typeHint);
+        EXPECT_EQ(page[0], static_cast<uint8_t>(hvt::HdQuantizedRole::None));
+        EXPECT_EQ(serializer.Deserialize(page, typeHint), exactValue);
+    }
+
+    // Manager opted in: the normals page on disk in their quantized format, compressed.
+    hvt::HdPageableDataSourceManager::Config config;
+    config.pageFileDirectory       = std::filesystem::temp_directory_path() / "hvt_quantized_test";
+    config.enableBackgroundCleanup = false;
+    config.pageCodec               = hvt::HdPageCodec::ShuffleLZ;
+    config.quantizedPages          = true;
+    auto manager = std::make_shared<hvt::HdPageableDataSourceManager>(config);
+    auto compressed =
+        std::dynamic_pointer_cast<hvt::HdCompressedValueSerializer>(manager->GetSerializer());
+    ASSERT_NE(compressed, nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<hvt::HdQuantizedValueSerializer>(
+                  compressed->GetSerializer()),
+        nullptr);
+
+    auto pageableValue = std::dynamic_pointer_cast<hvt::HdPageableValue>(
+        manager->GetOrCreateBuffer(PXR_NS::SdfPath("/Quantized/normals"),
+            PXR_NS::VtValue(normals), PXR_NS::HdTokens->normals));
+    ASSERT_NE(pageableValue, nullptr);
+    EXPECT_TRUE(pageableValue->SwapSceneToDisk());
+    EXPECT_LE(manager->GetPageFileManager()->GetFragmentationStats().fileBytes,
+        count * sizeof(PXR_NS::GfVec3f) / 3 + 64);
+
+    value = pageableValue->GetValue();
+    ASSERT_TRUE(value.IsHolding<PXR_NS::VtVec3fArray>());
+    EXPECT_LE((value.UncheckedGet<PXR_NS::VtVec3fArray>()[100] - normals[100]).GetLength(),
+        hvt::HdPageQuantization::OCTAHEDRAL_MAX_ERROR);
+
+    pageableValue.reset();
+    manager.reset();
+    std::filesystem::remove_all(config.pageFileDirectory);
+    GTEST_SUCCEED();
+}